@@ -0,0 +1,191 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+#include "catch.hpp"
+#include "Common/JobQueuePolicy.h"
+
+namespace JobQueuePolicyTests
+{
+    // Stand-ins for a job manager (such as a script context's native code generator) and its jobs
+    struct TestManager
+    {
+        unsigned int lastJobStartedStamp;
+    };
+
+    struct TestJob
+    {
+        TestJob *next;
+        TestManager *manager;
+        bool isCritical;
+        unsigned int priority;
+        unsigned int addedStamp;
+    };
+
+    struct TestJobTraits
+    {
+        static TestJob *Next(TestJob *const job) { return job->next; }
+        static bool MustGoFirst(TestJob *const job) { return job->isCritical; }
+        static unsigned int GetPriority(TestJob *const job) { return job->priority; }
+        static unsigned int GetAddedStamp(TestJob *const job) { return job->addedStamp; }
+        static unsigned int GetManagerLastStartedStamp(TestJob *const job) { return job->manager->lastJobStartedStamp; }
+    };
+
+    typedef JsUtil::JobQueuePolicy<TestJob, TestJobTraits> Policy;
+
+    // Queues and starts jobs the way BackgroundJobProcessor does, on a single thread
+    class TestJobQueue
+    {
+    public:
+        static const int MaxJobs = 256;
+
+        TestJobQueue(const bool takeTurns, const unsigned int agingPeriod)
+            : head(nullptr), numJobs(0), numJobsStarted(0), takeTurns(takeTurns), agingPeriod(agingPeriod)
+        {
+        }
+
+        TestJob *Add(TestManager *const manager, const unsigned int priority, const bool isCritical = false)
+        {
+            REQUIRE(numJobs < MaxJobs);
+            TestJob *const job = &jobs[numJobs++];
+            job->next = nullptr;
+            job->manager = manager;
+            job->isCritical = isCritical;
+            job->priority = priority;
+            job->addedStamp = numJobsStarted;
+
+            TestJob **link = &head;
+            while (*link)
+            {
+                link = &(*link)->next;
+            }
+            *link = job;
+            return job;
+        }
+
+        TestJob *StartNext()
+        {
+            TestJob *const job = Policy::SelectJobToProcess(head, numJobsStarted, takeTurns, agingPeriod);
+            if (job)
+            {
+                TestJob **link = &head;
+                while (*link != job)
+                {
+                    link = &(*link)->next;
+                }
+                *link = job->next;
+                job->manager->lastJobStartedStamp = ++numJobsStarted;
+            }
+            return job;
+        }
+
+    private:
+        TestJob jobs[MaxJobs];
+        TestJob *head;
+        int numJobs;
+        unsigned int numJobsStarted;
+        const bool takeTurns;
+        const unsigned int agingPeriod;
+    };
+
+    // Returns after how many other jobs the other manager's single job starts, when it is queued behind a flood of jobs of
+    // the same priority from one manager
+    int GetStartIndexBehindFlood(const bool takeTurns)
+    {
+        TestManager flooded = { 0 };
+        TestManager other = { 0 };
+        TestJobQueue queue(takeTurns, 4);
+
+        for (int i = 0; i < 20; i++)
+        {
+            queue.Add(&flooded, 0);
+        }
+        TestJob *const otherJob = queue.Add(&other, 0);
+
+        for (int i = 0; ; i++)
+        {
+            TestJob *const job = queue.StartNext();
+            REQUIRE(job != nullptr);
+            if (job == otherJob)
+            {
+                return i;
+            }
+        }
+    }
+
+    TEST_CASE("JobQueuePolicyTest_FloodedManagerDoesNotStarveOthers", "[JobQueuePolicyTest]")
+    {
+        // Managers take turns, so the other manager's job starts right after the flooded manager's first one
+        CHECK(GetStartIndexBehindFlood(true) == 1);
+
+        // Without turns (-FairJobQueue-) it waits for the whole flood
+        CHECK(GetStartIndexBehindFlood(false) == 20);
+    }
+
+    // Returns after how many other jobs a low priority job starts, when a higher priority job is queued before each start.
+    // Returns -1 if it hasn't started after 100 jobs.
+    int GetStartIndexUnderSteadyStream(const unsigned int agingPeriod)
+    {
+        TestManager manager = { 0 };
+        TestJobQueue queue(true, agingPeriod);
+
+        TestJob *const lowJob = queue.Add(&manager, 0);
+        for (int i = 0; i < 100; i++)
+        {
+            queue.Add(&manager, 3);
+            if (queue.StartNext() == lowJob)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    TEST_CASE("JobQueuePolicyTest_Aging", "[JobQueuePolicyTest]")
+    {
+        // A job gains a level for every agingPeriod jobs started ahead of it
+        TestManager manager = { 0 };
+        TestJob job = { nullptr, &manager, false, 2, 3 };
+        CHECK(Policy::GetAgedPriority(&job, 11, 4) == 4);
+        CHECK(Policy::GetAgedPriority(&job, 11, 0) == 2);
+
+        // The low priority job catches up with the new jobs three levels above it after 3 * 4 jobs, and wins the tie since
+        // it's at the front of the queue
+        CHECK(GetStartIndexUnderSteadyStream(4) == 12);
+        CHECK(GetStartIndexUnderSteadyStream(1) == 3);
+
+        // Without aging it's starved
+        CHECK(GetStartIndexUnderSteadyStream(0) == -1);
+    }
+
+    TEST_CASE("JobQueuePolicyTest_CriticalJobsGoFirst", "[JobQueuePolicyTest]")
+    {
+        TestManager busy = { 0 };
+        TestManager other = { 0 };
+        TestJobQueue queue(true, 4);
+
+        TestJob *const highJob = queue.Add(&busy, 10);
+        TestJob *const criticalJob = queue.Add(&busy, 0, true);
+        TestJob *const otherJob = queue.Add(&other, 0);
+
+        CHECK(queue.StartNext() == criticalJob);
+        CHECK(queue.StartNext() == otherJob);
+        CHECK(queue.StartNext() == highJob);
+        CHECK(queue.StartNext() == nullptr);
+    }
+
+    TEST_CASE("JobQueuePolicyTest_HigherPriorityFirstWithinManager", "[JobQueuePolicyTest]")
+    {
+        TestManager manager = { 0 };
+        TestJobQueue queue(true, 0);
+
+        TestJob *const lowJob = queue.Add(&manager, 1);
+        TestJob *const highJob = queue.Add(&manager, 5);
+        TestJob *const sameAsHighJob = queue.Add(&manager, 5);
+
+        CHECK(queue.StartNext() == highJob);
+        CHECK(queue.StartNext() == sameAsHighJob);
+        CHECK(queue.StartNext() == lowJob);
+    }
+}
@@ -2621,4 +2621,358 @@ namespace JsRTApiTest
     {
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreateStringTest);
     }
+
+    // Each profile in the data starts with the 64-bit host source context, an is-hot byte and the local function id.
+    // Returns the is-hot byte of the given function, or -1 if the data has no profile for it.
+    int GetProfileIsHot(JsValueRef profileData, JsSourceContext sourceContext, unsigned int functionId)
+    {
+        BYTE *buffer = nullptr;
+        unsigned int length = 0;
+        REQUIRE(JsGetArrayBufferStorage(profileData, &buffer, &length) == JsNoError);
+
+        unsigned long long hostSourceContext = (unsigned long long)sourceContext;
+        const unsigned int prefixLength = sizeof(hostSourceContext) + 1 + sizeof(functionId);
+        for (unsigned int i = 0; i + prefixLength <= length; i++)
+        {
+            if (memcmp(buffer + i, &hostSourceContext, sizeof(hostSourceContext)) == 0
+                && buffer[i + sizeof(hostSourceContext)] <= 1
+                && memcmp(buffer + i + sizeof(hostSourceContext) + 1, &functionId, sizeof(functionId)) == 0)
+            {
+                return buffer[i + sizeof(hostSourceContext)];
+            }
+        }
+        return -1;
+    }
+
+    // Runs the script defining sum and calls it callCount times from the host, so that it isn't inlined into a caller
+    void RunProfileDataScript(JsSourceContext sourceContext, int callCount)
+    {
+        LPCWSTR script = _u("function sum(a) { var s = 0; for (var i = 0; i < a.length; i++) { s += a[i]; } return s; }");
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef sumId = JS_INVALID_REFERENCE;
+        JsValueRef sum = JS_INVALID_REFERENCE;
+        JsValueRef args[2];
+        int intValue;
+
+        REQUIRE(JsRunScript(script, sourceContext, _u(""), &result) == JsNoError);
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("sum"), &sumId) == JsNoError);
+        REQUIRE(JsGetProperty(global, sumId, &sum) == JsNoError);
+        REQUIRE(JsGetUndefinedValue(&args[0]) == JsNoError);
+        REQUIRE(JsRunScript(_u("[1, 2, 3]"), JS_SOURCE_CONTEXT_NONE, _u(""), &args[1]) == JsNoError);
+
+        for (int i = 0; i < callCount; i++)
+        {
+            REQUIRE(JsCallFunction(sum, args, 2, &result) == JsNoError);
+        }
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 6);
+    }
+
+    void ProfileDataTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const JsSourceContext sourceContext = 0x5EED5EED;
+        const unsigned int sumFunctionId = 1; // the global function is 0
+        const int hotCallCount = 1000;
+        const int coldCallCount = 3;
+        const bool jitEnabled = (attributes & JsRuntimeAttributeDisableNativeCodeGeneration) == 0;
+
+        RunProfileDataScript(sourceContext, hotCallCount);
+
+        JsValueRef profileData = JS_INVALID_REFERENCE;
+        JsErrorCode errorCode = JsSerializeProfileData(&profileData);
+        if (errorCode == JsErrorNotImplemented)
+        {
+            // Engine built without the JIT
+            return;
+        }
+        REQUIRE(errorCode == JsNoError);
+        CHECK(GetProfileIsHot(profileData, sourceContext, sumFunctionId) == (jitEnabled ? 1 : 0));
+
+        BYTE *profileBuffer = nullptr;
+        unsigned int profileLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(profileData, &profileBuffer, &profileLength) == JsNoError);
+        CHECK(profileLength > 0);
+        BYTE *profileCopy = new BYTE[profileLength];
+        memcpy(profileCopy, profileBuffer, profileLength);
+
+        JsRuntimeHandle second = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef secondContext = JS_INVALID_REFERENCE, controlContext = JS_INVALID_REFERENCE, current = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsCreateRuntime(attributes, NULL, &second) == JsNoError);
+        REQUIRE(JsCreateContext(second, &secondContext) == JsNoError);
+        REQUIRE(JsCreateContext(second, &controlContext) == JsNoError);
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+
+        // Without a seed, a few calls leave sum in the interpreter
+        REQUIRE(JsSetCurrentContext(controlContext) == JsNoError);
+        RunProfileDataScript(sourceContext, coldCallCount);
+        REQUIRE(JsSerializeProfileData(&profileData) == JsNoError);
+        CHECK(GetProfileIsHot(profileData, sourceContext, sumFunctionId) == 0);
+
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        // Data that isn't a profile blob is rejected
+        JsValueRef badData = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArrayBuffer(16, &badData) == JsNoError);
+        CHECK(JsSetProfileData(badData) == JsErrorInvalidArgument);
+
+        JsValueRef seededData = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArrayBuffer(profileLength, &seededData) == JsNoError);
+        REQUIRE(JsGetArrayBufferStorage(seededData, &profileBuffer, &profileLength) == JsNoError);
+        memcpy(profileBuffer, profileCopy, profileLength);
+        REQUIRE(JsSetProfileData(seededData) == JsNoError);
+
+        // With the seed, sum picks up the hot profile and goes to full JIT after the same few calls
+        RunProfileDataScript(sourceContext, coldCallCount);
+        REQUIRE(JsSerializeProfileData(&profileData) == JsNoError);
+        CHECK(GetProfileIsHot(profileData, sourceContext, sumFunctionId) == (jitEnabled ? 1 : 0));
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        REQUIRE(JsDisposeRuntime(second) == JsNoError);
+
+        delete[] profileCopy;
+    }
+
+    TEST_CASE("ApiTest_ProfileDataTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ProfileDataTest);
+    }
+
+    void CALLBACK ParseScriptAsyncCompleted(JsParseScriptAsyncTask task, void *callbackState)
+    {
+        *(JsParseScriptAsyncTask *)callbackState = task;
+    }
+
+    void ParseScriptAsyncTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef script = JS_INVALID_REFERENCE;
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        JsValueRef function = JS_INVALID_REFERENCE;
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsParseScriptAsyncTask task = nullptr;
+        JsParseScriptAsyncTask completedTask = nullptr;
+        int intValue;
+
+        const char *source = "function add(a, b) { return a + b; } function unused() { return 0; } add(40, 2);";
+        REQUIRE(JsCreateString(source, strlen(source), &script) == JsNoError);
+        REQUIRE(JsCreateString("async.js", strlen("async.js"), &sourceUrl) == JsNoError);
+        REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+
+        REQUIRE(JsParseScriptAsync(script, JsParseScriptAttributeNone, ParseScriptAsyncCompleted, &completedTask, &task) == JsNoError);
+        REQUIRE(task != nullptr);
+        REQUIRE(JsParseScriptAsyncResult(task, JS_SOURCE_CONTEXT_NONE, sourceUrl, &function) == JsNoError);
+        CHECK(completedTask == task);
+
+        REQUIRE(JsCallFunction(function, &undefined, 1, &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 42);
+
+        // A null source URL doesn't use up the task
+        REQUIRE(JsParseScriptAsync(script, JsParseScriptAttributeNone, ParseScriptAsyncCompleted, &completedTask, &task) == JsNoError);
+        CHECK(JsParseScriptAsyncResult(task, JS_SOURCE_CONTEXT_NONE, nullptr, &function) == JsErrorNullArgument);
+        REQUIRE(JsParseScriptAsyncResult(task, JS_SOURCE_CONTEXT_NONE, sourceUrl, &function) == JsNoError);
+
+        // An ArrayBuffer script is copied, so the host can reuse the buffer right away
+        char sourceBuffer[128];
+        strcpy_s(sourceBuffer, sizeof(sourceBuffer), source);
+        REQUIRE(JsCreateExternalArrayBuffer(sourceBuffer, (unsigned int)strlen(sourceBuffer), nullptr, nullptr, &script) == JsNoError);
+        REQUIRE(JsParseScriptAsync(script, JsParseScriptAttributeNone, ParseScriptAsyncCompleted, &completedTask, &task) == JsNoError);
+        memset(sourceBuffer, ' ', strlen(sourceBuffer));
+        REQUIRE(JsParseScriptAsyncResult(task, JS_SOURCE_CONTEXT_NONE, sourceUrl, &function) == JsNoError);
+        CHECK(completedTask == task);
+
+        REQUIRE(JsCallFunction(function, &undefined, 1, &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 42);
+
+        // A syntax error is reported by JsParseScriptAsyncResult, as JsParse would
+        const char *badSource = "function (";
+        REQUIRE(JsCreateString(badSource, strlen(badSource), &script) == JsNoError);
+        REQUIRE(JsParseScriptAsync(script, JsParseScriptAttributeNone, ParseScriptAsyncCompleted, &completedTask, &task) == JsNoError);
+        CHECK(JsParseScriptAsyncResult(task, JS_SOURCE_CONTEXT_NONE, sourceUrl, &function) == JsErrorScriptCompile);
+
+        bool hasException = false;
+        REQUIRE(JsHasException(&hasException) == JsNoError);
+        CHECK(hasException);
+        REQUIRE(JsGetAndClearException(&result) == JsNoError);
+
+        // Tasks whose result isn't needed are canceled; the runtime is then disposed with no task outstanding
+        REQUIRE(JsCreateString(source, strlen(source), &script) == JsNoError);
+        CHECK(JsParseScriptAsyncCancel(nullptr) == JsErrorNullArgument);
+        for (int i = 0; i < 8; i++)
+        {
+            REQUIRE(JsParseScriptAsync(script, JsParseScriptAttributeNone, ParseScriptAsyncCompleted, &completedTask, &task) == JsNoError);
+            REQUIRE(JsParseScriptAsyncCancel(task) == JsNoError);
+        }
+
+        // The private runtime is reused by later compiles
+        REQUIRE(JsParseScriptAsync(script, JsParseScriptAttributeNone, ParseScriptAsyncCompleted, &completedTask, &task) == JsNoError);
+        REQUIRE(JsParseScriptAsyncResult(task, JS_SOURCE_CONTEXT_NONE, sourceUrl, &function) == JsNoError);
+        REQUIRE(JsCallFunction(function, &undefined, 1, &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 42);
+    }
+
+    TEST_CASE("ApiTest_ParseScriptAsyncTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ParseScriptAsyncTest);
+    }
+
+    TEST_CASE("ApiTest_RedeferralStatsTest", "[ApiTest]")
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef context = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        size_t functionCount = 1;
+        size_t reclaimedBytes = 1;
+        int intValue;
+
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeReclaimColdFunctions, NULL, &runtime) == JsNoError);
+        CHECK(JsGetRuntimeRedeferralStats(runtime, nullptr, &reclaimedBytes) == JsErrorNullArgument);
+        CHECK(JsGetRuntimeRedeferralStats(runtime, &functionCount, nullptr) == JsErrorNullArgument);
+        REQUIRE(JsGetRuntimeRedeferralStats(runtime, &functionCount, &reclaimedBytes) == JsNoError);
+        CHECK(functionCount == 0);
+        CHECK(reclaimedBytes == 0);
+
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        // Only functions that were deferred when the script was parsed can be redeferred, so the script has to be
+        // longer than the deferral threshold (4K characters)
+        const int coldFunctionCount = 100;
+        const size_t sourceCapacity = coldFunctionCount * 96 + 256;
+        char *source = new char[sourceCapacity];
+        size_t sourceLength = 0;
+        for (int i = 0; i < coldFunctionCount; i++)
+        {
+            sourceLength += sprintf_s(source + sourceLength, sourceCapacity - sourceLength,
+                "function cold%d(a, b) { var s = 0; for (var i = a; i < b; i++) { s += i; } return s; }\n", i);
+        }
+        sourceLength += sprintf_s(source + sourceLength, sourceCapacity - sourceLength,
+            "var total = 0; for (var i = 0; i < %d; i++) { total += this['cold' + i](0, 4); } total;", coldFunctionCount);
+
+        JsValueRef script = JS_INVALID_REFERENCE;
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer(source, (unsigned int)sourceLength, nullptr, nullptr, &script) == JsNoError);
+        REQUIRE(JsAddRef(script, nullptr) == JsNoError);
+        REQUIRE(JsCreateString("", 0, &sourceUrl) == JsNoError);
+        REQUIRE(JsRun(script, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == coldFunctionCount * 6);
+
+        // Functions that go unused for ReclaimColdFunctionsGCCount collections are redeferred
+        for (int i = 0; i < 20; i++)
+        {
+            REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        }
+
+        REQUIRE(JsGetRuntimeRedeferralStats(runtime, &functionCount, &reclaimedBytes) == JsNoError);
+        CHECK(functionCount > 0);
+        CHECK(reclaimedBytes > 0);
+
+        // and are reparsed when they are called again
+        REQUIRE(JsRunScript(_u("cold0(0, 5);"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 10);
+
+        REQUIRE(JsRelease(script, nullptr) == JsNoError);
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+        delete[] source;
+    }
+
+    struct SerializedScriptBuffer
+    {
+        BYTE *bytes;
+        unsigned int capacity;
+        unsigned int size;
+        unsigned int writeCount;
+    };
+
+    static bool CHAKRA_CALLBACK SerializedScriptWriteCallback(const unsigned char *data, unsigned int byteCount, void *callbackState)
+    {
+        SerializedScriptBuffer *buffer = (SerializedScriptBuffer *)callbackState;
+        if (byteCount == 0 || byteCount > buffer->capacity - buffer->size)
+        {
+            return false;
+        }
+        memcpy(buffer->bytes + buffer->size, data, byteCount);
+        buffer->size += byteCount;
+        buffer->writeCount++;
+        return true;
+    }
+
+    static bool CHAKRA_CALLBACK SerializedScriptFailingWriteCallback(const unsigned char *data, unsigned int byteCount, void *callbackState)
+    {
+        (*static_cast<unsigned int *>(callbackState))++;
+        return false;
+    }
+
+    static bool CHAKRA_CALLBACK SerializedScriptLoadCallback(JsSourceContext sourceContext, JsValueRef *value, JsParseScriptAttributes *parseAttributes)
+    {
+        *value = (JsValueRef)sourceContext;
+        *parseAttributes = JsParseScriptAttributeNone;
+        return true;
+    }
+
+    TEST_CASE("ApiTest_SerializeWithCallbackTest", "[ApiTest]")
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef context = JS_INVALID_REFERENCE;
+        JsValueRef script = JS_INVALID_REFERENCE;
+        JsValueRef serialized = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int intValue;
+
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeNone, NULL, &runtime) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        // Enough functions for the serialized script to span several parts
+        const int functionCount = 2000;
+        const size_t sourceCapacity = functionCount * 64 + 256;
+        char *source = new char[sourceCapacity];
+        size_t sourceLength = 0;
+        for (int i = 0; i < functionCount; i++)
+        {
+            sourceLength += sprintf_s(source + sourceLength, sourceCapacity - sourceLength, "function f%d(a) { return a + %d; }\n", i, i);
+        }
+        sourceLength += sprintf_s(source + sourceLength, sourceCapacity - sourceLength,
+            "var total = 0; for (var i = 0; i < %d; i++) { total += this['f' + i](1); } total;", functionCount);
+        REQUIRE(JsCreateExternalArrayBuffer(source, (unsigned int)sourceLength, nullptr, nullptr, &script) == JsNoError);
+        REQUIRE(JsAddRef(script, nullptr) == JsNoError);
+
+        REQUIRE(JsSerialize(script, &serialized, JsParseScriptAttributeNone) == JsNoError);
+        BYTE *expected = nullptr;
+        unsigned int expectedSize = 0;
+        REQUIRE(JsGetArrayBufferStorage(serialized, &expected, &expectedSize) == JsNoError);
+
+        SerializedScriptBuffer buffer = { new BYTE[expectedSize], expectedSize, 0, 0 };
+        CHECK(JsSerializeWithCallback(script, nullptr, &buffer, JsParseScriptAttributeNone) == JsErrorNullArgument);
+        // Nothing more is written once the callback fails
+        unsigned int failingWriteCount = 0;
+        CHECK(JsSerializeWithCallback(script, SerializedScriptFailingWriteCallback, &failingWriteCount, JsParseScriptAttributeNone) == JsErrorSerializeCallbackFailed);
+        CHECK(failingWriteCount == 1);
+        REQUIRE(JsSerializeWithCallback(script, SerializedScriptWriteCallback, &buffer, JsParseScriptAttributeNone) == JsNoError);
+        CHECK(buffer.size == expectedSize);
+        CHECK(buffer.writeCount > 1);
+        CHECK(memcmp(buffer.bytes, expected, expectedSize) == 0);
+
+        JsValueRef bufferVal = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer(buffer.bytes, buffer.size, nullptr, nullptr, &bufferVal) == JsNoError);
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString("", 0, &sourceUrl) == JsNoError);
+        REQUIRE(JsRunSerialized(bufferVal, SerializedScriptLoadCallback, (JsSourceContext)script, sourceUrl, &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == functionCount + (functionCount - 1) * functionCount / 2);
+
+        REQUIRE(JsRelease(script, nullptr) == JsNoError);
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+        delete[] buffer.bytes;
+        delete[] source;
+    }
 }
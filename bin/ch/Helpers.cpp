@@ -369,6 +369,7 @@ LPCWSTR Helpers::JsErrorCodeToString(JsErrorCode jsErrorCode)
     case JsErrorInvalidContext:                return _u("JsErrorInvalidContext");
     case JsInvalidModuleHostInfoKind:          return _u("JsInvalidModuleHostInfoKind");
     case JsErrorModuleParsed:                  return _u("JsErrorModuleParsed");
+    case JsErrorSerializeCallbackFailed:       return _u("JsErrorSerializeCallbackFailed");
     // JsErrorCategoryEngine
     case JsErrorCategoryEngine:                return _u("JsErrorCategoryEngine");
     case JsErrorOutOfMemory:                   return _u("JsErrorOutOfMemory");
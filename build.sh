@@ -59,6 +59,9 @@ PRINT_USAGE() {
     echo " -t, --test-build      Test build. Enables test flags on a release build."
     echo "     --target[=S]      Target OS (i.e. android)"
     echo "     --target-path[=S] Output path for compiled binaries. Default: out/"
+    echo "     --threaded-interpreter"
+    echo "                       Dispatch interpreter opcodes through a table of label"
+    echo "                       addresses instead of a switch"
     echo "     --trace           Enables experimental built-in trace."
     echo "     --xcode           Generate XCode project."
     echo "     --without-intl    --icu arg also enables Intl by default. Disable it."
@@ -113,6 +116,7 @@ WB_ANALYZE=
 WB_ARGS=
 TARGET_PATH=0
 VALGRIND=0
+THREADED_INTERPRETER=
 # -DCMAKE_EXPORT_COMPILE_COMMANDS=ON useful for clang-query tool
 CMAKE_EXPORT_COMPILE_COMMANDS="-DCMAKE_EXPORT_COMPILE_COMMANDS=ON"
 LIBS_ONLY_BUILD=
@@ -269,6 +273,10 @@ while [[ $# -gt 0 ]]; do
         STATIC_LIBRARY="-DSTATIC_LIBRARY_SH=1"
         ;;
 
+    --threaded-interpreter)
+        THREADED_INTERPRETER="-DINTERPRETER_THREADED_DISPATCH_SH=1"
+        ;;
+
     --sanitize=*)
         SANITIZE=$1
         SANITIZE=${SANITIZE:11}    # value after --sanitize=
@@ -622,7 +630,7 @@ echo $EXTRA_DEFINES
 cmake $CMAKE_GEN $CC_PREFIX $ICU_PATH $LTO $LTTNG $STATIC_LIBRARY $ARCH $TARGET_OS \
     $ENABLE_CC_XPLAT_TRACE $EXTRA_DEFINES -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $INTL_ICU \
     $WITHOUT_FEATURES $WB_FLAG $WB_ARGS $CMAKE_EXPORT_COMPILE_COMMANDS $LIBS_ONLY_BUILD\
-    $VALGRIND $BUILD_RELATIVE_DIRECTORY
+    $VALGRIND $THREADED_INTERPRETER $BUILD_RELATIVE_DIRECTORY
 
 _RET=$?
 if [[ $? == 0 ]]; then
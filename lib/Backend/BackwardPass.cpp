@@ -4109,7 +4109,7 @@ BackwardPass::UpdateArrayBailOutKind(IR::Instr *const instr)
     Assert(instr->HasBailOutInfo());
 
     if ((instr->m_opcode != Js::OpCode::StElemI_A && instr->m_opcode != Js::OpCode::StElemI_A_Strict &&
-        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset) ||
+        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset && instr->m_opcode != Js::OpCode::Memmap) ||
         !instr->GetDst()->IsIndirOpnd())
     {
         return;
@@ -7652,13 +7652,21 @@ BackwardPass::DoDeadStoreLdStForMemop(IR::Instr *instr)
             SymID base = this->globOpt->GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym());
             SymID index = this->globOpt->GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym());
 
-            FOREACH_MEMCOPY_CANDIDATES(candidate, loop)
+            FOREACH_MEMOP_CANDIDATES(candidate, loop)
             {
-                if (base == candidate->ldBase && index == candidate->index)
+                if (index != candidate->index)
+                {
+                    continue;
+                }
+                if (candidate->IsMemCopy() && base == candidate->AsMemCopy()->ldBase)
                 {
                     return true;
                 }
-            } NEXT_MEMCOPY_CANDIDATE
+                if (candidate->IsMemMap() && (base == candidate->AsMemMap()->ldBase || base == candidate->AsMemMap()->ldBase2))
+                {
+                    return true;
+                }
+            } NEXT_MEMOP_CANDIDATE
         }
     }
     return false;
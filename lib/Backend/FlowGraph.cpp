@@ -1242,6 +1242,12 @@ Loop::MemSetCandidate* Loop::MemOpCandidate::AsMemSet()
     return (Loop::MemSetCandidate*)this;
 }
 
+Loop::MemMapCandidate* Loop::MemOpCandidate::AsMemMap()
+{
+    Assert(this->IsMemMap());
+    return (Loop::MemMapCandidate*)this;
+}
+
 void
 Loop::EnsureMemOpVariablesInitialized()
 {
@@ -624,6 +624,7 @@ class Loop
                                          // For example, in the lowerer, it'll be set to true when we process the loopTop for a certain loop
     struct MemCopyCandidate;
     struct MemSetCandidate;
+    struct MemMapCandidate;
     struct MemOpCandidate
     {
         SymID base;
@@ -633,12 +634,15 @@ class Loop
         enum MemOpType
         {
             MEMSET,
-            MEMCOPY
+            MEMCOPY,
+            MEMMAP
         } type;
         bool IsMemSet() const { return type == MEMSET; }
         bool IsMemCopy() const { return type == MEMCOPY; }
+        bool IsMemMap() const { return type == MEMMAP; }
         struct Loop::MemCopyCandidate* AsMemCopy();
         struct Loop::MemSetCandidate* AsMemSet();
+        struct Loop::MemMapCandidate* AsMemMap();
         MemOpCandidate(MemOpType type) :
             type(type)
         {
@@ -661,6 +665,17 @@ class Loop
         MemCopyCandidate() : MemOpCandidate(MemOpCandidate::MEMCOPY) {}
     };
 
+    // base[index] = ldBase[index] op ldBase2[index], or base[index] = ldBase[index] op (srcSym or constant)
+    struct MemMapCandidate : public MemOpCandidate
+    {
+        SymID ldBase;
+        SymID ldBase2;
+        BailoutConstantValue constant;
+        StackSym* srcSym;
+        StackSym* transferSym;
+        MemMapCandidate() : MemOpCandidate(MemOpCandidate::MEMMAP), ldBase2(Js::Constants::InvalidSymID), srcSym(nullptr) {}
+    };
+
 #define FOREACH_MEMOP_CANDIDATES_EDITING(data, loop, iterator) FOREACH_SLISTCOUNTED_ENTRY_EDITING(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates, iterator)
 #define NEXT_MEMOP_CANDIDATE_EDITING NEXT_SLISTCOUNTED_ENTRY_EDITING
 #define FOREACH_MEMOP_CANDIDATES(data, loop) FOREACH_SLISTCOUNTED_ENTRY(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates)
@@ -798,6 +813,13 @@ struct MemCopyEmitData : public MemOpEmitData
     IR::Instr* ldElemInstr;
 };
 
+struct MemMapEmitData : public MemOpEmitData
+{
+    IR::Instr* opInstr;
+    IR::Instr* ldElemInstr;
+    IR::Instr* ldElemInstr2;
+};
+
 #define FOREACH_BLOCK_IN_FUNC(block, func)\
     FOREACH_BLOCK(block, func->m_fg)
 #define NEXT_BLOCK_IN_FUNC\
@@ -28,7 +28,8 @@
 #if DBG_DUMP
 #define DO_MEMOP_TRACE() (PHASE_TRACE(Js::MemOpPhase, this->func) ||\
         PHASE_TRACE(Js::MemSetPhase, this->func) ||\
-        PHASE_TRACE(Js::MemCopyPhase, this->func))
+        PHASE_TRACE(Js::MemCopyPhase, this->func) ||\
+        PHASE_TRACE(Js::MemMapPhase, this->func))
 #define DO_MEMOP_TRACE_PHASE(phase) (PHASE_TRACE(Js::MemOpPhase, this->func) || PHASE_TRACE(Js::phase ## Phase, this->func))
 
 #define OUTPUT_MEMOP_TRACE(loop, instr, ...) {\
@@ -222,6 +223,7 @@ GlobOpt::Optimize()
         this->ForwardPass();
     }
     this->BackwardPass(Js::DeadStorePhase);
+    this->ScalarReplacementPass();
     this->TailDupPass();
 }
 
@@ -2177,11 +2179,241 @@ bool GlobOpt::CollectMemcopyStElementI(IR::Instr *instr, Loop *loop)
     return true;
 }
 
+bool
+GlobOpt::CollectMemMapInstr(IR::Instr *instr, Loop *loop)
+{
+    if (!loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        // There is no ldElem this operation could use
+        return false;
+    }
+
+    bool isCommutative = false;
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::Add_A:
+    case Js::OpCode::Mul_A:
+        isCommutative = true;
+        // Fall through
+    case Js::OpCode::Sub_A:
+    case Js::OpCode::Div_A:
+        // Only float operations. The result of a var operation depends on the types of the operands.
+        if (instr->GetDst()->GetType() != TyFloat64)
+        {
+            return false;
+        }
+        break;
+
+    case Js::OpCode::Add_I4:
+        isCommutative = true;
+        // Fall through
+    case Js::OpCode::Sub_I4:
+        break;
+
+    default:
+        return false;
+    }
+
+    IR::Opnd *dst = instr->GetDst();
+    IR::Opnd *src1 = instr->GetSrc1();
+    IR::Opnd *src2 = instr->GetSrc2();
+    if (!dst->IsRegOpnd() || !dst->AsRegOpnd()->GetStackSym()->IsSingleDef() || !src2)
+    {
+        return false;
+    }
+
+    // The loads this operation uses are the memcopy candidates that haven't found their stElem
+    Loop::MemCopyCandidate* ldCandidates[2] = { nullptr, nullptr };
+    int ldCandidateCount = 0;
+    FOREACH_MEMOP_CANDIDATES(candidate, loop)
+    {
+        if (!candidate->IsMemCopy() || candidate->base != Js::Constants::InvalidSymID || ldCandidateCount == 2)
+        {
+            break;
+        }
+        ldCandidates[ldCandidateCount++] = candidate->AsMemCopy();
+    }
+    NEXT_MEMOP_CANDIDATE;
+
+    const auto GetLdCandidate = [&](IR::Opnd *opnd) -> Loop::MemCopyCandidate*
+    {
+        if (!opnd->IsRegOpnd())
+        {
+            return nullptr;
+        }
+        SymID symID = GetVarSymID(opnd->AsRegOpnd()->GetStackSym());
+        for (int i = 0; i < ldCandidateCount; i++)
+        {
+            if (GetVarSymID(ldCandidates[i]->transferSym) == symID)
+            {
+                return ldCandidates[i];
+            }
+        }
+        return nullptr;
+    };
+
+    Loop::MemCopyCandidate* ldCandidate = GetLdCandidate(src1);
+    Loop::MemCopyCandidate* ldCandidate2 = GetLdCandidate(src2);
+    IR::Opnd *invariantOpnd = nullptr;
+    if (ldCandidate && ldCandidate2)
+    {
+        if (ldCandidate == ldCandidate2 || ldCandidate->ldBase == ldCandidate2->ldBase)
+        {
+            TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Both operands are loaded from the same array"));
+            return false;
+        }
+    }
+    else if (ldCandidate)
+    {
+        invariantOpnd = src2;
+    }
+    else if (ldCandidate2 && isCommutative)
+    {
+        ldCandidate = ldCandidate2;
+        ldCandidate2 = nullptr;
+        invariantOpnd = src1;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Every pending load has to be used by this operation
+    if (ldCandidateCount != (ldCandidate2 ? 2 : 1))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Operation doesn't use all the pending ldElem"));
+        return false;
+    }
+
+    BailoutConstantValue constant = {TyIllegal, 0};
+    StackSym *srcSym = nullptr;
+    if (invariantOpnd)
+    {
+        if (invariantOpnd->IsRegOpnd())
+        {
+            IR::RegOpnd* opnd = invariantOpnd->AsRegOpnd();
+            if (!this->OptIsInvariant(opnd, this->currentBlock, loop, CurrentBlockData()->FindValue(opnd->m_sym), true, true))
+            {
+                TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Operand is not an invariant"));
+                return false;
+            }
+            srcSym = opnd->GetStackSym();
+        }
+        else if (invariantOpnd->IsFloatConstOpnd())
+        {
+            constant.InitFloatConstValue(invariantOpnd->AsFloatConstOpnd()->m_value);
+        }
+        else if (invariantOpnd->IsIntConstOpnd())
+        {
+            constant.InitIntConstValue(invariantOpnd->AsIntConstOpnd()->GetValue(), invariantOpnd->AsIntConstOpnd()->GetType());
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if (ldCandidate2 && ldCandidate2->bIndexAlreadyChanged != ldCandidate->bIndexAlreadyChanged)
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Index value changed between the ldElem"));
+        return false;
+    }
+
+    Loop::MemMapCandidate* memmapInfo = JitAnewStruct(this->func->GetTopFunc()->m_fg->alloc, Loop::MemMapCandidate);
+    memmapInfo->ldBase = ldCandidate->ldBase;
+    memmapInfo->ldBase2 = ldCandidate2 ? ldCandidate2->ldBase : Js::Constants::InvalidSymID;
+    memmapInfo->constant = constant;
+    memmapInfo->srcSym = srcSym;
+    memmapInfo->transferSym = dst->AsRegOpnd()->GetStackSym();
+    memmapInfo->count = 0;
+    memmapInfo->bIndexAlreadyChanged = ldCandidate->bIndexAlreadyChanged;
+    memmapInfo->base = Js::Constants::InvalidSymID; //need to find the stElem first
+    memmapInfo->index = ldCandidate->index;
+
+    // The loads are now part of this candidate
+    for (int i = 0; i < ldCandidateCount; i++)
+    {
+        loop->memOpInfo->candidates->RemoveHead();
+    }
+    loop->memOpInfo->candidates->Prepend(memmapInfo);
+    return true;
+}
+
+bool GlobOpt::CollectMemMapStElementI(IR::Instr *instr, Loop *loop)
+{
+    if (!loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        // There is no operation matching this stElem
+        return false;
+    }
+
+    Loop::MemOpCandidate* previousCandidate = loop->memOpInfo->candidates->Head();
+    if (!previousCandidate->IsMemMap())
+    {
+        return false;
+    }
+    Loop::MemMapCandidate* memmapInfo = previousCandidate->AsMemMap();
+
+    Assert(instr->GetDst()->IsIndirOpnd());
+    IR::IndirOpnd *dst = instr->GetDst()->AsIndirOpnd();
+    IR::Opnd *indexOp = dst->GetIndexOpnd();
+    IR::RegOpnd *baseOp = dst->GetBaseOpnd()->AsRegOpnd();
+    SymID baseSymID = GetVarSymID(baseOp->GetStackSym());
+
+    if (!instr->GetSrc1()->IsRegOpnd())
+    {
+        return false;
+    }
+    IR::RegOpnd* src1 = instr->GetSrc1()->AsRegOpnd();
+
+    // The previous candidate has to have been created by the operation computing the stored value
+    if (memmapInfo->base != Js::Constants::InvalidSymID ||
+        GetVarSymID(memmapInfo->transferSym) != GetVarSymID(src1->GetStackSym()))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("No matching operation found (s%d)"), baseSymID);
+        return false;
+    }
+
+    if (!src1->GetIsDead())
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Source (s%d) is still alive after StElemI"), baseSymID);
+        return false;
+    }
+
+    if (!IsAllowedForMemOpt(instr, false, baseOp, indexOp))
+    {
+        return false;
+    }
+
+    Assert(indexOp->GetStackSym());
+    SymID inductionSymID = GetVarSymID(indexOp->GetStackSym());
+    Assert(IsSymIDInductionVariable(inductionSymID, loop));
+    bool isIndexPreIncr = loop->memOpInfo->inductionVariableChangeInfoMap->ContainsKey(inductionSymID);
+    if (isIndexPreIncr != memmapInfo->bIndexAlreadyChanged)
+    {
+        // The index changed between the load and the store
+        TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Index value changed between ldElem and stElem"));
+        return false;
+    }
+
+    memmapInfo->count++;
+    memmapInfo->base = baseSymID;
+
+    return true;
+}
+
 bool
 GlobOpt::CollectMemOpLdElementI(IR::Instr *instr, Loop *loop)
 {
     Assert(instr->m_opcode == Js::OpCode::LdElemI_A);
-    return (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyLdElementI(instr, loop));
+    if (PHASE_OFF(Js::MemCopyPhase, this->func) && PHASE_OFF(Js::MemMapPhase, this->func))
+    {
+        return false;
+    }
+
+    // The load starts a memcopy candidate, which the StElemI storing the loaded value completes. With memcopy off, it
+    // is only collected as an operand for CollectMemMapInstr, and ValidateMemOpCandidates rejects it if nothing used it.
+    return CollectMemcopyLdElementI(instr, loop);
 }
 
 bool
@@ -2190,7 +2422,8 @@ GlobOpt::CollectMemOpStElementI(IR::Instr *instr, Loop *loop)
     Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict);
     Assert(instr->GetSrc1());
     return (!PHASE_OFF(Js::MemSetPhase, this->func) && CollectMemsetStElementI(instr, loop)) ||
-        (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyStElementI(instr, loop));
+        (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyStElementI(instr, loop)) ||
+        (!PHASE_OFF(Js::MemMapPhase, this->func) && CollectMemMapStElementI(instr, loop));
 }
 
 bool
@@ -2323,29 +2556,37 @@ GlobOpt::CollectMemOpInfo(IR::Instr *instrBegin, IR::Instr *instr, Value *src1Va
     default:
         FOREACH_INSTR_IN_RANGE(chkInstr, instrBegin->m_next, instr)
         {
+            // An operation on the loaded values whose result is stored by the next StElemI
+            if (chkInstr == instr && !PHASE_OFF(Js::MemMapPhase, this->func) && CollectMemMapInstr(instr, loop))
+            {
+                continue;
+            }
+
             if (IsInstrInvalidForMemOp(chkInstr, loop, src1Val, src2Val))
             {
                 loop->doMemOp = false;
                 return false;
             }
 
-            // Make sure this instruction doesn't use the memcopy transfer sym before it is checked by StElemI
-            if (loop->memOpInfo && !loop->memOpInfo->candidates->Empty())
+            // Make sure this instruction doesn't use a memcopy or memmap transfer sym before it is checked by StElemI
+            if (loop->memOpInfo)
             {
-                Loop::MemOpCandidate* prevCandidate = loop->memOpInfo->candidates->Head();
-                if (prevCandidate->IsMemCopy())
+                FOREACH_MEMOP_CANDIDATES(prevCandidate, loop)
                 {
-                    Loop::MemCopyCandidate* memcopyCandidate = prevCandidate->AsMemCopy();
-                    if (memcopyCandidate->base == Js::Constants::InvalidSymID)
+                    if (prevCandidate->IsMemSet() || prevCandidate->base != Js::Constants::InvalidSymID)
                     {
-                        if (chkInstr->HasSymUse(memcopyCandidate->transferSym))
-                        {
-                            loop->doMemOp = false;
-                            TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, chkInstr, _u("Found illegal use of LdElemI value(s%d)"), GetVarSymID(memcopyCandidate->transferSym));
-                            return false;
-                        }
+                        break;
+                    }
+
+                    StackSym *transferSym = prevCandidate->IsMemCopy() ? prevCandidate->AsMemCopy()->transferSym : prevCandidate->AsMemMap()->transferSym;
+                    if (chkInstr->HasSymUse(transferSym))
+                    {
+                        loop->doMemOp = false;
+                        TRACE_MEMOP_VERBOSE(loop, chkInstr, _u("Found illegal use of LdElemI value(s%d)"), GetVarSymID(transferSym));
+                        return false;
                     }
                 }
+                NEXT_MEMOP_CANDIDATE;
             }
         }
         NEXT_INSTR_IN_RANGE;
@@ -18614,10 +18855,16 @@ void
 GlobOpt::RemoveMemOpSrcInstr(IR::Instr* memopInstr, IR::Instr* srcInstr, BasicBlock* block)
 {
     Assert(srcInstr && (srcInstr->m_opcode == Js::OpCode::LdElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict));
-    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset));
+    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset || memopInstr->m_opcode == Js::OpCode::Memmap));
     Assert(block);
     const bool isDst = srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict;
     IR::RegOpnd* opnd = (isDst ? memopInstr->GetDst() : memopInstr->GetSrc1())->AsIndirOpnd()->GetBaseOpnd();
+    if (!isDst && opnd->m_sym != srcInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->m_sym)
+    {
+        // The second array of a memmap isn't an IndirOpnd of the memop, use the one of the load
+        Assert(memopInstr->m_opcode == Js::OpCode::Memmap);
+        opnd = srcInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd();
+    }
     IR::ArrayRegOpnd* arrayOpnd = opnd->IsArrayRegOpnd() ? opnd->AsArrayRegOpnd() : nullptr;
 
     IR::Instr* topInstr = srcInstr;
@@ -18741,7 +18988,9 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     IR::IndirOpnd* dstOpnd = IR::IndirOpnd::New(baseOpnd, startIndexOpnd, dstType, localFunc);
 
     IR::Opnd *src1;
+    IR::Opnd *src2 = sizeOpnd;
     const bool isMemset = emitData->candidate->IsMemSet();
+    const bool isMemmap = emitData->candidate->IsMemMap();
 
     // Get the source according to the memop type
     if (isMemset)
@@ -18759,6 +19008,82 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
             src1 = IR::AddrOpnd::New(candidate->constant.ToVar(localFunc), IR::AddrOpndKindConstantAddress, localFunc);
         }
     }
+    else if (isMemmap)
+    {
+        MemMapEmitData* data = (MemMapEmitData*)emitData;
+        const Loop::MemMapCandidate* candidate = data->candidate->AsMemMap();
+        Assert(data->ldElemInstr && data->opInstr);
+
+        IR::RegOpnd *srcBaseOpnd = nullptr;
+        IR::RegOpnd *srcIndexOpnd = nullptr;
+        IRType srcType;
+        GetMemOpSrcInfo(loop, data->ldElemInstr, srcBaseOpnd, srcIndexOpnd, srcType);
+        Assert(GetVarSymID(srcIndexOpnd->GetStackSym()) == GetVarSymID(indexOpnd->GetStackSym()));
+        src1 = IR::IndirOpnd::New(srcBaseOpnd, startIndexOpnd, srcType, localFunc);
+
+        // The second operand is the other array, or the value applied to every element
+        IR::Opnd *operandOpnd;
+        if (data->ldElemInstr2)
+        {
+            IR::RegOpnd *src2BaseOpnd = nullptr;
+            IR::RegOpnd *src2IndexOpnd = nullptr;
+            IRType src2Type;
+            GetMemOpSrcInfo(loop, data->ldElemInstr2, src2BaseOpnd, src2IndexOpnd, src2Type);
+            operandOpnd = IR::RegOpnd::New(src2BaseOpnd->m_sym, TyVar, localFunc);
+        }
+        else if (candidate->srcSym)
+        {
+            operandOpnd = IR::RegOpnd::New(candidate->srcSym, candidate->srcSym->GetType(), localFunc);
+        }
+        else
+        {
+            operandOpnd = IR::AddrOpnd::New(candidate->constant.ToVar(localFunc), IR::AddrOpndKindConstantAddress, localFunc);
+        }
+        if (operandOpnd->IsRegOpnd())
+        {
+            operandOpnd->AsRegOpnd()->SetIsJITOptimizedReg(true);
+        }
+
+        Js::JavascriptOperators::MemmapOp op;
+        switch (data->opInstr->m_opcode)
+        {
+        case Js::OpCode::Add_A:
+        case Js::OpCode::Add_I4:
+            op = Js::JavascriptOperators::MemmapOp_Add;
+            break;
+        case Js::OpCode::Sub_A:
+        case Js::OpCode::Sub_I4:
+            op = Js::JavascriptOperators::MemmapOp_Sub;
+            break;
+        case Js::OpCode::Mul_A:
+            op = Js::JavascriptOperators::MemmapOp_Mul;
+            break;
+        default:
+            Assert(data->opInstr->m_opcode == Js::OpCode::Div_A);
+            op = Js::JavascriptOperators::MemmapOp_Div;
+            break;
+        }
+
+        // The size, the operand and the operation are passed as a list of ExtendArg_A:
+        //      s1 = ExtendArg_A size
+        //      s2 = ExtendArg_A operand, s1
+        //      s3 = ExtendArg_A op, s2
+        //      dst[start] = Memmap src1[start], s3
+        IR::Opnd *linkOpnd = nullptr;
+        IR::Opnd *args[] = { sizeOpnd, operandOpnd, IR::IntConstOpnd::New(op, TyInt32, localFunc, true) };
+        for (IR::Opnd *arg : args)
+        {
+            IR::RegOpnd *argOpnd = IR::RegOpnd::New(TyVar, localFunc);
+            IR::Instr *extendArgInstr = IR::Instr::New(Js::OpCode::ExtendArg_A, argOpnd, arg, localFunc);
+            if (linkOpnd)
+            {
+                extendArgInstr->SetSrc2(linkOpnd);
+            }
+            insertBeforeInstr->InsertBefore(extendArgInstr);
+            linkOpnd = argOpnd;
+        }
+        src2 = linkOpnd;
+    }
     else
     {
         Assert(emitData->candidate->IsMemCopy());
@@ -18777,10 +19102,11 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     }
 
     // Generate memcopy
-    IR::Instr* memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
+    Js::OpCode memopOpcode = isMemset ? Js::OpCode::Memset : isMemmap ? Js::OpCode::Memmap : Js::OpCode::Memcopy;
+    IR::Instr* memopInstr = IR::BailOutInstr::New(memopOpcode, bailOutKind, bailOutInfo, localFunc);
     memopInstr->SetDst(dstOpnd);
     memopInstr->SetSrc1(src1);
-    memopInstr->SetSrc2(sizeOpnd);
+    memopInstr->SetSrc2(src2);
     insertBeforeInstr->InsertBefore(memopInstr);
 
 #if DBG_DUMP
@@ -18839,6 +19165,19 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
                               loopCountBuf,
                               bIndexAlreadyChanged);
         }
+        else if (isMemmap)
+        {
+            const Loop::MemMapCandidate* candidate = emitData->candidate->AsMemMap();
+            TRACE_MEMOP_PHASE(MemMap, loop, emitData->stElemInstr,
+                              _u("ValueType: %S, StBase: s%u, Index: s%u, LdBase: s%u, Op: %s, LoopCount: %s, IsIndexChangedBeforeUse: %d"),
+                              valueTypeStr,
+                              candidate->base,
+                              candidate->index,
+                              candidate->ldBase,
+                              Js::OpCodeUtil::GetOpCodeName(((MemMapEmitData*)emitData)->opInstr->m_opcode),
+                              loopCountBuf,
+                              bIndexAlreadyChanged);
+        }
         else
         {
             const Loop::MemCopyCandidate* candidate = emitData->candidate->AsMemCopy();
@@ -18856,7 +19195,17 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
 #endif
 
     RemoveMemOpSrcInstr(memopInstr, emitData->stElemInstr, emitData->block);
-    if (!isMemset)
+    if (isMemmap)
+    {
+        MemMapEmitData* data = (MemMapEmitData*)emitData;
+        this->ConvertToByteCodeUses(data->opInstr);
+        RemoveMemOpSrcInstr(memopInstr, data->ldElemInstr, emitData->block);
+        if (data->ldElemInstr2)
+        {
+            RemoveMemOpSrcInstr(memopInstr, data->ldElemInstr2, emitData->block);
+        }
+    }
+    else if (!isMemset)
     {
         RemoveMemOpSrcInstr(memopInstr, ((MemCopyEmitData*)emitData)->ldElemInstr, emitData->block);
     }
@@ -18946,6 +19295,125 @@ GlobOpt::InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, MemCopyEm
     return false;
 }
 
+bool
+GlobOpt::InspectInstrForMemMapCandidate(Loop* loop, IR::Instr* instr, MemMapEmitData* emitData, bool& errorInInstr)
+{
+    Assert(emitData && emitData->candidate && emitData->candidate->IsMemMap());
+    Loop::MemMapCandidate* candidate = (Loop::MemMapCandidate*)emitData->candidate;
+    if (instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict)
+    {
+        if (
+            !emitData->stElemInstr &&
+            instr->GetDst()->IsIndirOpnd() &&
+            (GetVarSymID(instr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym()) == candidate->base) &&
+            (GetVarSymID(instr->GetDst()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym()) == candidate->index)
+            )
+        {
+            Assert(instr->IsProfiledInstr());
+            emitData->stElemInstr = instr;
+            emitData->bailOutKind = instr->GetBailOutKind();
+            // Still need to find the operation and the LdElem
+            return false;
+        }
+        TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Orphan StElemI_A detected"));
+        errorInInstr = true;
+    }
+    else if (instr->m_opcode == Js::OpCode::LdElemI_A)
+    {
+        SymID ldBase = Js::Constants::InvalidSymID;
+        if (
+            emitData->opInstr &&
+            instr->GetSrc1()->IsIndirOpnd() &&
+            (GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym()) == candidate->index)
+            )
+        {
+            ldBase = GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym());
+        }
+
+        if (ldBase != Js::Constants::InvalidSymID && ldBase == candidate->ldBase && !emitData->ldElemInstr)
+        {
+            emitData->ldElemInstr = instr;
+        }
+        else if (ldBase != Js::Constants::InvalidSymID && ldBase == candidate->ldBase2 && !emitData->ldElemInstr2)
+        {
+            emitData->ldElemInstr2 = instr;
+        }
+        else
+        {
+            TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Orphan LdElemI_A detected"));
+            errorInInstr = true;
+            return false;
+        }
+        Assert(instr->IsProfiledInstr());
+
+        if (!emitData->ldElemInstr || (candidate->ldBase2 != Js::Constants::InvalidSymID && !emitData->ldElemInstr2))
+        {
+            // Still need to find the other LdElem
+            return false;
+        }
+
+        // All the arrays have to be the same kind of typed array, and the operation has to compute in the element type
+        ValueType stValueType = emitData->stElemInstr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+        ValueType ldValueType = emitData->ldElemInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+        if (stValueType != ldValueType ||
+            (emitData->ldElemInstr2 && stValueType != emitData->ldElemInstr2->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetValueType()))
+        {
+#if DBG_DUMP
+            char16 stValueTypeStr[VALUE_TYPE_MAX_STRING_SIZE];
+            stValueType.ToString(stValueTypeStr);
+            char16 ldValueTypeStr[VALUE_TYPE_MAX_STRING_SIZE];
+            ldValueType.ToString(ldValueTypeStr);
+            TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("for mismatch in Load(%s) and Store(%s) value type"), ldValueTypeStr, stValueTypeStr);
+#endif
+            errorInInstr = true;
+            return false;
+        }
+
+        bool isValidOp = false;
+        const Js::OpCode opcode = emitData->opInstr->m_opcode;
+        switch (stValueType.IsTypedIntOrFloatArray() ? stValueType.GetObjectType() : ObjectType::UninitializedObject)
+        {
+        case ObjectType::Int32Array:
+        case ObjectType::Int32VirtualArray:
+        case ObjectType::Int32MixedArray:
+            // The element is the result truncated to int32, which is the wrapped int32 result for add and sub only
+            isValidOp = opcode == Js::OpCode::Add_I4 || opcode == Js::OpCode::Sub_I4;
+            break;
+        case ObjectType::Float32Array:
+        case ObjectType::Float32VirtualArray:
+        case ObjectType::Float32MixedArray:
+        case ObjectType::Float64Array:
+        case ObjectType::Float64VirtualArray:
+        case ObjectType::Float64MixedArray:
+            isValidOp = opcode != Js::OpCode::Add_I4 && opcode != Js::OpCode::Sub_I4;
+            break;
+        }
+        if (!isValidOp)
+        {
+            TRACE_MEMOP_PHASE_VERBOSE(MemMap, loop, instr, _u("Operation not supported for the array type"));
+            errorInInstr = true;
+            return false;
+        }
+
+        // We found all the instructions for this candidate
+        return true;
+    }
+    else if (
+        emitData->stElemInstr &&
+        !emitData->opInstr &&
+        instr->GetDst() &&
+        instr->GetDst()->IsRegOpnd() &&
+        GetVarSymID(instr->GetDst()->AsRegOpnd()->GetStackSym()) == GetVarSymID(candidate->transferSym)
+        )
+    {
+        Assert(instr->m_opcode == Js::OpCode::Add_A || instr->m_opcode == Js::OpCode::Sub_A ||
+            instr->m_opcode == Js::OpCode::Mul_A || instr->m_opcode == Js::OpCode::Div_A ||
+            instr->m_opcode == Js::OpCode::Add_I4 || instr->m_opcode == Js::OpCode::Sub_I4);
+        emitData->opInstr = instr;
+    }
+    return false;
+}
+
 // The caller is responsible to free the memory allocated between inOrderEmitData[iEmitData -> end]
 bool
 GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitData** inOrderEmitData, int& iEmitData)
@@ -18997,13 +19465,38 @@ GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitD
                 Assert(!PHASE_OFF(Js::MemSetPhase, this->func));
                 emitData = JitAnew(this->alloc, MemSetEmitData);
             }
+            else if (candidate->IsMemMap())
+            {
+                Assert(!PHASE_OFF(Js::MemMapPhase, this->func));
+                Loop::MemMapCandidate* memmapCandidate = candidate->AsMemMap();
+
+                if (memmapCandidate->base == Js::Constants::InvalidSymID || memmapCandidate->ldBase == Js::Constants::InvalidSymID)
+                {
+                    TRACE_MEMOP_PHASE(MemMap, loop, nullptr, _u("(s%d): not matching ldElem and stElem"), candidate->base);
+                    return false;
+                }
+
+                // The helper goes through the elements in increasing order
+                if (!inductionVariableChangeInfo.isIncremental)
+                {
+                    TRACE_MEMOP_PHASE(MemMap, loop, nullptr, _u("(s%d): induction variable is decremented"), candidate->base);
+                    return false;
+                }
+                emitData = JitAnew(this->alloc, MemMapEmitData);
+            }
             else
             {
-                Assert(!PHASE_OFF(Js::MemCopyPhase, this->func));
                 // Specific check for memcopy
                 Assert(candidate->IsMemCopy());
                 Loop::MemCopyCandidate* memcopyCandidate = candidate->AsMemCopy();
 
+                if (PHASE_OFF(Js::MemCopyPhase, this->func))
+                {
+                    // A load collected for memmap that no operation used
+                    TRACE_MEMOP_PHASE(MemMap, loop, nullptr, _u("(s%d): ldElem not used by an operation"), memcopyCandidate->ldBase);
+                    return false;
+                }
+
                 if (memcopyCandidate->base == Js::Constants::InvalidSymID
                     || memcopyCandidate->ldBase == Js::Constants::InvalidSymID
                     || (memcopyCandidate->ldCount != memcopyCandidate->count))
@@ -19019,9 +19512,10 @@ GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitD
             emitData->candidate = candidate;
         }
         bool errorInInstr = false;
-        bool candidateFound = candidate->IsMemSet() ?
-            InspectInstrForMemSetCandidate(loop, instr, (MemSetEmitData*)emitData, errorInInstr)
-            : InspectInstrForMemCopyCandidate(loop, instr, (MemCopyEmitData*)emitData, errorInInstr);
+        bool candidateFound =
+            candidate->IsMemSet() ? InspectInstrForMemSetCandidate(loop, instr, (MemSetEmitData*)emitData, errorInInstr) :
+            candidate->IsMemMap() ? InspectInstrForMemMapCandidate(loop, instr, (MemMapEmitData*)emitData, errorInInstr) :
+            InspectInstrForMemCopyCandidate(loop, instr, (MemCopyEmitData*)emitData, errorInInstr);
         if (errorInInstr)
         {
             JitAdelete(this->alloc, emitData);
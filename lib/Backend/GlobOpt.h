@@ -501,6 +501,9 @@ class GlobOpt
     void                    OptLoops(Loop *loop);
     void                    TailDupPass();
     bool                    TryTailDup(IR::BranchInstr *tailBranch);
+    bool                    DoScalarReplacement() const;
+    void                    ScalarReplacementPass();
+    bool                    ScalarReplaceObject(IR::Instr *allocInstr, BasicBlock *block, JitArenaAllocator *alloc, bool apply);
     PRECandidatesList *     FindBackEdgePRECandidates(BasicBlock *block, JitArenaAllocator *alloc);
     PRECandidatesList *     FindPossiblePRECandidates(Loop *loop, JitArenaAllocator *alloc);
     void                    PreloadPRECandidates(Loop *loop, PRECandidatesList *candidates);
@@ -627,6 +630,8 @@ class GlobOpt
     bool                    CollectMemcopyStElementI(IR::Instr *, Loop *);
     bool                    CollectMemOpLdElementI(IR::Instr *, Loop *);
     bool                    CollectMemcopyLdElementI(IR::Instr *, Loop *);
+    bool                    CollectMemMapInstr(IR::Instr *, Loop *);
+    bool                    CollectMemMapStElementI(IR::Instr *, Loop *);
     SymID                   GetVarSymID(StackSym *);
     const InductionVariable* GetInductionVariable(SymID, Loop *);
     bool                    IsSymIDInductionVariable(SymID, Loop *);
@@ -635,6 +640,7 @@ class GlobOpt
     void                    ProcessMemOp();
     bool                    InspectInstrForMemSetCandidate(Loop* loop, IR::Instr* instr, struct MemSetEmitData* emitData, bool& errorInInstr);
     bool                    InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, struct MemCopyEmitData* emitData, bool& errorInInstr);
+    bool                    InspectInstrForMemMapCandidate(Loop* loop, IR::Instr* instr, struct MemMapEmitData* emitData, bool& errorInInstr);
     bool                    ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) struct MemOpEmitData** emitData, int& iEmitData);
     void                    EmitMemop(Loop * loop, LoopCount *loopCount, const struct MemOpEmitData* emitData);
     IR::Opnd*               GenerateInductionVariableChangeForMemOp(Loop *loop, byte unroll, IR::Instr *insertBeforeInstr = nullptr);
@@ -0,0 +1,350 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "Backend.h"
+
+// Scalar replacement of object literals that don't escape.
+//
+// An object literal that is only initialized and read from within the block that creates it, and that no bail out
+// needs to restore, is never observed as an object. The loads of its fields are replaced with the values that were
+// stored into them, and the allocation and the stores are removed. This runs after the dead store pass, once the
+// syms each bail out has to restore are final.
+//
+// Objects that are live at a bail out are left alone. Those that don't escape are still allocated on the stack (see
+// ObjectTemp), and boxed if the bail out happens.
+
+template <typename Fn>
+static void
+ForEachStackSymRef(IR::Opnd * opnd, Fn fn)
+{
+    if (opnd == nullptr)
+    {
+        return;
+    }
+
+    switch (opnd->GetKind())
+    {
+    case IR::OpndKindReg:
+        fn(opnd->AsRegOpnd()->m_sym);
+        break;
+
+    case IR::OpndKindSym:
+    {
+        Sym * sym = opnd->AsSymOpnd()->m_sym;
+        fn(sym->IsPropertySym() ? sym->AsPropertySym()->m_stackSym : sym->AsStackSym());
+        break;
+    }
+
+    case IR::OpndKindIndir:
+        fn(opnd->AsIndirOpnd()->GetBaseOpnd()->m_sym);
+        if (opnd->AsIndirOpnd()->GetIndexOpnd())
+        {
+            fn(opnd->AsIndirOpnd()->GetIndexOpnd()->m_sym);
+        }
+        break;
+
+    case IR::OpndKindList:
+        for (int i = 0; i < opnd->AsListOpnd()->Count(); i++)
+        {
+            fn(opnd->AsListOpnd()->Item(i)->m_sym);
+        }
+        break;
+    }
+}
+
+static bool
+IsScalarReplaceableStore(IR::Instr * instr)
+{
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::InitFld:
+    case Js::OpCode::StFld:
+    case Js::OpCode::StFldStrict:
+        return instr->GetDst()->IsSymOpnd() && instr->GetDst()->AsSymOpnd()->m_sym->IsPropertySym();
+    }
+    return false;
+}
+
+static bool
+IsScalarReplaceableLoad(IR::Instr * instr)
+{
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::LdFld:
+    case Js::OpCode::LdFldForTypeOf:
+        return instr->GetSrc1()->IsSymOpnd() && instr->GetSrc1()->AsSymOpnd()->m_sym->IsPropertySym() &&
+            instr->GetDst()->IsRegOpnd() && instr->GetDst()->GetType() == TyVar;
+    }
+    return false;
+}
+
+static void RejectBailOutSyms(BailOutInfo * bailOutInfo, BVSparse<JitArenaAllocator> * rejectedSyms);
+
+bool
+GlobOpt::DoScalarReplacement() const
+{
+    return
+        !PHASE_OFF(Js::ScalarReplacementPhase, this->func) &&
+        !this->func->IsJitInDebugMode() &&
+        !this->func->HasTry() &&
+        !this->func->GetJITFunctionBody()->IsCoroutine();
+}
+
+void
+GlobOpt::ScalarReplacementPass()
+{
+    if (!DoScalarReplacement())
+    {
+        return;
+    }
+
+    NoRecoverMemoryJitArenaAllocator localAlloc(_u("BE-ScalarReplacement"), this->func->m_alloc->GetPageAllocator(), Js::Throw::OutOfMemory);
+
+    struct Candidate
+    {
+        IR::Instr * allocInstr;
+        BasicBlock * block;
+    };
+    JsUtil::BaseDictionary<SymID, Candidate, JitArenaAllocator> candidates(&localAlloc);
+    BVSparse<JitArenaAllocator> rejectedSyms(&localAlloc);
+    BVSparse<JitArenaAllocator> definedSyms(&localAlloc);
+    BVSparse<JitArenaAllocator> allocatedInBlock(&localAlloc);
+
+    // Find the object literals whose only uses are field stores and loads in the block that creates them, after the
+    // allocation, and that aren't referenced by any bail out.
+    FOREACH_BLOCK_IN_FUNC(block, this->func)
+    {
+        allocatedInBlock.ClearAll();
+
+        FOREACH_INSTR_IN_BLOCK(instr, block)
+        {
+            bool hasBailOut = instr->HasBailOutInfo() || instr->HasAuxBailOut();
+            if (hasBailOut)
+            {
+                RejectBailOutSyms(instr->GetBailOutInfo(), &rejectedSyms);
+            }
+
+            // The object a store or load accesses is the one use of a sym that doesn't make it escape
+            StackSym * storeObjectSym = nullptr;
+            StackSym * loadObjectSym = nullptr;
+            if (!hasBailOut && IsScalarReplaceableStore(instr))
+            {
+                storeObjectSym = instr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym()->m_stackSym;
+            }
+            else if (!hasBailOut && IsScalarReplaceableLoad(instr))
+            {
+                loadObjectSym = instr->GetSrc1()->AsSymOpnd()->m_sym->AsPropertySym()->m_stackSym;
+            }
+
+            auto rejectSrcUse = [&](StackSym * sym)
+            {
+                if (sym != loadObjectSym || !allocatedInBlock.Test(sym->m_id))
+                {
+                    rejectedSyms.Set(sym->m_id);
+                }
+            };
+            ForEachStackSymRef(instr->GetSrc1(), rejectSrcUse);
+            ForEachStackSymRef(instr->GetSrc2(), rejectSrcUse);
+
+            IR::Opnd * dst = instr->GetDst();
+            if (dst == nullptr)
+            {
+                continue;
+            }
+
+            StackSym * dstSym = nullptr;
+            if (dst->IsRegOpnd())
+            {
+                dstSym = dst->AsRegOpnd()->m_sym;
+            }
+            else if (dst->IsSymOpnd() && dst->AsSymOpnd()->m_sym->IsStackSym())
+            {
+                dstSym = dst->AsSymOpnd()->m_sym->AsStackSym();
+            }
+            else
+            {
+                ForEachStackSymRef(dst, [&](StackSym * sym)
+                {
+                    if (sym != storeObjectSym || !allocatedInBlock.Test(sym->m_id))
+                    {
+                        rejectedSyms.Set(sym->m_id);
+                    }
+                });
+                continue;
+            }
+
+            if (definedSyms.TestAndSet(dstSym->m_id))
+            {
+                // Only objects whose sym has a single def
+                rejectedSyms.Set(dstSym->m_id);
+                continue;
+            }
+
+            if (instr->m_opcode == Js::OpCode::NewScObjectLiteral && dst->IsRegOpnd() && !dstSym->IsTypeSpec() && !hasBailOut)
+            {
+                candidates.Add(dstSym->m_id, { instr, block });
+                allocatedInBlock.Set(dstSym->m_id);
+            }
+        } NEXT_INSTR_IN_BLOCK;
+    } NEXT_BLOCK_IN_FUNC;
+
+    candidates.Map([&](SymID symId, Candidate const& candidate)
+    {
+        if (!rejectedSyms.Test(symId) && ScalarReplaceObject(candidate.allocInstr, candidate.block, &localAlloc, false))
+        {
+            ScalarReplaceObject(candidate.allocInstr, candidate.block, &localAlloc, true);
+        }
+    });
+}
+
+// Syms a bail out restores byte code registers from
+static void
+RejectBailOutSyms(BailOutInfo * bailOutInfo, BVSparse<JitArenaAllocator> * rejectedSyms)
+{
+    if (bailOutInfo->byteCodeUpwardExposedUsed)
+    {
+        rejectedSyms->Or(bailOutInfo->byteCodeUpwardExposedUsed);
+    }
+
+    FOREACH_SLISTBASE_ENTRY(CopyPropSyms, copyPropSyms, &bailOutInfo->usedCapturedValues.copyPropSyms)
+    {
+        rejectedSyms->Set(copyPropSyms.Key()->m_id);
+        rejectedSyms->Set(copyPropSyms.Value()->m_id);
+    }
+    NEXT_SLISTBASE_ENTRY;
+
+    if (bailOutInfo->usedCapturedValues.argObjSyms)
+    {
+        rejectedSyms->Or(bailOutInfo->usedCapturedValues.argObjSyms);
+    }
+
+    for (uint i = 0; i < bailOutInfo->stackLiteralBailOutInfoCount; i++)
+    {
+        rejectedSyms->Set(bailOutInfo->stackLiteralBailOutInfo[i].stackSym->m_id);
+    }
+}
+
+bool
+GlobOpt::ScalarReplaceObject(IR::Instr * allocInstr, BasicBlock * block, JitArenaAllocator * alloc, bool apply)
+{
+    struct FieldValue
+    {
+        IR::Opnd * value;
+        bool killed;
+    };
+    typedef JsUtil::BaseDictionary<Js::PropertyId, FieldValue, JitArenaAllocator> FieldValueMap;
+
+    StackSym * objectSym = allocInstr->GetDst()->AsRegOpnd()->m_sym;
+    FieldValueMap fieldValues(alloc);
+    uint storeCount = 0;
+    uint loadCount = 0;
+
+    IR::Instr * instrEnd = block->GetLastInstr()->m_next;
+    IR::Instr * instrNext;
+    for (IR::Instr * instr = allocInstr->m_next; instr != instrEnd; instr = instrNext)
+    {
+        instrNext = instr->m_next;
+
+        if (IsScalarReplaceableStore(instr) && instr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym()->m_stackSym == objectSym)
+        {
+            Js::PropertyId propertyId = instr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym()->m_propertyId;
+            if (instr->m_opcode == Js::OpCode::InitFld)
+            {
+                // Defining a property that has been deleted converts the type handler (see ObjectTemp::IsTempUseOpCodeSym)
+                if (Js::PropertyRecord::DefaultAttributesForPropertyId(propertyId, true) & PropertyDeleted)
+                {
+                    return false;
+                }
+            }
+            else if (!fieldValues.ContainsKey(propertyId))
+            {
+                // A store to a property the literal doesn't have yet could call a setter on the prototype
+                return false;
+            }
+
+            IR::Opnd * value = instr->GetSrc1();
+            if (!(value->IsRegOpnd() && value->GetType() == TyVar && !value->AsRegOpnd()->m_sym->IsTypeSpec()) &&
+                !value->IsAddrOpnd())
+            {
+                return false;
+            }
+
+            storeCount++;
+            if (apply)
+            {
+                FieldValue oldFieldValue;
+                if (fieldValues.TryGetValue(propertyId, &oldFieldValue))
+                {
+                    oldFieldValue.value->Free(this->func);
+                }
+                fieldValues.Item(propertyId, { value->Copy(this->func), false });
+                instr->Remove();
+                continue;
+            }
+            fieldValues.Item(propertyId, { value, false });
+        }
+        else if (IsScalarReplaceableLoad(instr) && instr->GetSrc1()->AsSymOpnd()->m_sym->AsPropertySym()->m_stackSym == objectSym)
+        {
+            // Only properties the literal owns and whose value is still in the stored sym. Anything else would need
+            // a lookup on the prototype.
+            FieldValue fieldValue;
+            if (!fieldValues.TryGetValue(instr->GetSrc1()->AsSymOpnd()->m_sym->AsPropertySym()->m_propertyId, &fieldValue) ||
+                fieldValue.killed)
+            {
+                return false;
+            }
+
+            loadCount++;
+            if (apply)
+            {
+                instr->m_opcode = Js::OpCode::Ld_A;
+                instr->ReplaceSrc1(fieldValue.value->Copy(this->func));
+            }
+        }
+
+        // A value is killed once its sym is redefined
+        IR::Opnd * dst = instr->GetDst();
+        if (dst && dst->IsRegOpnd())
+        {
+            StackSym * dstSym = dst->AsRegOpnd()->m_sym;
+            if (dstSym->IsTypeSpec())
+            {
+                dstSym = dstSym->GetVarEquivSym_NoCreate();
+            }
+
+            fieldValues.MapReference([dstSym](Js::PropertyId, FieldValue & fieldValue)
+            {
+                if (fieldValue.value->IsRegOpnd() && fieldValue.value->AsRegOpnd()->m_sym == dstSym)
+                {
+                    fieldValue.killed = true;
+                }
+            });
+        }
+    }
+
+    if (apply)
+    {
+#if DBG_DUMP
+        if (PHASE_TRACE(Js::ScalarReplacementPhase, this->func))
+        {
+            // Sym ids and counts depend on the rest of the optimizer, so they are only in the verbose trace
+            char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+            Output::Print(_u("ScalarReplacement: function %s (%s): replaced an object literal\n"),
+                this->func->GetJITFunctionBody()->GetDisplayName(),
+                this->func->GetDebugNumberSet(debugStringBuffer));
+            if (PHASE_VERBOSE_TRACE(Js::ScalarReplacementPhase, this->func))
+            {
+                Output::Print(_u("    object s%d, %u stores, %u loads\n"), objectSym->m_id, storeCount, loadCount);
+            }
+            Output::Flush();
+        }
+#endif
+        fieldValues.Map([this](Js::PropertyId, FieldValue const& fieldValue)
+        {
+            fieldValue.value->Free(this->func);
+        });
+        allocInstr->Remove();
+    }
+    return true;
+}
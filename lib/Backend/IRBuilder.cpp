@@ -2319,6 +2319,14 @@ IRBuilder::BuildReg4(Js::OpCode newOpcode, uint32 offset)
         this->DoClosureRegCheck(layout->R3);
     }
 
+    if (newOpcode == Js::OpCode::Ld_A_Pair)
+    {
+        // Ld_A_Pair only saves the interpreter a dispatch; give the JIT back the two Ld_A it was fused from.
+        BuildReg2(Js::OpCode::Ld_A, offset, layout->R0, layout->R1, m_jnReader.GetCurrentOffset());
+        BuildReg2(Js::OpCode::Ld_A, offset, layout->R2, layout->R3, m_jnReader.GetCurrentOffset());
+        return;
+    }
+
     BuildReg4(newOpcode, offset, layout->R0, layout->R1, layout->R2, layout->R3);
 }
 
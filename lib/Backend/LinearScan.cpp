@@ -456,6 +456,11 @@ LinearScan::Init()
     this->instrUseRegs.ClearAll();
     this->secondChanceRegs.ClearAll();
 
+    // Pick the allocation effort for the tier this function is jitted for. Simple JIT code is short-lived so
+    // compile time matters more than the quality of the spill code. Full JIT loop bodies are all about the loop.
+    this->isFastAllocation = this->func->IsSimpleJit() && !PHASE_OFF(Js::FastLinearScanPhase, this->func);
+    this->isLoopSpillCostEnabled = this->func->IsLoopBody() && !this->func->IsSimpleJit() && !PHASE_OFF(Js::LoopSpillCostPhase, this->func);
+
     this->linearScanMD.Init(this);
 
 #if DBG
@@ -3251,7 +3256,7 @@ LinearScan::AllocateStackSpace(Lifetime *spilledRange)
 
     StackSlot * newStackSlot = nullptr;
 
-    if (!PHASE_OFF(Js::StackPackPhase, this->func) && !this->func->IsJitInDebugMode() && !spilledRange->cantStackPack)
+    if (!PHASE_OFF(Js::StackPackPhase, this->func) && !this->isFastAllocation && !this->func->IsJitInDebugMode() && !spilledRange->cantStackPack)
     {
         // Search for a free stack slot to re-use
         FOREACH_SLIST_ENTRY_EDITING(StackSlot *, slot, this->stackSlotsFreeList, iter)
@@ -3760,6 +3765,11 @@ LinearScan::GetSpillCost(Lifetime *lifetime)
             // (it would be nice to be able to check is was in a reg at the top of the loop)...
             useCount += localUseCost;
         }
+
+        if (this->isLoopSpillCostEnabled)
+        {
+            useCount += this->GetOuterLoopBackEdgeSpillCost(lifetime);
+        }
     }
 
     // When comparing 2 lifetimes, we don't really care about the actual length of the lifetimes.
@@ -3816,6 +3826,33 @@ LinearScan::GetSpillCost(Lifetime *lifetime)
     return spillCost;
 }
 
+// GetOuterLoopBackEdgeSpillCost
+// A lifetime in a register live on the back edge of an enclosing loop will need a reload at the bottom
+// of that loop as well if we spill it now.  GetSpillCost only accounts for the current loop.
+uint
+LinearScan::GetOuterLoopBackEdgeSpillCost(Lifetime *lifetime)
+{
+    Assert(lifetime->reg && !lifetime->isSpilled);
+
+    uint cost = 0;
+    if (!this->curLoop || lifetime->sym->IsConst() || !this->liveOnBackEdgeSyms->Test(lifetime->sym->m_id))
+    {
+        return cost;
+    }
+
+    uint outerLoopNest = this->loopNest;
+    for (Loop *loop = this->curLoop->parent; loop && outerLoopNest > 1; loop = loop->parent)
+    {
+        outerLoopNest--;
+        if (loop->regAlloc.liveOnBackEdgeSyms->Test(lifetime->sym->m_id))
+        {
+            cost += LinearScan::GetUseSpillCost(outerLoopNest, false);
+        }
+    }
+
+    return cost;
+}
+
 bool
 LinearScan::RemoveDeadStores(IR::Instr *instr)
 {
@@ -4567,7 +4604,7 @@ void LinearScan::AvoidCompensationConflicts(IR::LabelInstr *labelInstr, IR::Bran
 RegNum
 LinearScan::SecondChanceAllocation(Lifetime *lifetime, bool force)
 {
-    if (PHASE_OFF(Js::SecondChancePhase, this->func) || this->func->HasTry())
+    if (PHASE_OFF(Js::SecondChancePhase, this->func) || this->func->HasTry() || this->isFastAllocation)
     {
         return RegNOREG;
     }
@@ -95,6 +95,8 @@ class LinearScan
     SList<Lifetime *> * stackPackInUseLiveRanges;
     SList<StackSlot *> *stackSlotsFreeList;
     LoweredBasicBlock  *currentBlock;
+    bool                isFastAllocation;       // Simple JIT: skip second chance allocation and stack packing to save compile time
+    bool                isLoopSpillCostEnabled; // Full JIT loop bodies: charge spills for the reloads on every enclosing back edge
 #if DBG
     BitVector           nonAllocatableRegs;
 #endif
@@ -103,7 +105,7 @@ class LinearScan
         linearScanMD(func), opHelperSpilledLiveranges(NULL), currentOpHelperBlock(NULL),
         lastLabel(NULL), numInt32Regs(0), numFloatRegs(0), stackPackInUseLiveRanges(NULL), stackSlotsFreeList(NULL),
         totalOpHelperFullVisitedLength(0), curLoop(NULL), currentBlock(nullptr), currentRegion(nullptr), m_bailOutRecordCount(0),
-        globalBailOutRecordTables(nullptr), lastUpdatedRowIndices(nullptr)
+        globalBailOutRecordTables(nullptr), lastUpdatedRowIndices(nullptr), isFastAllocation(false), isLoopSpillCostEnabled(false)
     {
     }
 
@@ -147,6 +149,7 @@ class LinearScan
     void                KillImplicitRegs(IR::Instr *instr);
     bool                CheckIfInLoop(IR::Instr *instr);
     uint                GetSpillCost(Lifetime * lifetime);
+    uint                GetOuterLoopBackEdgeSpillCost(Lifetime * lifetime);
     bool                RemoveDeadStores(IR::Instr *instr);
 
     // This helper function is used to save bytecode stack sym value to memory / local slots on stack so that we can read it for the locals inspection.
@@ -1551,6 +1551,7 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
 
         case Js::OpCode::Memset:
         case Js::OpCode::Memcopy:
+        case Js::OpCode::Memmap:
         {
             instrPrev = LowerMemOp(instr);
             break;
@@ -9075,10 +9076,75 @@ Lowerer::LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet)
     return nullptr;
 }
 
+/*
+    Lower the Memmap opcode. The size, the second operand and the operation are passed as a list of ExtendArg_A:
+    s1: ExtendArg_A size
+    s2: ExtendArg_A operand, s1
+    s3: ExtendArg_A op, s2
+    dst[start] = Memmap src1[start], s3
+
+    helperRet = CALL OP_Memmap(dstBase, start, src1Base, operand, size, op)
+*/
+IR::Instr *
+Lowerer::LowerMemmap(IR::Instr * instr, IR::RegOpnd * helperRet)
+{
+    IR::Opnd * dst = instr->UnlinkDst();
+    IR::Opnd * src = instr->UnlinkSrc1();
+
+    Assert(dst->IsIndirOpnd());
+    Assert(src->IsIndirOpnd());
+
+    IR::Opnd *dstBaseOpnd = dst->AsIndirOpnd()->UnlinkBaseOpnd();
+    IR::Opnd *dstIndexOpnd = dst->AsIndirOpnd()->UnlinkIndexOpnd();
+    IR::Opnd *srcBaseOpnd = src->AsIndirOpnd()->UnlinkBaseOpnd();
+
+    IR::Opnd *linkOpnd = instr->UnlinkSrc2();
+    Assert(linkOpnd->IsRegOpnd());
+    IR::Instr *opArgInstr = linkOpnd->AsRegOpnd()->m_sym->m_instrDef;
+    Assert(opArgInstr->m_opcode == Js::OpCode::ExtendArg_A);
+    IR::Instr *operandArgInstr = opArgInstr->GetSrc2()->AsRegOpnd()->m_sym->m_instrDef;
+    Assert(operandArgInstr->m_opcode == Js::OpCode::ExtendArg_A);
+    IR::Instr *sizeArgInstr = operandArgInstr->GetSrc2()->AsRegOpnd()->m_sym->m_instrDef;
+    Assert(sizeArgInstr->m_opcode == Js::OpCode::ExtendArg_A);
+    Assert(sizeArgInstr->GetSrc2() == nullptr);
+
+    IR::Opnd *opOpnd = opArgInstr->GetSrc1();
+    IR::Opnd *operandOpnd = operandArgInstr->GetSrc1();
+    IR::Opnd *sizeOpnd = sizeArgInstr->GetSrc1();
+
+    Assert(dstBaseOpnd);
+    Assert(dstIndexOpnd);
+    Assert(srcBaseOpnd);
+    Assert(opOpnd->IsIntConstOpnd());
+
+    IR::Instr *instrPrev = nullptr;
+    if (operandOpnd->IsRegOpnd() && !operandOpnd->IsVar())
+    {
+        IR::RegOpnd* varOpnd = IR::RegOpnd::New(TyVar, instr->m_func);
+        instrPrev = IR::Instr::New(Js::OpCode::ToVar, varOpnd, operandOpnd->Copy(instr->m_func), instr->m_func);
+        instr->InsertBefore(instrPrev);
+        operandOpnd = varOpnd;
+    }
+
+    instr->SetDst(helperRet);
+    m_lowererMD.LoadHelperArgument(instr, opOpnd);
+    m_lowererMD.LoadHelperArgument(instr, sizeOpnd);
+    m_lowererMD.LoadHelperArgument(instr, operandOpnd);
+    m_lowererMD.LoadHelperArgument(instr, srcBaseOpnd);
+    m_lowererMD.LoadHelperArgument(instr, dstIndexOpnd);
+    m_lowererMD.LoadHelperArgument(instr, dstBaseOpnd);
+    m_lowererMD.ChangeToHelperCall(instr, IR::HelperOp_Memmap);
+    dst->Free(m_func);
+    src->Free(m_func);
+    linkOpnd->Free(m_func);
+
+    return instrPrev;
+}
+
 IR::Instr *
 Lowerer::LowerMemOp(IR::Instr * instr)
 {
-    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memmap);
     IR::Instr *instrPrev = instr->m_prev;
 
     IR::RegOpnd* helperRet = IR::RegOpnd::New(TyInt8, instr->m_func);
@@ -9144,6 +9210,10 @@ Lowerer::LowerMemOp(IR::Instr * instr)
     {
         newInstrPrev = LowerMemcopy(instr, helperRet);
     }
+    else if (instr->m_opcode == Js::OpCode::Memmap)
+    {
+        newInstrPrev = LowerMemmap(instr, helperRet);
+    }
 
     if (newInstrPrev != nullptr)
     {
@@ -12304,7 +12374,7 @@ void Lowerer::LowerBailOnInvalidatedArrayHeadSegment(IR::Instr *const instr, con
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memmap);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -12431,7 +12501,7 @@ void Lowerer::LowerBailOnInvalidatedArrayLength(IR::Instr *const instr, const bo
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memmap);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -12518,7 +12588,7 @@ void Lowerer::LowerBailOnCreatedMissingValue(IR::Instr *const instr, const bool
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memmap);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
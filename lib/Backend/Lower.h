@@ -179,6 +179,7 @@ class Lowerer
     IR::Instr *     LowerMemOp(IR::Instr * instr);
     IR::Instr *     LowerMemset(IR::Instr * instr, IR::RegOpnd * helperRet);
     IR::Instr *     LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet);
+    IR::Instr *     LowerMemmap(IR::Instr * instr, IR::RegOpnd * helperRet);
 
     IR::Instr *     LowerWasmMemOp(IR::Instr * instr, IR::Opnd *addrOpnd);
     IR::Instr *     LowerLdArrViewElem(IR::Instr * instr);
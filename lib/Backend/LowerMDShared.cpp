@@ -7005,6 +7005,14 @@ LowererMD::MakeDstEquSrc1(IR::Instr *const instr)
         return;
     }
 
+#ifdef _M_X64
+    if (EncoderMD::HasVexForm(instr) && instr->GetDst()->IsRegOpnd() && instr->GetSrc1()->IsRegOpnd())
+    {
+        // The encoder uses the 3 operand VEX form, no copy of src1 to dst needed
+        return;
+    }
+#endif
+
     if (verify)
     {
         AssertMsg(false, "Missing legalization");
@@ -1609,6 +1609,9 @@ NativeCodeGenerator::CheckCodeGen(Js::ScriptFunction * function)
         entryPoint = defaultEntryPointInfo;
     }
 
+    // If the same function was already full JITed by another runtime, skip simple JIT
+    functionBody->CheckNativeCodeHint();
+
     // If a transition to JIT needs to be forced, JIT right away
     if(Js::Configuration::Global.flags.EnforceExecutionModeLimits &&
         functionBody->GetExecutionMode() != ExecutionMode::SimpleJit &&
@@ -1713,6 +1716,12 @@ NativeCodeGenerator::CheckCodeGenDone(
             entryPointInfo->GetNativeEntrypoint());
         jsMethod = entryPointInfo->jsMethod;
 
+        if (entryPointInfo->GetJitMode() == ExecutionMode::FullJit)
+        {
+            // Let other runtimes in the process that load the same source skip straight to full JIT
+            functionBody->RecordNativeCodeHint();
+        }
+
         Assert(!functionBody->NeedEnsureDynamicProfileInfo() || jsMethod == Js::DynamicProfileInfo::EnsureDynamicProfileInfoThunk || functionBody->GetIsAsmjsMode());
         if (functionBody->GetIsAsmjsMode() && functionBody->NeedEnsureDynamicProfileInfo())
         {
@@ -1774,11 +1783,25 @@ NativeCodeGenerator::PrioritizedButNotYetProcessed(JsUtil::Job *const job)
     ASSERT_THREAD();
     Assert(job);
 
-#ifdef BGJIT_STATS
     CodeGenWorkItem *const codeGenWorkItem = static_cast<CodeGenWorkItem *>(job);
-    if(codeGenWorkItem->Type() == JsFunctionType && codeGenWorkItem->IsInJitQueue())
+    if(!codeGenWorkItem->IsInJitQueue())
+    {
+        return;
+    }
+
+    // The code is needed again before it was jitted. Move it ahead of the less used work items of its tier, and since it's
+    // not stale, away from the end of the full JIT work items that AddToJitQueue drops when there are too many.
+    const uint priority = codeGenWorkItem->GetPriority();
+    if(priority % JitPriorityTierWeight != JitPriorityTierWeight - 1)
+    {
+        codeGenWorkItem->SetPriority(priority + 1);
+    }
+
+    if(codeGenWorkItem->Type() == JsFunctionType)
     {
+#ifdef BGJIT_STATS
         codeGenWorkItem->GetScriptContext()->interpretedCallsHighPri++;
+#endif
 
         if(codeGenWorkItem->GetJitMode() == ExecutionMode::FullJit)
         {
@@ -1789,7 +1812,6 @@ NativeCodeGenerator::PrioritizedButNotYetProcessed(JsUtil::Job *const job)
             }
         }
     }
-#endif
 }
 
 
@@ -3444,9 +3466,30 @@ NativeCodeGenerator::ProfileEnd(Js::ScriptContextProfiler *const profiler, Js::P
 
 #endif
 
+// Work items are processed by tier, loop bodies first, then full JIT and then simple JIT, and the hotter ones first within a
+// tier. The job processor raises the priority of work items as they wait, so the lower tiers still get their turn.
+uint NativeCodeGenerator::GetJitPriority(CodeGenWorkItem *const codeGenWorkItem)
+{
+    uint tier;
+    uint hotness;
+    if(codeGenWorkItem->Type() == JsLoopBodyWorkItemType)
+    {
+        tier = 2;
+        hotness = static_cast<JsLoopBodyCodeGen *>(codeGenWorkItem)->loopHeader->interpretCount;
+    }
+    else
+    {
+        tier = codeGenWorkItem->GetJitMode() == ExecutionMode::FullJit ? 1 : 0;
+        hotness = codeGenWorkItem->GetFunctionBody()->GetInterpretedCount();
+    }
+
+    return tier * JitPriorityTierWeight + min(Math::Log2(hotness), JitPriorityTierWeight - 1);
+}
+
 void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function)
 {
     codeGenWorkItem->VerifyJitMode();
+    codeGenWorkItem->SetPriority(GetJitPriority(codeGenWorkItem));
 
     Js::CodeGenRecyclableData* recyclableData = GatherCodeGenData(codeGenWorkItem->GetFunctionBody(), codeGenWorkItem->GetFunctionBody(), codeGenWorkItem->GetEntryPoint(), codeGenWorkItem, function);
     codeGenWorkItem->SetRecyclableData(recyclableData);
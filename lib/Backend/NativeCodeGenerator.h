@@ -79,6 +79,7 @@ void SetProfileMode(BOOL fSet);
     virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override;
     virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
     JsUtil::Job *GetJobToProcessProactively();
+    static uint GetJitPriority(CodeGenWorkItem *const codeGenWorkItem);
     void AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function = nullptr);
     void RemoveProactiveJobs();
     void UpdateJITState();
@@ -86,6 +87,9 @@ void SetProfileMode(BOOL fSet);
     static void LogCodeGenDone(CodeGenWorkItem * workItem, LARGE_INTEGER * start_time);
     typedef SListCounted<ObjTypeSpecFldInfo*, ArenaAllocator> ObjTypeSpecFldInfoList;
 
+    // Number of priority levels within each tier of queued work items, see GetJitPriority
+    static const uint JitPriorityTierWeight = 32;
+
     template<bool IsInlinee> void GatherCodeGenData(
         Recycler *const recycler,
         Js::FunctionBody *const topFunctionBody,
@@ -240,6 +240,9 @@ Peeps::PeepFunc()
 #if defined(_M_IX86) || defined(_M_X64)
                instr = this->PeepRedundant(instr);
 #endif
+#if defined(_M_X64)
+                this->peepsMD.PeepVex(instr);
+#endif
 
                 IR::Opnd *dst = instr->GetDst();
 
@@ -607,6 +607,11 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
         return 0;
     }
 
+    if (EncoderMD::HasVexForm(instr))
+    {
+        return this->EncodeVex(instr);
+    }
+
     const BYTE *form = EncoderMD::GetFormTemplate(instr);
     const BYTE *opcodeTemplate = EncoderMD::GetOpbyte(instr);
     const uint32 leadIn = EncoderMD::GetLeadIn(instr);
@@ -1430,6 +1435,89 @@ EncoderMD::EmitRexByte(BYTE * prexByte, BYTE rexByte, bool skipRexByte, bool res
     *prexByte = rexByte;
 }
 
+///----------------------------------------------------------------------------
+///
+/// EncoderMD::EncodeVex
+///
+///     Emit the non-destructive VEX form of an SSE instr: dst = src1 op src2,
+///     with src1 in VEX.vvvv. Only the 128-bit forms are used.
+///
+///----------------------------------------------------------------------------
+
+ptrdiff_t
+EncoderMD::EncodeVex(IR::Instr *instr)
+{
+    IR::RegOpnd *dst = instr->GetDst()->AsRegOpnd();
+    IR::RegOpnd *src1 = instr->GetSrc1()->AsRegOpnd();
+    IR::Opnd *src2 = instr->GetSrc2();
+    const uint32 opdope = EncoderMD::GetOpdope(instr);
+
+    AssertMsg(EncoderMD::GetInstrForm(instr) == FORM_MODRM, "Only MODRM instrs have a VEX form");
+    AssertMsg(EncoderMD::GetLeadIn(instr) == OLB_0F, "Only the 0F opcode map is supported for VEX");
+    AssertMsg(src2, "VEX instrs need 3 operands");
+
+    BYTE *instrStart = m_pc;
+
+    // The VEX prefix replaces the mandatory prefix, the REX byte and the 0F escape.
+    // Reserve the 3 byte form; EmitVexPrefix compacts it if possible.
+    BYTE *pvexPrefix = m_pc;
+    m_pc += 3;
+
+    *(m_pc++) = *EncoderMD::GetOpbyte(instr);
+
+    BYTE rexByte = this->GetRexByte(this->REXR, dst);
+    rexByte |= this->EmitModRM(instr, src2, this->GetRegEncode(dst));
+
+    this->EmitVexPrefix(pvexPrefix, rexByte, opdope, src1);
+
+    AssertMsg(m_pc - instrStart <= MachMaxInstrSize, "MachMaxInstrSize not set correctly");
+    return m_pc - instrStart;
+}
+
+void
+EncoderMD::EmitVexPrefix(BYTE * pvexPrefix, BYTE rexByte, uint32 opdope, IR::RegOpnd * src1)
+{
+    // The R, X, B and vvvv fields are stored inverted. W and L are always 0.
+    const RegNum src1Reg = src1->GetReg();
+    const BYTE vvvv = (BYTE)(this->GetRegEncode(src1Reg) | (this->IsExtendedRegister(src1Reg) ? 0x8 : 0));
+    const BYTE pp = (opdope & D66) ? 0x1 : (opdope & DF3) ? 0x2 : (opdope & DF2) ? 0x3 : 0x0;
+    const BYTE vexByte = (BYTE)(((~vvvv & 0xF) << 3) | pp);
+    const BYTE notR = (rexByte & REXR) ? 0 : 0x80;
+
+    if ((rexByte & (REXX | REXB)) == 0)
+    {
+        // The 2 byte form implies the 0F map and has room for R only. Move the rest of the instr down by 1.
+        Assert(m_pc > pvexPrefix + 3);
+        BYTE* current = pvexPrefix + 2;
+        while (current < m_pc - 1)
+        {
+            *current = *(current + 1);
+            current++;
+        }
+
+        if (m_relocList != nullptr && m_relocList->Count() > 0)
+        {
+            // if a reloc record was added as part of encoding this instruction - fix the pc in the reloc
+            EncodeRelocAndLabels &lastRelocEntry = m_relocList->Item(m_relocList->Count() - 1);
+            if (lastRelocEntry.m_ptr > pvexPrefix && lastRelocEntry.m_ptr < m_pc)
+            {
+                Assert(lastRelocEntry.m_type != RelocTypeLabel);
+                lastRelocEntry.m_ptr = (BYTE*)lastRelocEntry.m_ptr - 1;
+                lastRelocEntry.m_origPtr = (BYTE*)lastRelocEntry.m_origPtr - 1;
+            }
+        }
+        m_pc--;
+
+        pvexPrefix[0] = 0xC5;
+        pvexPrefix[1] = notR | vexByte;
+        return;
+    }
+
+    pvexPrefix[0] = 0xC4;
+    pvexPrefix[1] = (BYTE)(notR | ((rexByte & REXX) ? 0 : 0x40) | ((rexByte & REXB) ? 0 : 0x20) | 0x1 /* 0F map */);
+    pvexPrefix[2] = vexByte;
+}
+
 bool
 EncoderMD::IsExtendedRegister(RegNum reg)
 {
@@ -1976,7 +2064,13 @@ bool EncoderMD::UsesConditionCode(IR::Instr *instr)
 
 bool EncoderMD::IsOPEQ(IR::Instr *instr)
 {
-    return instr->IsLowered() && (EncoderMD::GetOpdope(instr) & DOPEQ);
+    return instr->IsLowered() && (EncoderMD::GetOpdope(instr) & DOPEQ) && !EncoderMD::HasVexForm(instr);
+}
+
+// Whether the instr is encoded in its non-destructive VEX form, which doesn't need dst to be src1
+bool EncoderMD::HasVexForm(IR::Instr *instr)
+{
+    return instr->IsLowered() && (EncoderMD::GetOpdope(instr) & DVEX) && AutoSystemInfo::Data.AVXAvailable();
 }
 
 bool EncoderMD::IsSHIFT(IR::Instr *instr)
@@ -189,6 +189,7 @@ class EncoderMD
     static bool     SetsConditionCode(IR::Instr *instr);
     static bool     UsesConditionCode(IR::Instr *instr);
     static bool     IsOPEQ(IR::Instr *instr);
+    static bool     HasVexForm(IR::Instr *instr);
     static bool     IsSHIFT(IR::Instr *instr);
     static bool     IsMOVEncoding(IR::Instr *instr);
     RelocList*      GetRelocList() const { return m_relocList; }
@@ -223,6 +224,8 @@ class EncoderMD
     int             GetOpndSize(IR::Opnd * opnd);
 
     void            EmitRexByte(BYTE * prexByte, BYTE rexByte, bool skipRexByte, bool reservedRexByte);
+    ptrdiff_t       EncodeVex(IR::Instr *instr);
+    void            EmitVexPrefix(BYTE * pvexPrefix, BYTE rexByte, uint32 opdope, IR::RegOpnd * src1);
 
     enum
     {
@@ -18,18 +18,18 @@
 //     /          /                      /         /          /              /                         /
 MACRO(ADD,      Reg2,   OpSideEffect,  R000,   f(BINOP),   o(ADD),     DOPEQ|DSETCC|DCOMMOP,        OLB_NONE)
 
-MACRO(ADDPD,    Reg2,   None,          RNON,   f(MODRM),   o(ADDPD),   DNO16|DOPEQ|D66|DCOMMOP,     OLB_0F)
-MACRO(ADDPS,    Reg2,   None,          RNON,   f(MODRM),   o(ADDPS),   DNO16|DOPEQ|DCOMMOP,         OLB_0F)
+MACRO(ADDPD,    Reg2,   None,          RNON,   f(MODRM),   o(ADDPD),   DNO16|DOPEQ|DVEX|D66|DCOMMOP, OLB_0F)
+MACRO(ADDPS,    Reg2,   None,          RNON,   f(MODRM),   o(ADDPS),   DNO16|DOPEQ|DVEX|DCOMMOP,    OLB_0F)
 
-MACRO(ADDSD,    Reg2,   None,          RNON,   f(MODRM),   o(ADDSD),   DNO16|DOPEQ|DCOMMOP|DF2,     OLB_0F)
-MACRO(ADDSS,    Reg2,   None,          RNON,   f(MODRM),   o(ADDSS),   DNO16|DOPEQ|DF3|DCOMMOP,     OLB_0F)
+MACRO(ADDSD,    Reg2,   None,          RNON,   f(MODRM),   o(ADDSD),   DNO16|DOPEQ|DVEX|DCOMMOP|DF2, OLB_0F)
+MACRO(ADDSS,    Reg2,   None,          RNON,   f(MODRM),   o(ADDSS),   DNO16|DOPEQ|DVEX|DF3|DCOMMOP, OLB_0F)
 MACRO(AND,      Reg2,   OpSideEffect,  R100,   f(BINOP),   o(AND),     DOPEQ|DSETCC|DCOMMOP,        OLB_NONE)
 
 MACRO(ANDNPD,   Reg2,   None,          RNON,   f(MODRM),   o(ANDNPD),  DNO16|DOPEQ|D66,             OLB_NONE)
-MACRO(ANDNPS,   Reg2,   None,          RNON,   f(MODRM),   o(ANDNPS),  DNO16|DOPEQ,                 OLB_0F)
+MACRO(ANDNPS,   Reg2,   None,          RNON,   f(MODRM),   o(ANDNPS),  DNO16|DOPEQ|DVEX,            OLB_0F)
 
-MACRO(ANDPD,    Reg2,   None,          RNON,   f(MODRM),   o(ANDPD),   DNO16|DOPEQ|D66|DCOMMOP,     OLB_0F)
-MACRO(ANDPS,    Reg2,   None,          RNON,   f(MODRM),   o(ANDPS),   DNO16|DOPEQ|DCOMMOP,         OLB_0F)
+MACRO(ANDPD,    Reg2,   None,          RNON,   f(MODRM),   o(ANDPD),   DNO16|DOPEQ|DVEX|D66|DCOMMOP, OLB_0F)
+MACRO(ANDPS,    Reg2,   None,          RNON,   f(MODRM),   o(ANDPS),   DNO16|DOPEQ|DVEX|DCOMMOP,    OLB_0F)
 MACRO(BSF,      Reg2,   None,          RNON,   f(MODRM),   o(BSF),     DDST|DSETCC,                 OLB_0F)
 MACRO(BSR,      Reg2,   None,          RNON,   f(MODRM),   o(BSR),     DDST|DSETCC,                 OLB_0F)
 MACRO(BT,       Reg2,   OpSideEffect,  R100,   f(SPMOD),   o(BT),      DSETCC,                      OLB_0F)
@@ -90,11 +90,11 @@ MACRO(CVTTSS2SI,Reg2,   None,          RNON,   f(MODRM),   o(CVTTSS2SI),DDST|DNO
 MACRO(DEC,      Reg2,   OpSideEffect,  R001,   f(INCDEC),  o(DEC),     DOPEQ|DSETCC,                OLB_NONE)
 MACRO(DIV,      Reg3,   None,          R110,   f(MULDIV),  o(DIV),     DSETCC,                      OLB_NONE)
 
-MACRO(DIVPD,    Reg3,   None,          RNON,   f(MODRM),   o(DIVPD),   DNO16|DOPEQ|D66,            OLB_0F)
-MACRO(DIVPS,    Reg3,   None,          RNON,   f(MODRM),   o(DIVPS),   DNO16|DOPEQ,                OLB_0F)
+MACRO(DIVPD,    Reg3,   None,          RNON,   f(MODRM),   o(DIVPD),   DNO16|DOPEQ|DVEX|D66,       OLB_0F)
+MACRO(DIVPS,    Reg3,   None,          RNON,   f(MODRM),   o(DIVPS),   DNO16|DOPEQ|DVEX,           OLB_0F)
 
-MACRO(DIVSD,    Reg3,   None,          RNON,   f(MODRM),   o(DIVSD),   DNO16|DOPEQ|DF2,             OLB_0F)
-MACRO(DIVSS,    Reg3,   None,          RNON,   f(MODRM),   o(DIVSS),   DNO16|DOPEQ|DF3,             OLB_0F)
+MACRO(DIVSD,    Reg3,   None,          RNON,   f(MODRM),   o(DIVSD),   DNO16|DOPEQ|DVEX|DF2,        OLB_0F)
+MACRO(DIVSS,    Reg3,   None,          RNON,   f(MODRM),   o(DIVSS),   DNO16|DOPEQ|DVEX|DF3,        OLB_0F)
 MACRO(IDIV,     Reg3,   None,          R111,   f(MULDIV),  o(IDIV),    DSETCC,                      OLB_NONE)
 MACRO(INC,      Reg2,   OpSideEffect,  R000,   f(INCDEC),  o(INC),     DOPEQ|DSETCC,                OLB_NONE)
 MACRO(IMUL,     Reg3,   OpSideEffect,  R101,   f(MULDIV),  o(IMUL),    DSETCC,                      OLB_NONE)
@@ -119,10 +119,10 @@ MACRO(JSB,      BrReg2, OpSideEffect,  RNON,   f(JCC),     o(JSB),     DUSECC|DN
 MACRO(JMP,      Br,     OpSideEffect,  R100,   f(JMP),     o(JMP),     DNO16,                       OLB_NONE)
 MACRO(LEA,      Reg2,   None,          RNON,   f(MODRM),   o(LEA),     DDST,                        OLB_NONE)
 
-MACRO(MAXPD,    Reg2,       None,           RNON,   f(MODRM),   o(MAXPD),   DNO16|DOPEQ|D66,        OLB_0F)
-MACRO(MAXPS,    Reg2,       None,           RNON,   f(MODRM),   o(MAXPS),   DNO16|DOPEQ,            OLB_0F)
-MACRO(MINPD,    Reg2,       None,           RNON,   f(MODRM),   o(MINPD),   DNO16|DOPEQ|D66,        OLB_0F)
-MACRO(MINPS,    Reg2,       None,           RNON,   f(MODRM),   o(MINPS),   DNO16|DOPEQ,            OLB_0F)
+MACRO(MAXPD,    Reg2,       None,           RNON,   f(MODRM),   o(MAXPD),   DNO16|DOPEQ|DVEX|D66,   OLB_0F)
+MACRO(MAXPS,    Reg2,       None,           RNON,   f(MODRM),   o(MAXPS),   DNO16|DOPEQ|DVEX,       OLB_0F)
+MACRO(MINPD,    Reg2,       None,           RNON,   f(MODRM),   o(MINPD),   DNO16|DOPEQ|DVEX|D66,   OLB_0F)
+MACRO(MINPS,    Reg2,       None,           RNON,   f(MODRM),   o(MINPS),   DNO16|DOPEQ|DVEX,       OLB_0F)
 
 MACRO(LZCNT,    Reg2,   None,          RNON,   f(MODRM),   o(LZCNT),   DF3|DSETCC|DDST,             OLB_0F)
 
@@ -154,11 +154,11 @@ MACRO(MOVZX,    Reg2,   None,          RNON,   f(MODRM),   o(MOVZX),   DDST,
 MACRO(MOVZXW,   Reg2,   None,          RNON,   f(MODRM),   o(MOVZXW),  DDST,                        OLB_0F)
 MACRO(MOVSXD,   Reg2,   None,          RNON,   f(MODRM),   o(MOVSXD),  DDST,                        OLB_NONE)
 
-MACRO(MULPD,    Reg3,       None,           RNON,   f(MODRM),   o(MULPD),   DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
-MACRO(MULPS,    Reg3,       None,           RNON,   f(MODRM),   o(MULPS),   DNO16|DOPEQ|DCOMMOP, OLB_0F)
+MACRO(MULPD,    Reg3,       None,           RNON,   f(MODRM),   o(MULPD),   DNO16|DOPEQ|DVEX|D66|DCOMMOP, OLB_0F)
+MACRO(MULPS,    Reg3,       None,           RNON,   f(MODRM),   o(MULPS),   DNO16|DOPEQ|DVEX|DCOMMOP, OLB_0F)
 
-MACRO(MULSD,    Reg3,   None,          RNON,   f(MODRM),   o(MULSD),   DNO16|DOPEQ|DF2,             OLB_0F)
-MACRO(MULSS,    Reg3,   None,          RNON,   f(MODRM),   o(MULSS),   DNO16|DOPEQ|DF3|DCOMMOP,     OLB_0F)
+MACRO(MULSD,    Reg3,   None,          RNON,   f(MODRM),   o(MULSD),   DNO16|DOPEQ|DVEX|DF2,        OLB_0F)
+MACRO(MULSS,    Reg3,   None,          RNON,   f(MODRM),   o(MULSS),   DNO16|DOPEQ|DVEX|DF3|DCOMMOP, OLB_0F)
 MACRO(NEG,      Reg2,   OpSideEffect,  R011,   f(MODRMW),  o(NEG),     DOPEQ|DSETCC,                OLB_NONE)
 MACRO(NOP,      Empty,  None,          RNON,   f(SPECIAL), o(NOP),     DNO16,                       OLB_NONE)
 MACRO(NOT,      Reg2,   OpSideEffect,  R010,   f(MODRMW),  o(NOT),     DOPEQ,                       OLB_NONE)
@@ -166,17 +166,17 @@ MACRO(POP,      Reg1,   OpSideEffect,  R000,   f(PSHPOP),  o(POP),     DDST,
 MACRO(PUSH,     Reg1,   OpSideEffect,  R110,   f(PSHPOP),  o(PUSH),    0,                           OLB_NONE)
 MACRO(OR ,      Reg2,   OpSideEffect,  R001,   f(BINOP),   o(OR),      DOPEQ|DSETCC|DCOMMOP,        OLB_NONE)
 
-MACRO(ORPS,     Reg2,   None,           R001,   f(MODRM),   o(ORPS),    DOPEQ|DOPEQ|DCOMMOP,        OLB_0F)
+MACRO(ORPS,     Reg2,   None,           R001,   f(MODRM),   o(ORPS),    DOPEQ|DVEX|DCOMMOP,         OLB_0F)
 MACRO(PADDB,    Reg2,   None,           RNON,   f(MODRM),   o(PADDB),   DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
-MACRO(PADDD,    Reg2,   None,           RNON,   f(MODRM),   o(PADDD),   DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
-MACRO(PADDQ,    Reg2,   None,           RNON,   f(MODRM),   o(PADDQ),   DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
-MACRO(PADDW,    Reg2,   None,           RNON,   f(MODRM),   o(PADDW),   DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
+MACRO(PADDD,    Reg2,   None,           RNON,   f(MODRM),   o(PADDD),   DNO16|DOPEQ|DVEX|D66|DCOMMOP, OLB_0F)
+MACRO(PADDQ,    Reg2,   None,           RNON,   f(MODRM),   o(PADDQ),   DNO16|DOPEQ|DVEX|D66|DCOMMOP, OLB_0F)
+MACRO(PADDW,    Reg2,   None,           RNON,   f(MODRM),   o(PADDW),   DNO16|DOPEQ|DVEX|D66|DCOMMOP, OLB_0F)
 MACRO(PADDSB,   Reg2,   None,           RNON,   f(MODRM),   o(PADDSB),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(PADDSW,   Reg2,   None,           RNON,   f(MODRM),   o(PADDSW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(PADDUSW,  Reg2,   None,           RNON,   f(MODRM),   o(PADDUSW), DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(PADDUSB,  Reg2,   None,           RNON,   f(MODRM),   o(PADDUSB), DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
-MACRO(PAND,     Reg2,   None,           RNON,   f(MODRM),   o(PAND),    DNO16|DOPEQ|D66,            OLB_0F)
-MACRO(PANDN,    Reg2,   None,           RNON,   f(MODRM),   o(PANDN),   DNO16|DOPEQ|D66,            OLB_0F)
+MACRO(PAND,     Reg2,   None,           RNON,   f(MODRM),   o(PAND),    DNO16|DOPEQ|DVEX|D66,       OLB_0F)
+MACRO(PANDN,    Reg2,   None,           RNON,   f(MODRM),   o(PANDN),   DNO16|DOPEQ|DVEX|D66,       OLB_0F)
 MACRO(PCMPEQB,  Reg2,   None,           RNON,   f(MODRM),   o(PCMPEQB), DNO16|DOPEQ|D66,            OLB_0F)
 MACRO(PCMPEQD,  Reg2,   None,           RNON,   f(MODRM),   o(PCMPEQD), DNO16|DOPEQ|D66,            OLB_0F)
 MACRO(PCMPEQW,  Reg2,   None,           RNON,   f(MODRM),   o(PCMPEQW), DNO16|DOPEQ|D66,            OLB_0F)
@@ -190,7 +190,7 @@ MACRO(PMINUB,   Reg2,   None,           RNON,   f(MODRM),   o(PMINUB),  DNO16|DO
 
 MACRO(PMULLW,   Reg2,   None,           RNON,   f(MODRM),   o(PMULLW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(PMULUDQ,  Reg2,   None,           RNON,   f(MODRM),   o(PMULUDQ), DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
-MACRO(POR,      Reg2,   None,           RNON,   f(MODRM),   o(POR),     DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
+MACRO(POR,      Reg2,   None,           RNON,   f(MODRM),   o(POR),     DNO16|DOPEQ|DVEX|D66|DCOMMOP, OLB_0F)
 MACRO(PSHUFD,   Reg3,   None,           RNON,   f(MODRM),   o(PSHUFD),  DDST|DNO16|D66|DSSE,        OLB_0F)
 
 MACRO(PEXTRW,   Reg3,   None,           RNON,   f(MODRM),   o(PEXTRW),  DDST|DNO16|D66|DSSE,        OLB_0F)
@@ -209,9 +209,9 @@ MACRO(PSRLD,    Reg2,   None,           R010,   f(SPECIAL), o(PSRLD),   DNO16|DO
 MACRO(PSRLQ,    Reg2,   None,           RNON,   f(MODRM),   o(PSRLQ),   DNO16|DOPEQ|D66|DSSE,  OLB_0F)
 
 MACRO(PSUBB,    Reg2,   None,           RNON,   f(MODRM),   o(PSUBB),   DNO16|DOPEQ|D66,            OLB_0F)
-MACRO(PSUBD,    Reg2,   None,           RNON,   f(MODRM),   o(PSUBD),   DNO16|DOPEQ|D66,            OLB_0F)
-MACRO(PSUBQ,    Reg2,   None,           RNON,   f(MODRM),   o(PSUBQ),   DNO16|DOPEQ|D66,            OLB_0F)
-MACRO(PSUBW,    Reg2,   None,           RNON,   f(MODRM),   o(PSUBW),   DNO16|DOPEQ|D66,            OLB_0F)
+MACRO(PSUBD,    Reg2,   None,           RNON,   f(MODRM),   o(PSUBD),   DNO16|DOPEQ|DVEX|D66,       OLB_0F)
+MACRO(PSUBQ,    Reg2,   None,           RNON,   f(MODRM),   o(PSUBQ),   DNO16|DOPEQ|DVEX|D66,       OLB_0F)
+MACRO(PSUBW,    Reg2,   None,           RNON,   f(MODRM),   o(PSUBW),   DNO16|DOPEQ|DVEX|D66,       OLB_0F)
 MACRO(PSUBSB,   Reg2,   None,           RNON,   f(MODRM),   o(PSUBSB),  DNO16|DOPEQ|D66,            OLB_0F)
 MACRO(PSUBSW,   Reg2,   None,           RNON,   f(MODRM),   o(PSUBSW),  DNO16|DOPEQ|D66,            OLB_0F)
 MACRO(PSUBUSB,  Reg2,   None,           RNON,   f(MODRM),   o(PSUBUSB), DNO16|DOPEQ|D66,            OLB_0F)
@@ -219,7 +219,7 @@ MACRO(PSUBUSW,  Reg2,   None,           RNON,   f(MODRM),   o(PSUBUSW), DNO16|DO
 MACRO(PUNPCKLBW, Reg2,  None,           RNON,   f(MODRM),   o(PUNPCKLBW), DNO16|DOPEQ|D66,          OLB_0F)
 MACRO(PUNPCKLDQ, Reg2,  None,           RNON,   f(MODRM),   o(PUNPCKLDQ), DNO16|DOPEQ|D66,          OLB_0F)
 MACRO(PUNPCKLWD, Reg2,  None,           RNON,   f(MODRM),   o(PUNPCKLWD), DNO16|DOPEQ|D66,          OLB_0F)
-MACRO(PXOR,     Reg2,   None,           RNON,   f(MODRM),   o(PXOR),    DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
+MACRO(PXOR,     Reg2,   None,           RNON,   f(MODRM),   o(PXOR),    DNO16|DOPEQ|DVEX|D66|DCOMMOP, OLB_0F)
 
 MACRO(RET,      Empty,  OpSideEffect,  RNON,   f(SPECIAL), o(RET),     DSETCC,                      OLB_NONE)
 MACRO(ROL,      Reg2,   None /* XXX */,R000,   f(SHIFT),   o(ROL),     DOPEQ | DSETCC,              OLB_NONE)
@@ -252,11 +252,11 @@ MACRO(SQRTSD,   Reg2,   None,          RNON,   f(MODRM),   o(SQRTSD),  DDST|DNO1
 MACRO(SQRTSS,   Reg2,   None,          RNON,   f(MODRM),   o(SQRTSS),  DDST|DNO16|DF3,              OLB_0F)
 MACRO(SUB,      Reg2,   OpSideEffect,  R101,   f(BINOP),   o(SUB),     DOPEQ|DSETCC,                OLB_NONE)
 
-MACRO(SUBPD,    Reg3,   None,           RNON,   f(MODRM),   o(SUBPD),   DNO16|DOPEQ|D66,            OLB_0F)
-MACRO(SUBPS,    Reg3,   None,           RNON,   f(MODRM),   o(SUBPS),   DNO16|DOPEQ,                OLB_0F)
+MACRO(SUBPD,    Reg3,   None,           RNON,   f(MODRM),   o(SUBPD),   DNO16|DOPEQ|DVEX|D66,       OLB_0F)
+MACRO(SUBPS,    Reg3,   None,           RNON,   f(MODRM),   o(SUBPS),   DNO16|DOPEQ|DVEX,           OLB_0F)
 
-MACRO(SUBSD,    Reg3,   None,          RNON,   f(MODRM),   o(SUBSD),   DNO16|DOPEQ|DF2,             OLB_0F)
-MACRO(SUBSS,    Reg3,   None,          RNON,   f(MODRM),   o(SUBSS),   DNO16|DOPEQ|DF3,             OLB_0F)
+MACRO(SUBSD,    Reg3,   None,          RNON,   f(MODRM),   o(SUBSD),   DNO16|DOPEQ|DVEX|DF2,        OLB_0F)
+MACRO(SUBSS,    Reg3,   None,          RNON,   f(MODRM),   o(SUBSS),   DNO16|DOPEQ|DVEX|DF3,        OLB_0F)
 MACRO(TEST,     Empty,  OpSideEffect,  R000,   f(TEST),    o(TEST),    DSETCC|DCOMMOP,              OLB_NONE)
 
 MACRO(TZCNT,    Reg2,   None,          RNON,   f(MODRM),   o(TZCNT),   DF3|DSETCC|DDST,             OLB_0F)
@@ -265,7 +265,7 @@ MACRO(UCOMISD,  Empty,  None,          RNON,   f(MODRM),   o(UCOMISD), DNO16|D66
 MACRO(UCOMISS,  Empty,  None,          RNON,   f(MODRM),   o(UCOMISS), DNO16|DSETCC,                OLB_0F)
 MACRO(XCHG,     Reg2,   None,          R000,   f(XCHG),    o(XCHG),    DOPEQ,                       OLB_NONE)
 MACRO(XOR,      Reg2,   OpSideEffect,  R110,   f(BINOP),   o(XOR),     DOPEQ|DSETCC|DCOMMOP,        OLB_NONE)
-MACRO(XORPS,    Reg3,   None,          RNON,   f(MODRM),   o(XORPS),   DNO16|DOPEQ|DCOMMOP,         OLB_0F)
+MACRO(XORPS,    Reg3,   None,          RNON,   f(MODRM),   o(XORPS),   DNO16|DOPEQ|DVEX|DCOMMOP,    OLB_0F)
 MACRO(PINSRW,   Reg2,   None,          RNON,   f(MODRM),   o(PINSRW),  DDST|DNO16|DSSE|D66,         OLB_0F)
 MACRO(PINSRD,   Reg3,   None,          RNON,   f(MODRM),   o(PINSRD),  DDST|DNO16|DSSE|D66,        OLB_0F3A)
 MACRO(PINSRQ,   Reg3,   None,          RNON,   f(MODRM),   o(PINSRQ),  DDST|DNO16|D66|DREXSRC|DSSE,OLB_0F3A)
@@ -112,4 +112,44 @@ PeepsMD::PeepAssign(IR::Instr *instr)
     }
 }
 
+// PeepsMD::PeepVex
+// With AVX, fold a register copy into the non-destructive VEX form of the op that consumes it:
+//     MOVAPS xmm1, xmm2
+//     ADDPS  xmm1, xmm1, xmm3     ==>     ADDPS xmm1, xmm2, xmm3
+void
+PeepsMD::PeepVex(IR::Instr *instr)
+{
+    if (!EncoderMD::HasVexForm(instr))
+    {
+        return;
+    }
+
+    IR::Opnd *dst = instr->GetDst();
+    IR::Opnd *src1 = instr->GetSrc1();
+    IR::Opnd *src2 = instr->GetSrc2();
+    if (!dst->IsRegOpnd() || !src1->IsRegOpnd() || dst->AsRegOpnd()->GetReg() != src1->AsRegOpnd()->GetReg())
+    {
+        return;
+    }
+    RegNum reg = dst->AsRegOpnd()->GetReg();
 
+    IR::Instr *instrPrev = instr->GetPrevRealInstrOrLabel();
+    if (instrPrev->m_opcode != Js::OpCode::MOVAPS
+        || !instrPrev->GetDst()->IsRegOpnd()
+        || instrPrev->GetDst()->AsRegOpnd()->GetReg() != reg
+        || !instrPrev->GetSrc1()->IsRegOpnd())
+    {
+        return;
+    }
+
+    // src2 still reads the copy
+    if (src2->IsRegOpnd() && src2->AsRegOpnd()->GetReg() == reg)
+    {
+        return;
+    }
+
+    IR::Opnd *copySrc = instrPrev->UnlinkSrc1();
+    copySrc->SetType(src1->GetType());
+    instr->ReplaceSrc1(copySrc);
+    instrPrev->Remove();
+}
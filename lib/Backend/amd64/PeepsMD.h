@@ -17,6 +17,7 @@ class PeepsMD
     void        Init(Peeps *peeps);
     void        ProcessImplicitRegs(IR::Instr *instr);
     void        PeepAssign(IR::Instr *instr);
+    void        PeepVex(IR::Instr *instr);
 };
 
 
@@ -43,6 +43,7 @@
 #define D66     0x100000 // 0x66 0x0F style WNI form (usually 128-bit DP FP)
 #define DF2     0x200000 /* 0xF2 0x0F style WNI form (usually 64-bit DP FP) */
 #define DREXSRC  0x400000 /* Use src1's size to generate REX byte */
+#define DVEX    0x800000 /* has a non-destructive 3 operand VEX form (AVX) */
 
 // 2nd 3 bits is options
 #define SBIT 0x20
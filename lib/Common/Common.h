@@ -125,6 +125,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 #include "Core/StackBackTrace.h"
 
 #include "Common/Event.h"
+#include "Common/JobQueuePolicy.h"
 #include "Common/Jobs.h"
 
 #include "Common/vtregistry.h" // Depends on SimpleHashTable.h
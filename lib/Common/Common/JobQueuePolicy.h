@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JsUtil
+{
+    // -------------------------------------------------------------------------------------------------------------------------
+    // JobQueuePolicy
+    //
+    // Decides which queued job the background job processor starts next. It only sees the jobs through TJobTraits, so that it
+    // can be tested without a job processor (see bin/NativeTests/JobQueuePolicyTest.cpp). TJobTraits provides:
+    //     static TJob *Next(TJob *job);
+    //     static bool MustGoFirst(TJob *job);                          // critical, or a thread is waiting for it
+    //     static unsigned int GetPriority(TJob *job);
+    //     static unsigned int GetAddedStamp(TJob *job);                // jobs started before this one was queued
+    //     static unsigned int GetManagerLastStartedStamp(TJob *job);   // jobs started when its manager last had one started
+    //
+    // Jobs that must go first do, in queue order. Otherwise, managers take turns: the next job comes from the manager that
+    // least recently had a job started, so that a manager with a lot of jobs (such as a busy script context) doesn't hold up the
+    // others. Among that manager's jobs, the one with the highest priority goes first. Jobs gain a priority level for every
+    // agingPeriod jobs started ahead of them, so that low priority jobs are not starved. Ties go to the job closest to the
+    // front of the queue.
+    // -------------------------------------------------------------------------------------------------------------------------
+    template<class TJob, class TJobTraits>
+    class JobQueuePolicy
+    {
+    public:
+        static TJob *SelectJobToProcess(
+            TJob *const head,
+            const unsigned int numJobsStarted,
+            const bool takeTurns,
+            const unsigned int agingPeriod)
+        {
+            TJob *jobToProcess = nullptr;
+            unsigned int jobToProcessIdleCount = 0;
+            unsigned int jobToProcessPriority = 0;
+            for(TJob *job = head; job; job = TJobTraits::Next(job))
+            {
+                if(TJobTraits::MustGoFirst(job))
+                {
+                    return job;
+                }
+
+                const unsigned int idleCount = takeTurns ? numJobsStarted - TJobTraits::GetManagerLastStartedStamp(job) : 0;
+                if(jobToProcess && idleCount < jobToProcessIdleCount)
+                {
+                    continue;
+                }
+
+                const unsigned int priority = GetAgedPriority(job, numJobsStarted, agingPeriod);
+                if(!jobToProcess || idleCount > jobToProcessIdleCount || priority > jobToProcessPriority)
+                {
+                    jobToProcess = job;
+                    jobToProcessIdleCount = idleCount;
+                    jobToProcessPriority = priority;
+                }
+            }
+            return jobToProcess;
+        }
+
+        static unsigned int GetAgedPriority(TJob *const job, const unsigned int numJobsStarted, const unsigned int agingPeriod)
+        {
+            const unsigned int waitCount = numJobsStarted - TJobTraits::GetAddedStamp(job);
+            return TJobTraits::GetPriority(job) + (agingPeriod == 0 ? 0 : waitCount / agingPeriod);
+        }
+    };
+}
@@ -35,14 +35,14 @@ namespace JsUtil
     // Job
     // -------------------------------------------------------------------------------------------------------------------------
 
-    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical)
+    Job::Job(const bool isCritical) : manager(0), priority(0), addedStamp(0), isCritical(isCritical)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
     {
     }
 
-    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical)
+    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), priority(0), addedStamp(0), isCritical(isCritical)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
@@ -60,18 +60,28 @@ namespace JsUtil
         return isCritical;
     }
 
+    unsigned int Job::GetPriority() const
+    {
+        return priority;
+    }
+
+    void Job::SetPriority(const unsigned int priority)
+    {
+        this->priority = priority;
+    }
+
     // -------------------------------------------------------------------------------------------------------------------------
     // JobManager
     // -------------------------------------------------------------------------------------------------------------------------
 
     JobManager::JobManager(JobProcessor *const processor)
-        : processor(processor), numJobsAddedToProcessor(0), isWaitable(false)
+        : processor(processor), numJobsAddedToProcessor(0), lastJobStartedStamp(0), isWaitable(false)
     {
         Assert(processor);
     }
 
     JobManager::JobManager(JobProcessor *const processor, const bool isWaitable)
-        : processor(processor), numJobsAddedToProcessor(0), isWaitable(isWaitable)
+        : processor(processor), numJobsAddedToProcessor(0), lastJobStartedStamp(0), isWaitable(isWaitable)
     {
         Assert(processor);
     }
@@ -612,6 +622,7 @@ namespace JsUtil
         jobReady(true),
         wakeAllBackgroundThreads(false),
         numJobs(0),
+        numJobsStarted(0),
         threadId(GetCurrentThreadContextId()),
         threadService(threadService),
         threadCount(0),
@@ -979,6 +990,7 @@ namespace JsUtil
             Js::Throw::OutOfMemory(); // Overflow: job counts we use are int32's.
         ++numJobs;
 
+        job->addedStamp = numJobsStarted;
         __super::AddJob(job, prioritize);
         IndicateNewJob();
     }
@@ -998,6 +1010,39 @@ namespace JsUtil
         return __super::RemoveJob(job);
     }
 
+    bool BackgroundJobProcessor::IsWaitedUpon(Job *const job)
+    {
+        // This function is called from inside the lock
+
+        JobManager *const manager = job->Manager();
+        if(!manager->isWaitable)
+        {
+            return false;
+        }
+
+        WaitableJobManager *const waitableManager = static_cast<WaitableJobManager *>(manager);
+        return waitableManager->jobBeingWaitedUpon == job || waitableManager->isWaitingForQueuedJobs;
+    }
+
+    Job *BackgroundJobProcessor::UnlinkJobToProcess()
+    {
+        // This function is called from inside the lock
+
+        Job *const jobToProcess =
+            JobQueuePolicy<Job, JobQueueTraits>::SelectJobToProcess(
+                jobs.Head(),
+                numJobsStarted,
+                CONFIG_FLAG(FairJobQueue),
+                CONFIG_FLAG(JobQueueAgingPeriod));
+
+        if(jobToProcess)
+        {
+            jobs.Unlink(jobToProcess);
+            jobToProcess->Manager()->lastJobStartedStamp = ++numJobsStarted;
+        }
+        return jobToProcess;
+    }
+
     bool BackgroundJobProcessor::Process(Job *const job, ParallelThreadData *threadData)
     {
         try
@@ -1063,7 +1108,7 @@ namespace JsUtil
             criticalSection.Enter();
             while (!IsClosed() || (jobs.Head() && jobs.Head()->IsCritical()))
             {
-                Job *job = jobs.UnlinkFromBeginning();
+                Job *job = UnlinkJobToProcess();
 
                 if(!job)
                 {
@@ -35,9 +35,20 @@ namespace JsUtil
         friend SingleJobManager;
         friend WaitableSingleJobManager;
 
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+        friend BackgroundJobProcessor;
+#endif
+
     private:
         JobManager *manager;
 
+        // Jobs with a higher priority are processed first by the background job processor. The job manager sets it, and may
+        // change it from inside the lock while the job is queued.
+        unsigned int priority;
+
+        // The background job processor's count of started jobs when the job was queued, used to age the job's priority
+        unsigned int addedStamp;
+
         // Jobs may be aborted if the job processor is closed while there are still queued jobs, or if a job manager is removed
         // while it still has jobs queued to the job processor. Critical jobs are not aborted and rather processed during the
         // JobProcessor::Close call. Aborted jobs are not processed and instead the job manager is notified with
@@ -65,6 +76,8 @@ namespace JsUtil
     public:
         JobManager *Manager() const;
         bool IsCritical() const;
+        unsigned int GetPriority() const;
+        void SetPriority(const unsigned int priority);
     };
 
     // -------------------------------------------------------------------------------------------------------------------------
@@ -87,6 +100,9 @@ namespace JsUtil
         JobProcessor *const processor;
         unsigned int numJobsAddedToProcessor;
 
+        // The background job processor's count of started jobs when it last started one of this manager's jobs
+        unsigned int lastJobStartedStamp;
+
         // Only job managers derived from WaitableJobManager support waiting for a job or the job manager's queued jobs
         const bool isWaitable;
 
@@ -455,6 +471,7 @@ namespace JsUtil
         Event jobReady;                 //This is an auto reset event, only one thread wakes up when the event is signaled.
         Event wakeAllBackgroundThreads; //This is a manual reset event.
         unsigned int numJobs;
+        unsigned int numJobsStarted;
         ThreadContextId threadId;
         ThreadService *threadService;
 
@@ -489,6 +506,17 @@ namespace JsUtil
         bool AreAllThreadsWaitingForJobs();
         uint NumberOfThreadsWaitingForJobs ();
         Job* GetCurrentJobOfManager(JobManager *const manager);
+        Job *UnlinkJobToProcess();
+        static bool IsWaitedUpon(Job *const job);
+
+        struct JobQueueTraits
+        {
+            static Job *Next(Job *const job) { return job->Next(); }
+            static bool MustGoFirst(Job *const job) { return job->IsCritical() || IsWaitedUpon(job); }
+            static unsigned int GetPriority(Job *const job) { return job->GetPriority(); }
+            static unsigned int GetAddedStamp(Job *const job) { return job->addedStamp; }
+            static unsigned int GetManagerLastStartedStamp(Job *const job) { return job->Manager()->lastJobStartedStamp; }
+        };
         ParallelThreadData * GetThreadDataFromCurrentJob(Job* job);
 
         void InitializeThreadCount();
@@ -173,7 +173,7 @@
 
 #ifndef ENABLE_VALGRIND
 #define ENABLE_CONCURRENT_GC 1
-#ifdef _WIN32
+#if defined(_WIN32) || (defined(__linux__) && defined(_M_X64))
 #define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 1 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
 #else
 #define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 0 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
@@ -191,8 +191,12 @@
 #endif
 #else
 #define SYSINFO_IMAGE_BASE_AVAILABLE 0
+#if defined(_M_X64)
+#define SUPPORT_WIN32_SLIST 1                       // xplat SLIST APIs are implemented in CommonPal.h
+#else
 #define SUPPORT_WIN32_SLIST 0
 #endif
+#endif
 
 #ifdef CHAKRACORE_LITE
 #define USE_VPM_TABLE 0
@@ -278,10 +282,9 @@
 #endif
 #endif
 
-// Only enable background parser in debug build.
-#ifdef DBG
+// Background parsing is built in whenever the JIT is, but is off by default in every build. It is turned on
+// with -ParallelParseIIFE, or with -on:ParallelParse where debug config options are enabled.
 #define ENABLE_BACKGROUND_PARSING 1
-#endif
 
 #if ENABLE_DEBUG_CONFIG_OPTIONS
 #define ALLOW_JIT_REPRO
@@ -295,7 +298,8 @@
 #endif
 
 // ToDo (SaAgarwa): Disable VirtualTypedArray on ARM64 till we make sure it works correctly
-#if defined(_WIN32) && defined(TARGET_64) && !defined(_M_ARM64)
+// xplat: only Linux x64 has the SIGSEGV based recovery (see JavascriptFunction::AccessViolationFilter)
+#if (defined(_WIN32) || defined(__linux__)) && defined(TARGET_64) && !defined(_M_ARM64)
 #define ENABLE_FAST_ARRAYBUFFER 1
 #endif
 #endif
@@ -102,6 +102,7 @@
 #define INIT_PRIORITY(x)
 
 #define get_cpuid __cpuid
+#define get_xcr0() _xgetbv(0)
 
 #if defined(__clang__)
 __forceinline void  __int2c()
@@ -153,6 +154,14 @@ inline int get_cpuid(int cpuInfo[4], int function_id)
             reinterpret_cast<unsigned int*>(&cpuInfo[2]),
             reinterpret_cast<unsigned int*>(&cpuInfo[3]));
 }
+
+// Only valid when CPUID reports OSXSAVE
+inline unsigned long long get_xcr0()
+{
+    unsigned int eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+}
 #elif defined(_ARM_)
 inline int get_cpuid(int cpuInfo[4], int function_id)
 {
@@ -397,9 +406,114 @@ typedef union _SLIST_HEADER {
 
 #endif
 
+#if defined(_AMD64_) || defined(_X86_) || defined(_ARM_)
+// xplat: There is no portable double-width compare-exchange, so the SLIST_HEADER is
+// reinterpreted as a list head guarded by a spin lock. The lock is only held for
+// a couple of stores, so contention between the allocating thread and the
+// background sweep/zero page threads stays negligible.
+struct XplatSListHeader
+{
+    volatile SHORT lock;
+    USHORT depth;
+    PSLIST_ENTRY next;
+};
+static_assert(sizeof(XplatSListHeader) <= sizeof(SLIST_HEADER), "XplatSListHeader must fit in SLIST_HEADER");
+
+inline XplatSListHeader * AcquireXplatSListHeader(PSLIST_HEADER ListHead)
+{
+    XplatSListHeader * header = reinterpret_cast<XplatSListHeader *>(ListHead);
+    while (__sync_lock_test_and_set(&header->lock, 1))
+    {
+        while (header->lock)
+        {
+            YieldProcessor();
+        }
+    }
+    return header;
+}
+
+inline void ReleaseXplatSListHeader(XplatSListHeader * header)
+{
+    __sync_lock_release(&header->lock);
+}
+
+inline VOID InitializeSListHead(IN OUT PSLIST_HEADER ListHead)
+{
+    memset(ListHead, 0, sizeof(SLIST_HEADER));
+}
+
+inline PSLIST_ENTRY InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY ListEntry)
+{
+    XplatSListHeader * header = AcquireXplatSListHeader(ListHead);
+    PSLIST_ENTRY first = header->next;
+    ListEntry->Next = first;
+    header->next = ListEntry;
+    header->depth++;
+    ReleaseXplatSListHeader(header);
+    return first;
+}
+
+inline PSLIST_ENTRY InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead)
+{
+    XplatSListHeader * header = AcquireXplatSListHeader(ListHead);
+    PSLIST_ENTRY first = header->next;
+    if (first != nullptr)
+    {
+        header->next = first->Next;
+        header->depth--;
+    }
+    ReleaseXplatSListHeader(header);
+    return first;
+}
+
+inline PSLIST_ENTRY InterlockedFlushSList(IN OUT PSLIST_HEADER ListHead)
+{
+    XplatSListHeader * header = AcquireXplatSListHeader(ListHead);
+    PSLIST_ENTRY first = header->next;
+    header->next = nullptr;
+    header->depth = 0;
+    ReleaseXplatSListHeader(header);
+    return first;
+}
+
+inline USHORT QueryDepthSList(IN PSLIST_HEADER ListHead)
+{
+    // Like on Windows, the depth wraps around after 65535 entries
+    return reinterpret_cast<XplatSListHeader volatile *>(ListHead)->depth;
+}
+#else
 PALIMPORT VOID PALAPI InitializeSListHead(IN OUT PSLIST_HEADER ListHead);
 PALIMPORT PSLIST_ENTRY PALAPI InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY  ListEntry);
 PALIMPORT PSLIST_ENTRY PALAPI InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead);
+PALIMPORT PSLIST_ENTRY PALAPI InterlockedFlushSList(IN OUT PSLIST_HEADER ListHead);
+PALIMPORT USHORT PALAPI QueryDepthSList(IN PSLIST_HEADER ListHead);
+#endif
+
+// Blocks from _aligned_malloc keep a pointer to the underlying malloc block just before the
+// aligned address. alignment must be a power of 2.
+inline void * _aligned_malloc(size_t size, size_t alignment)
+{
+    if (size > SIZE_MAX - alignment - sizeof(void *))
+    {
+        return nullptr;
+    }
+    void * block = malloc(size + alignment + sizeof(void *));
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    uintptr_t aligned = ((uintptr_t)block + sizeof(void *) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    ((void **)aligned)[-1] = block;
+    return (void *)aligned;
+}
+
+inline void _aligned_free(void * memblock)
+{
+    if (memblock != nullptr)
+    {
+        free(((void **)memblock)[-1]);
+    }
+}
 
 
 template <class T>
@@ -20,6 +20,7 @@ PHASE(All)
         PHASE(ScanAhead)
         PHASE(ParallelParse)
         PHASE(EarlyReferenceErrors)
+        PHASE(ParserArena)
     PHASE(ByteCode)
         PHASE(CachedScope)
         PHASE(StackFunc)
@@ -31,6 +32,7 @@ PHASE(All)
             PHASE(VariableIntEncoding)
         PHASE(NativeCodeSerialization)
         PHASE(OptimizeBlockScope)
+        PHASE(SuperInstructions)
     PHASE(Delay)
         PHASE(Speculation)
         PHASE(GatherCodeGenData)
@@ -184,6 +186,7 @@ PHASE(All)
                 PHASE(MemOp)
                     PHASE(MemSet)
                     PHASE(MemCopy)
+                    PHASE(MemMap)
                 PHASE(IncrementalBailout)
             PHASE(DeadStore)
                 PHASE(ReverseCopyProp)
@@ -191,6 +194,7 @@ PHASE(All)
                     PHASE(MarkTempNumber)
                     PHASE(MarkTempObject)
                     PHASE(MarkTempNumberOnTempObject)
+            PHASE(ScalarReplacement)
         PHASE(DumpGlobOptInstr) // Print the Globopt instr string in post lower dumps
         PHASE(Lowerer)
             PHASE(FastPath)
@@ -230,6 +234,8 @@ PHASE(All)
                 PHASE(RegionUseCount)
                 PHASE(RegHoistLoads)
                 PHASE(ClearRegLoopExit)
+                PHASE(FastLinearScan)
+                PHASE(LoopSpillCost)
         PHASE(Peeps)
         PHASE(Layout)
         PHASE(EHBailoutPatchUp)
@@ -292,6 +298,7 @@ PHASE(All)
                     PHASE(SweepLarge)
                     PHASE(SweepPartialReuse)
                 PHASE(ConcurrentSweep)
+                    PHASE(ParallelSweep)
                 PHASE(Finalize)
                 PHASE(Dispose)
                 PHASE(FinishPartial)
@@ -331,6 +338,7 @@ PHASE(All)
         PHASE(SimpleJitDynamicProfile)
         PHASE(SimpleJit)
         PHASE(FullJit)
+        PHASE(SharedNativeCodeHint)
         PHASE(FailNativeCodeInstall)
         PHASE(PixelArray)
         PHASE(Etw)
@@ -417,6 +425,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_HybridFgJitBgQueueLengthThreshold (32)
 #define DEFAULT_CONFIG_Prejit               (false)
 #define DEFAULT_CONFIG_DeferNested          (true)
+#define DEFAULT_CONFIG_ParallelParseIIFE    (false)
 #define DEFAULT_CONFIG_DeferTopLevelTillFirstCall (true)
 #define DEFAULT_CONFIG_DirectCallTelemetryStats (false)
 #define DEFAULT_CONFIG_errorStackTrace      (true)
@@ -443,6 +452,9 @@ PHASE(All)
 #define DEFAULT_CONFIG_DelayFullJITSmallFunc (0)
 #define DEFAULT_CONFIG_EnableFatalErrorOnOOM (true)
 #define DEFAULT_CONFIG_RedeferralCap         (3)
+#define DEFAULT_CONFIG_ReclaimColdFunctionsGCCount (3)
+#define DEFAULT_CONFIG_DynamicCodeCacheSize  (4096)
+#define DEFAULT_CONFIG_ParserArenaRetainSize (256)
 
 //Following determines inline thresholds
 #define DEFAULT_CONFIG_InlineThreshold      (35)            //Default start
@@ -628,6 +640,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxJITFunctionBytecodeCount (120000)
 
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
+#define DEFAULT_CONFIG_JobQueueAgingPeriod    (4)      // Number of jobs started in the background after which a queued job gains a priority level
+#define DEFAULT_CONFIG_FairJobQueue           (true)
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
 
@@ -736,6 +750,7 @@ PHASE(All)
 #endif
 
 #define DEFAULT_CONFIG_RecyclerForceMarkInterior (false)
+#define DEFAULT_CONFIG_RecyclerMaxParallelism (0) // 0 means use the recycler's default (4-way)
 
 #define DEFAULT_CONFIG_MemProtectHeap (false)
 
@@ -932,6 +947,7 @@ FLAGNR(Boolean, CreateFunctionProxy   , "Create function proxies instead of full
 FLAGNR(Boolean, HybridFgJit           , "When background JIT is enabled, enable jitting in the foreground based on heuristics. This flag is only effective when OptimizeForManyInstances is disabled (UI threads).", DEFAULT_CONFIG_HybridFgJit)
 FLAGNR(Number,  HybridFgJitBgQueueLengthThreshold, "The background job queue length must exceed this threshold to consider jitting in the foreground", DEFAULT_CONFIG_HybridFgJitBgQueueLengthThreshold)
 FLAGNR(Boolean, BytecodeHist          , "Provide a histogram of the bytecodes run by the script. (NoNative required).", false)
+FLAGNR(Boolean, BytecodePairHist      , "Provide a histogram of the most frequent pairs of consecutive bytecodes run by the script. (NoNative required).", false)
 FLAGNR(Boolean, CurrentSourceInfo     , "Enable IASD get current script source info", DEFAULT_CONFIG_CurrentSourceInfo)
 FLAGNR(Boolean, CFGLog                , "Log CFG checks", false)
 FLAGNR(Boolean, CheckAlignment        , "Insert checks in the native code to verify 8-byte alignment of stack", false)
@@ -962,6 +978,7 @@ FLAGNR(Phases,  DebugBreakOnPhaseBegin, "Break into debugger at the beginning of
 
 FLAGNR(Boolean, DebugWindow           , "Send console output to debugger window", false)
 FLAGNR(Boolean, DeferNested           , "Enable deferred parsing of nested function", DEFAULT_CONFIG_DeferNested)
+FLAGR (Boolean, ParallelParseIIFE     , "Parse the bodies of likely immediately invoked functions on background threads", DEFAULT_CONFIG_ParallelParseIIFE)
 FLAGNR(Boolean, DeferTopLevelTillFirstCall      , "Enable tracking of deferred top level functions in a script file, until the first function of the script context is parsed.", DEFAULT_CONFIG_DeferTopLevelTillFirstCall)
 FLAGNR(Number,  DeferParse            , "Minimum size of defer-parsed script (non-zero only: use /nodeferparse do disable", 0)
 FLAGNR(Boolean, DirectCallTelemetryStats, "Enables logging stats for direct call telemetry", DEFAULT_CONFIG_DirectCallTelemetryStats)
@@ -981,6 +998,9 @@ FLAGR (Boolean, DumpObjectGraphOnCollect, "Dump object graph on recycler destruc
 #endif
 FLAGNR(Boolean, DumpEvalStringOnRemoval, "Dumps an eval string when its being removed from the eval map", false)
 FLAGNR(Boolean, DumpObjectGraphOnEnum, "Dump object graph on recycler heap enumeration", false)
+FLAGR (Boolean, DynamicCodeCache      , "Share the byte code of new Function bodies and indirect eval code between the script contexts of a runtime", false)
+FLAGR (Number,  DynamicCodeCacheSize  , "Maximum size in KB of the byte code kept by -DynamicCodeCache", DEFAULT_CONFIG_DynamicCodeCacheSize)
+FLAGR (Number,  ParserArenaRetainSize , "Maximum size in KB of the memory a pooled parser arena keeps between parses (0 to not pool parser arenas)", DEFAULT_CONFIG_ParserArenaRetainSize)
 #ifdef DYNAMIC_PROFILE_STORAGE
 FLAGNRA(String, DynamicProfileCache   , Dpc, "File to cache dynamic profile information", nullptr)
 FLAGNR(String,  DynamicProfileCacheDir, "Directory to cache dynamic profile information", nullptr)
@@ -1199,6 +1219,8 @@ FLAGNR(Number,  AsmJsInlineAdjust       , "Adjustment in the maximum size in byt
 FLAGNR(String,  Interpret             , "List of functions to interpret", nullptr)
 FLAGNR(Phases,  Instrument            , "Instrument the generated code from the given phase", )
 FLAGNR(Number,  JitQueueThreshold     , "Max number of work items/script context in the jit queue", DEFAULT_CONFIG_JitQueueThreshold)
+FLAGNR(Number,  JobQueueAgingPeriod   , "Number of jobs started by the background job processor after which a queued job gains a priority level (0 disables aging)", DEFAULT_CONFIG_JobQueueAgingPeriod)
+FLAGNR(Boolean, FairJobQueue          , "Have the background job processor take turns between job managers (such as script contexts) that have queued jobs", DEFAULT_CONFIG_FairJobQueue)
 #ifdef LEAK_REPORT
 FLAGNR(String,  LeakReport            , "File name for the leak report", nullptr)
 #endif
@@ -1209,6 +1231,8 @@ FLAGNR(Number,  RecursiveInlineThreshold, "Maximum size in bytecodes of an inlin
 FLAGNR(Number,  RecursiveInlineDepthMax, "Maximum depth of a recursive inline call", DEFAULT_CONFIG_RecursiveInlineDepthMax)
 FLAGNR(Number,  RecursiveInlineDepthMin, "Maximum depth of a recursive inline call", DEFAULT_CONFIG_RecursiveInlineDepthMin)
 FLAGNR(Number,  RedeferralCap,           "Number of compilations beyond which we stop redeferring a function", DEFAULT_CONFIG_RedeferralCap)
+FLAGR (Boolean, ReclaimColdFunctions,    "Redefer functions that have not run for -ReclaimColdFunctionsGCCount GCs to reclaim their byte code and caches", false)
+FLAGR (Number,  ReclaimColdFunctionsGCCount, "Number of GCs a function must go without running before -ReclaimColdFunctions redefers it", DEFAULT_CONFIG_ReclaimColdFunctionsGCCount)
 FLAGNR(Number,  Loop                  , "Number of times to execute the script (useful for profiling short benchmarks and finding leaks)", DEFAULT_CONFIG_Loop)
 FLAGRA(Number,  LoopInterpretCount    , lic, "Number of times loop has to be interpreted before JIT Loop body", DEFAULT_CONFIG_LoopInterpretCount)
 FLAGNR(Number,  LoopProfileIterations , "Number of iterations of a loop that must be profiled before jitting the loop body", DEFAULT_CONFIG_LoopProfileIterations)
@@ -1364,6 +1388,7 @@ FLAGNR(Boolean, RecyclerForceMarkInterior, "Force all the mark as interior", DEF
 #if ENABLE_CONCURRENT_GC
 FLAGNR(Number,  RecyclerPriorityBoostTimeout, "Adjust priority boost timeout", 5000)
 FLAGNR(Number,  RecyclerThreadCollectTimeout, "Adjust thread collect timeout", 1000)
+FLAGNR(Number,  RecyclerMaxParallelism, "Maximum number of threads (including the main thread) used for parallel mark", DEFAULT_CONFIG_RecyclerMaxParallelism)
 FLAGRA(Boolean, EnableConcurrentSweepAlloc, ecsa, "Turns off the feature to allow allocations during concurrent sweep.", true)
 #endif
 #ifdef RECYCLER_PAGE_HEAP
@@ -1479,7 +1504,7 @@ FLAGNR(Number, TargetWinRTVersion, "Specifies WinRT version number to target. [o
 FLAGNR(Boolean, EnableVersioningAllAssemblies, "Enable versioning behavior for all assemblies, regardless of host flag (default: false)", false)
 FLAGR(Boolean, FailFastIfDisconnectedDelegate, "When set fail fast if disconnected delegate is invoked", DEFAULT_CONFIG_FailFastIfDisconnectedDelegate)
 #endif
-FLAGNR(Number, Sse, "Virtually disables SSE-based optimizations above the specified SSE level in the Chakra JIT (does not affect CRT SSE usage)", DEFAULT_CONFIG_Sse)
+FLAGNR(Number, Sse, "Virtually disables SSE-based optimizations above the specified SSE level in the Chakra JIT, 5 being AVX (does not affect CRT SSE usage)", DEFAULT_CONFIG_Sse)
 FLAGNR(Number,  DeletedPropertyReuseThreshold, "Start reusing deleted property indexes after this many properties are deleted. Zero to disable reuse.", DEFAULT_CONFIG_DeletedPropertyReuseThreshold)
 FLAGNR(Boolean, ForceStringKeyedSimpleDictionaryTypeHandler, "Force switch to string keyed version of SimpleDictionaryTypeHandler on first new property added to a SimpleDictionaryTypeHandler", DEFAULT_CONFIG_ForceStringKeyedSimpleDictionaryTypeHandler)
 FLAGNR(Number,  BigDictionaryTypeHandlerThreshold, "Min Slot Capacity required to convert DictionaryTypeHandler to BigDictionaryTypeHandler.(Advisable to give more than 15 - to avoid false positive cases)", DEFAULT_CONFIG_BigDictionaryTypeHandlerThreshold)
@@ -78,6 +78,8 @@ AutoSystemInfo::Initialize()
 #if defined(_M_IX86) || defined(_M_X64)
     get_cpuid(CPUInfo, 1);
     isAtom = CheckForAtom();
+    // The OS has to save the YMM state across context switches for AVX instructions to be usable
+    isAvxStateEnabled = (CPUInfo[2] & (1 << 27)) && (get_xcr0() & 0x6) == 0x6;
 #endif
 #if defined(_M_ARM32_OR_ARM64)
     armDivAvailable = IsProcessorFeaturePresent(PF_ARM_DIVIDE_INSTRUCTION_AVAILABLE) ? true : false;
@@ -313,6 +315,13 @@ AutoSystemInfo::TZCntAvailable() const
     return VirtualSseAvailable(4) && (CPUInfo[1] & (1 << 3));
 }
 
+BOOL
+AutoSystemInfo::AVXAvailable() const
+{
+    Assert(initialized);
+    return VirtualSseAvailable(5) && (CPUInfo[2] & (1 << 28)) && isAvxStateEnabled;
+}
+
 bool
 AutoSystemInfo::IsAtomPlatform() const
 {
@@ -31,6 +31,7 @@ class AutoSystemInfo : public SYSTEM_INFO
     BOOL PopCntAvailable() const;
     BOOL LZCntAvailable() const;
     BOOL TZCntAvailable() const;
+    BOOL AVXAvailable() const;
     bool IsAtomPlatform() const;
 #endif
     bool IsLowMemoryProcess();
@@ -108,6 +109,7 @@ class AutoSystemInfo : public SYSTEM_INFO
 private:
 #if defined(_M_IX86) || defined(_M_X64)
     bool isAtom;
+    bool isAvxStateEnabled;
     bool CheckForAtom() const;
 #endif
 
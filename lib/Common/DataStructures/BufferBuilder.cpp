@@ -13,18 +13,97 @@ namespace Js
 
 #if DBG
 void
-BufferBuilder::TraceOutput(byte * buffer, uint32 size) const
+BufferBuilder::TraceOutput(const byte * content, uint32 size) const
 {
     if (PHASE_TRACE1(Js::ByteCodeSerializationPhase))
     {
         Output::Print(_u("%08X: %-40s:"), this->offset, this->clue);
         for (uint i = 0; i < size; i ++)
         {
-            Output::Print(_u(" %02x"), buffer[this->offset + i]);
+            Output::Print(_u(" %02x"), content[i]);
         }
         Output::Print(_u("\n"));
     }
 }
 #endif
 
+byte *
+BufferBuilderStream::Reserve(uint32 offset, uint32 size)
+{
+    if (size > ChunkSize)
+    {
+        Throw::FatalInternalError();
+    }
+
+    if (FAILED(this->hr))
+    {
+        // The content is dropped, so any space will do
+        return this->chunk;
+    }
+
+    if (offset != this->chunkOffset + this->used)
+    {
+        Throw::FatalInternalError();
+    }
+
+    if (ChunkSize - this->used < size)
+    {
+        FlushChunk();
+    }
+
+    byte * content = this->chunk + this->used;
+    this->used += size;
+    return content;
+}
+
+void
+BufferBuilderStream::WriteRaw(uint32 offset, const byte * raw, uint32 size)
+{
+    if (FAILED(this->hr))
+    {
+        return;
+    }
+
+    if (offset != this->chunkOffset + this->used)
+    {
+        Throw::FatalInternalError();
+    }
+
+    while (size != 0)
+    {
+        if (this->used == ChunkSize)
+        {
+            FlushChunk();
+            if (FAILED(this->hr))
+            {
+                return;
+            }
+        }
+
+        uint32 copySize = min(size, ChunkSize - this->used);
+        js_memcpy_s(this->chunk + this->used, ChunkSize - this->used, raw, copySize);
+        this->used += copySize;
+        raw += copySize;
+        size -= copySize;
+    }
+}
+
+void
+BufferBuilderStream::FlushChunk()
+{
+    if (SUCCEEDED(this->hr) && this->used != 0)
+    {
+        this->hr = this->sink->Write(this->chunk, this->used);
+    }
+    this->chunkOffset += this->used;
+    this->used = 0;
+}
+
+HRESULT
+BufferBuilderStream::Flush()
+{
+    FlushChunk();
+    return this->hr;
+}
+
 };
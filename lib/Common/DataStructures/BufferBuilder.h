@@ -25,6 +25,42 @@ typedef _SIMDValue SIMDValue;
 
 namespace Js
 {
+    // Receives the content written by buffer builders, in order, one chunk at a time.
+    class BufferBuilderSink
+    {
+    public:
+        virtual HRESULT Write(__in_bcount(size) const byte * content, __in uint32 size) = 0;
+    };
+
+    // Collects the content written by buffer builders into a fixed size chunk and hands each full chunk
+    // to a sink, so that a large image can be written without holding all of it in memory. Content must
+    // be written in offset order, which is the order pass two visits the builders in.
+    // Once the sink fails, the rest of the content is dropped, the builders stop visiting their children and
+    // Flush returns the failure.
+    class BufferBuilderStream
+    {
+    public:
+        static const uint32 ChunkSize = 64 * 1024;
+
+        BufferBuilderStream(BufferBuilderSink * sink, __in_bcount(ChunkSize) byte * chunk)
+            : sink(sink), chunk(chunk), chunkOffset(0), used(0), hr(S_OK) { }
+
+        // Returns the space for the size bytes of content at offset. size must not exceed ChunkSize.
+        byte * Reserve(__in uint32 offset, __in uint32 size);
+        void WriteRaw(__in uint32 offset, __in_bcount(size) const byte * raw, __in uint32 size);
+        HRESULT Flush();
+        bool HasFailed() const { return FAILED(hr); }
+
+    private:
+        void FlushChunk();
+
+        BufferBuilderSink * sink;
+        byte * chunk;
+        uint32 chunkOffset;     // Offset in the image of the start of the chunk
+        uint32 used;
+        HRESULT hr;
+    };
+
     // The base buffer builder class
     class BufferBuilder
     {
@@ -36,9 +72,10 @@ namespace Js
         uint32 offset;
         virtual uint32 FixOffset(uint32 offset) = 0;
         virtual void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const = 0;
+        virtual void Write(BufferBuilderStream * stream) const = 0;
 #if DBG
     protected:
-        void TraceOutput(byte * buffer, uint32 size) const;
+        void TraceOutput(const byte * content, uint32 size) const;
 #endif
     };
 
@@ -84,33 +121,50 @@ namespace Js
             return value > ONE_BYTE_MAX && value <= TWO_BYTE_MAX;
         }
 
-        uint32 FixOffset(uint32 offset) override
+        uint32 GetSize() const
         {
-            this->offset = offset;
-
             if (useVariableIntEncoding)
             {
                 if (UseOneByte())
                 {
-                    return this->offset + sizeof(serialization_alignment byte);
+                    return sizeof(serialization_alignment byte);
                 }
                 else if (UseTwoBytes())
                 {
-                    return this->offset + sizeof(serialization_alignment uint16) + SENTINEL_BYTE_COUNT;
+                    return sizeof(serialization_alignment uint16) + SENTINEL_BYTE_COUNT;
                 }
 
-                return this->offset + sizeof(serialization_alignment T) + SENTINEL_BYTE_COUNT;
+                return sizeof(serialization_alignment T) + SENTINEL_BYTE_COUNT;
             }
             else
             {
-                return this->offset + sizeof(serialization_alignment T);
+                return sizeof(serialization_alignment T);
+            }
+        }
+
+        uint32 FixOffset(uint32 offset) override
+        {
+            this->offset = offset;
+            return this->offset + GetSize();
+        }
+
+        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const override
+        {
+            if (bufferSize - this->offset < GetSize())
+            {
+                Throw::FatalInternalError();
             }
+            WriteContent(buffer + this->offset);
         }
 
-        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const
+        void Write(BufferBuilderStream * stream) const override
         {
-            DebugOnly(uint32 size = sizeof(T));
+            WriteContent(stream->Reserve(this->offset, GetSize()));
+        }
 
+    private:
+        void WriteContent(byte * content) const
+        {
 #if INSTRUMENT_BUFFER_INTS
             if (value < ((1 << 8)))
             {
@@ -134,32 +188,17 @@ namespace Js
             {
                 if (UseOneByte())
                 {
-                    if (bufferSize - this->offset < sizeof(serialization_alignment byte))
-                    {
-                        Throw::FatalInternalError();
-                    }
-                    DebugOnly(size = sizeof(byte));
-                    *(serialization_alignment byte*)(buffer + this->offset) = (byte) value;
+                    *(serialization_alignment byte*)content = (byte) value;
                 }
                 else if (UseTwoBytes())
                 {
-                    if (bufferSize - this->offset < sizeof(serialization_alignment uint16) + sizeof(serialization_alignment byte))
-                    {
-                        Throw::FatalInternalError();
-                    }
-                    DebugOnly(size = sizeof(uint16) + 1);
-                    *(serialization_alignment byte*)(buffer + this->offset) = TWO_BYTE_SENTINEL;
-                    *(serialization_alignment uint16*)(buffer + this->offset + SENTINEL_BYTE_COUNT) = (uint16) this->value;
+                    *(serialization_alignment byte*)content = TWO_BYTE_SENTINEL;
+                    *(serialization_alignment uint16*)(content + SENTINEL_BYTE_COUNT) = (uint16) this->value;
                 }
                 else
                 {
-                    if (bufferSize - this->offset < sizeof(serialization_alignment T) + sizeof(serialization_alignment byte))
-                    {
-                        Throw::FatalInternalError();
-                    }
-                    *(serialization_alignment byte*)(buffer + this->offset) = FOUR_BYTE_SENTINEL;
-                    *(serialization_alignment T*)(buffer + this->offset + SENTINEL_BYTE_COUNT) = this->value;
-                    DebugOnly(size = sizeof(T) + 1);
+                    *(serialization_alignment byte*)content = FOUR_BYTE_SENTINEL;
+                    *(serialization_alignment T*)(content + SENTINEL_BYTE_COUNT) = this->value;
 #if INSTRUMENT_BUFFER_INTS
                     Output::Print(_u("[BCGENSTATS] %d, %d\n"), value, sizeof(T));
 #endif
@@ -167,13 +206,9 @@ namespace Js
             }
             else
             {
-                if (bufferSize - this->offset<sizeof(serialization_alignment T))
-                {
-                    Throw::FatalInternalError();
-                }
-                *(serialization_alignment T*)(buffer + this->offset) = value;
+                *(serialization_alignment T*)content = value;
             }
-            DebugOnly(TraceOutput(buffer, size));
+            DebugOnly(TraceOutput(content, GetSize()));
         }
     };
 
@@ -194,15 +229,26 @@ namespace Js
             return this->offset + sizeof(serialization_alignment T);
         }
 
-        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const
+        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const override
         {
             if (bufferSize - this->offset<sizeof(serialization_alignment T))
             {
                 Throw::FatalInternalError();
             }
 
-            *(serialization_alignment T*)(buffer + this->offset) = value;
-            DebugOnly(TraceOutput(buffer, sizeof(T)));
+            WriteContent(buffer + this->offset);
+        }
+
+        void Write(BufferBuilderStream * stream) const override
+        {
+            WriteContent(stream->Reserve(this->offset, sizeof(serialization_alignment T)));
+        }
+
+    private:
+        void WriteContent(byte * content) const
+        {
+            *(serialization_alignment T*)content = value;
+            DebugOnly(TraceOutput(content, sizeof(T)));
         }
     };
 
@@ -247,13 +293,21 @@ namespace Js
             });
         }
 
-        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const
+        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const override
         {
             return list->Iterate([&](BufferBuilder * builder) {
                 builder->Write(buffer, bufferSize);
             });
         }
 
+        void Write(BufferBuilderStream * stream) const override
+        {
+            return list->IterateWhile([&](BufferBuilder * builder) {
+                builder->Write(stream);
+                return !stream->HasFailed();
+            });
+        }
+
     };
 
     // A buffer builder which points to another buffer builder.
@@ -276,16 +330,27 @@ namespace Js
             return this->offset + sizeof(int);
         }
 
-        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const
+        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const override
         {
             if (bufferSize - this->offset<sizeof(int))
             {
                 Throw::FatalInternalError();
             }
 
+            WriteContent(buffer + this->offset);
+        }
+
+        void Write(BufferBuilderStream * stream) const override
+        {
+            WriteContent(stream->Reserve(this->offset, sizeof(int)));
+        }
+
+    private:
+        void WriteContent(byte * content) const
+        {
             int offsetOfPointedTo = pointsTo->offset;
-            *(int*)(buffer + this->offset) = offsetOfPointedTo + additionalOffset;
-            DebugOnly(TraceOutput(buffer, sizeof(int)));
+            *(int*)content = offsetOfPointedTo + additionalOffset;
+            DebugOnly(TraceOutput(content, sizeof(int)));
         }
     };
 
@@ -304,7 +369,7 @@ namespace Js
             return this->offset + size;
         }
 
-        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const
+        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const override
         {
             if (bufferSize - this->offset<size)
             {
@@ -312,7 +377,13 @@ namespace Js
             }
 
             js_memcpy_s(buffer + this->offset, bufferSize-this->offset, raw, size);
-            DebugOnly(TraceOutput(buffer, size));
+            DebugOnly(TraceOutput(raw, size));
+        }
+
+        void Write(BufferBuilderStream * stream) const override
+        {
+            stream->WriteRaw(this->offset, raw, size);
+            DebugOnly(TraceOutput(raw, size));
         }
     };
 
@@ -339,7 +410,7 @@ namespace Js
             return content->FixOffset(offset);
         }
 
-        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const
+        void Write(__in_bcount(bufferSize) byte * buffer, __in uint32 bufferSize) const override
         {
             if (bufferSize - this->offset < this->padding)
             {
@@ -353,6 +424,16 @@ namespace Js
 
             this->content->Write(buffer, bufferSize);
         }
+
+        void Write(BufferBuilderStream * stream) const override
+        {
+            if (this->padding != 0)
+            {
+                memset(stream->Reserve(this->offset, this->padding), 0, this->padding);
+            }
+
+            this->content->Write(stream);
+        }
     };
 
 }
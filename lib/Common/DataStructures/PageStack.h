@@ -15,7 +15,7 @@ class PageStack
     static const size_t EntriesPerChunk = (AutoSystemInfo::PageSize - sizeof(Chunk)) / sizeof(T);
 
 public:
-    PageStack(PagePool * pagePool);
+    PageStack(PagePool * pagePool, CriticalSection * chunkLock = nullptr);
     ~PageStack();
 
     void Init(uint reservedPageCount = 0);
@@ -25,6 +25,7 @@ class PageStack
     bool Push(T item);
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
+    bool Steal(PageStack<T> * victimStack);
 
     void Abort();
     void Release();
@@ -44,11 +45,12 @@ class PageStack
     }
 #endif
 
-    static const uint MaxSplitTargets = 3;     // Not counting original stack, so this supports 4-way parallel
+    static const uint MaxSplitTargets = 63;    // Not counting original stack, so this supports 64-way parallel
 
 private:
     Chunk * CreateChunk();
     void FreeChunk(Chunk * chunk);
+    void ApplyStolenChunks();
 
 private:
     T * nextEntry;
@@ -58,6 +60,11 @@ class PageStack
     PagePool * pagePool;
     bool usesReservedPages;
 
+    // Only set on stacks that other stacks can steal full chunks from (see Steal); guards currentChunk
+    // and the chunk list. Only taken when moving between chunks, so the Push/Pop fast path stays lock free.
+    CriticalSection * chunkLock;
+    size_t stolenChunkCount;
+
 #if DBG
     size_t count;
 #endif
@@ -77,6 +84,9 @@ bool PageStack<T>::Pop(T * item)
     if (nextEntry == chunkStart)
     {
         // We're at the beginning of the chunk.  Move to the previous chunk, if any
+        AutoOptionalCriticalSection autoLock(chunkLock);
+        ApplyStolenChunks();
+
         if (currentChunk->nextChunk == nullptr)
         {
             // All done
@@ -115,6 +125,9 @@ bool PageStack<T>::Push(T item)
 {
     if (nextEntry == chunkEnd)
     {
+        AutoOptionalCriticalSection autoLock(chunkLock);
+        ApplyStolenChunks();
+
         Chunk * newChunk = CreateChunk();
         if (newChunk == nullptr)
         {
@@ -144,13 +157,15 @@ bool PageStack<T>::Push(T item)
 
 
 template <typename T>
-PageStack<T>::PageStack(PagePool * pagePool) :
+PageStack<T>::PageStack(PagePool * pagePool, CriticalSection * chunkLock) :
     pagePool(pagePool),
     currentChunk(nullptr),
     nextEntry(nullptr),
     chunkStart(nullptr),
     chunkEnd(nullptr),
-    usesReservedPages(false)
+    usesReservedPages(false),
+    chunkLock(chunkLock),
+    stolenChunkCount(0)
 {
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     pageCount = 0;
@@ -241,6 +256,22 @@ void PageStack<T>::FreeChunk(Chunk * chunk)
 }
 
 
+template <typename T>
+void PageStack<T>::ApplyStolenChunks()
+{
+    // Chunks taken by other stacks are only accounted for by the owning thread, under the chunk lock,
+    // so the counts stay consistent with nextEntry/chunkStart on the lock free fast path.
+    Assert(chunkLock == nullptr ? stolenChunkCount == 0 : chunkLock->IsLocked());
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    pageCount -= stolenChunkCount;
+#endif
+#if DBG
+    count -= stolenChunkCount * EntriesPerChunk;
+#endif
+    stolenChunkCount = 0;
+}
+
+
 template <typename T>
 uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks)
 {
@@ -356,6 +387,71 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+bool PageStack<T>::Steal(PageStack<T> * victimStack)
+{
+    // Take one full chunk from another (concurrently used) stack and make it our current chunk.
+    // Only called once this stack is empty. We never steal the victim's current chunk, which is
+    // the one being pushed to and popped from; all the chunks behind it are full.
+    // We also never steal a chunk on one of the victim's reserved pages: we would free it back to
+    // our own page pool once drained, and the victim would lose the pages it needs to make progress
+    // under OOM.
+
+    Assert(victimStack != this);
+    Assert(this->IsEmpty());
+    Assert(this->chunkLock != nullptr && victimStack->chunkLock != nullptr);
+
+    Chunk * stolenChunk;
+    {
+        AutoCriticalSection autoLock(victimStack->chunkLock);
+
+        Chunk * victimChunk = victimStack->currentChunk;
+        if (victimChunk == nullptr)
+        {
+            return false;
+        }
+
+        while (victimChunk->nextChunk != nullptr && victimChunk->nextChunk->IsReserved())
+        {
+            victimChunk = victimChunk->nextChunk;
+        }
+
+        stolenChunk = victimChunk->nextChunk;
+        if (stolenChunk == nullptr)
+        {
+            return false;
+        }
+
+        victimChunk->nextChunk = stolenChunk->nextChunk;
+        victimStack->stolenChunkCount++;
+    }
+
+    AutoCriticalSection autoLock(this->chunkLock);
+    ApplyStolenChunks();
+
+    if (currentChunk != nullptr)
+    {
+        // Drop our empty chunk; Pop expects every chunk behind the current one to be full.
+        FreeChunk(currentChunk);
+    }
+
+    stolenChunk->nextChunk = nullptr;
+    currentChunk = stolenChunk;
+    chunkStart = currentChunk->entries;
+    chunkEnd = &currentChunk->entries[EntriesPerChunk];
+    nextEntry = chunkEnd;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    pageCount++;
+#endif
+#if DBG
+    count = EntriesPerChunk;
+#endif
+
+    return true;
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
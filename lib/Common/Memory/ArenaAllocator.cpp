@@ -396,6 +396,32 @@ FullReset()
     }
 }
 
+template <class TFreeListPolicy, size_t ObjectAlignmentBitShiftArg, bool RequireObjectAlignment, size_t MaxObjectSize>
+void
+ArenaAllocatorBase<TFreeListPolicy, ObjectAlignmentBitShiftArg, RequireObjectAlignment, MaxObjectSize>::
+ResetToSingleBlock(size_t bytes)
+{
+    // Keep the current block if it is big enough, and not more than twice the size asked for
+    if (this->blockState == 1 && this->bigBlocks->nbytes >= bytes && this->bigBlocks->nbytes / 2 <= bytes)
+    {
+        Reset();
+        return;
+    }
+
+    Clear();
+    if (bytes == 0)
+    {
+        return;
+    }
+
+    BigBlock * blockp = AddBigBlock(bytes);
+    if (blockp != nullptr)
+    {
+        this->blockState = 1;
+        SetCacheBlock(blockp);
+    }
+}
+
 template <class TFreeListPolicy, size_t ObjectAlignmentBitShiftArg, bool RequireObjectAlignment, size_t MaxObjectSize>
 void
 ArenaAllocatorBase<TFreeListPolicy, ObjectAlignmentBitShiftArg, RequireObjectAlignment, MaxObjectSize>::
@@ -202,6 +202,10 @@ class ArenaAllocatorBase : public Allocator, public ArenaData
 
     void Move(ArenaAllocatorBase *srcAllocator);
 
+    // Reset the arena, leaving it with a single block of at least the given size. For arenas that are reused for
+    // work of a similar size, so that they don't go back to the page allocator for each block.
+    void ResetToSingleBlock(size_t bytes);
+
     void Clear()
     {
         ASSERT_THREAD();
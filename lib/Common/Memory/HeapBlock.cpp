@@ -1369,7 +1369,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
     Assert(!this->IsLeafBlock() || finalizeCount == 0);
 
     Recycler * recycler = recyclerSweep.GetRecycler();
-    RECYCLER_STATS_INC(recycler, heapBlockCount[this->GetHeapBlockType()]);
+    RECYCLER_SWEEP_STATS_INC(recyclerSweep, heapBlockCount[this->GetHeapBlockType()]);
 
 #if ENABLE_PARTIAL_GC
     if (recyclerSweep.DoAdjustPartialHeuristics() && allocable)
@@ -1412,7 +1412,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
             return SweepStateEmpty;
     }
 
-    RECYCLER_STATS_ADD(recycler, heapBlockFreeByteCount[this->GetHeapBlockType()], expectFreeCount * this->objectSize);
+    RECYCLER_SWEEP_STATS_ADD(recyclerSweep, heapBlockFreeByteCount[this->GetHeapBlockType()], expectFreeCount * this->objectSize);
 
     Assert(!hasPendingDispose || (this->freeCount != 0));
     SweepState state = SweepStateSwept;
@@ -1444,7 +1444,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
         return (this->freeCount == 0) ? SweepStateFull : state;
     }
 
-    RECYCLER_STATS_INC(recycler, heapBlockSweptCount[this->GetHeapBlockType()]);
+    RECYCLER_SWEEP_STATS_INC(recyclerSweep, heapBlockSweptCount[this->GetHeapBlockType()]);
 
     // We need to sweep in thread if there are any finalizable object.
     // So that the PrepareFinalize() can be called before concurrent sweep
@@ -1463,7 +1463,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
         Assert(!this->HasPendingDisposeObjects());
 
         recyclerSweep.SetHasPendingSweepSmallHeapBlocks();
-        RECYCLER_STATS_INC(recycler, heapBlockConcurrentSweptCount[this->GetHeapBlockType()]);
+        RECYCLER_SWEEP_STATS_INC(recyclerSweep, heapBlockConcurrentSweptCount[this->GetHeapBlockType()]);
         // This heap block has objects that need to be swept concurrently.
         this->isPendingConcurrentSweep = true;
 #ifdef RECYCLER_TRACE
@@ -1210,7 +1210,7 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
             }
 #endif
 
-            RECYCLER_STATS_INC(recycler, numEmptySmallBlocks[heapBlock->GetHeapBlockType()]);
+            RECYCLER_SWEEP_STATS_INC(recyclerSweep, numEmptySmallBlocks[heapBlock->GetHeapBlockType()]);
 
 #if ENABLE_CONCURRENT_GC
             // CONCURRENT-TODO: Finalizable block never have background == true and always be processed
@@ -1233,7 +1233,7 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
                 // CONCURRENT-TODO: We will zero heap block even if the number free page pool exceed
                 // the maximum and will get decommitted anyway
                 recyclerSweep.template QueueEmptyHeapBlock<TBlockType>(this, heapBlock);
-                RECYCLER_STATS_INC(recycler, numZeroedOutSmallBlocks);
+                RECYCLER_SWEEP_STATS_INC(recyclerSweep, numZeroedOutSmallBlocks);
 #ifdef RECYCLER_TRACE
                 recyclerSweep.GetRecycler()->PrintBlockStatus(this, heapBlock, _u("[**8**] finished Sweep Pass1, heapblock EMPTY added to pendingEmptyBlockList."));
 #endif
@@ -1101,17 +1101,24 @@ HeapInfo::SweepSmallNonFinalizable(RecyclerSweep& recyclerSweep)
         // until  we are going to sweep leaf pages.
         recycler->GetRecyclerLeafPageAllocator()->SuspendIdleDecommit();
     }
-    for (uint i=0; i<HeapConstants::BucketCount; i++)
+
+#if ENABLE_CONCURRENT_GC
+    // In the background, spread the buckets across the parallel threads if we can
+    if (!recyclerSweep.IsBackground() || !recycler->DoParallelSweep(recyclerSweep))
+#endif
     {
-        heapBuckets[i].Sweep(recyclerSweep);
-    }
+        for (uint i=0; i<HeapConstants::BucketCount; i++)
+        {
+            heapBuckets[i].Sweep(recyclerSweep);
+        }
 
 #if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
-    for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
-    {
-        mediumHeapBuckets[i].Sweep(recyclerSweep);
-    }
+        for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
+        {
+            mediumHeapBuckets[i].Sweep(recyclerSweep);
+        }
 #endif
+    }
 
     if (!recyclerSweep.IsBackground())
     {
@@ -1123,6 +1130,40 @@ HeapInfo::SweepSmallNonFinalizable(RecyclerSweep& recyclerSweep)
     }
 }
 
+#if ENABLE_CONCURRENT_GC
+void
+HeapInfo::ParallelSweepSmallNonFinalizable(RecyclerSweep& recyclerSweep, volatile LONG * nextBucketIndex)
+{
+    // Hand out one bucket at a time so that a worker that got cheap buckets keeps picking up more.
+    // Each bucket is swept by a single worker, into that worker's own RecyclerSweep.
+    const uint bucketCount = HeapConstants::BucketCount
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+        + HeapConstants::MediumBucketCount
+#endif
+        ;
+
+    while (true)
+    {
+        const uint bucketIndex = (uint)(::InterlockedIncrement(nextBucketIndex) - 1);
+        if (bucketIndex >= bucketCount)
+        {
+            break;
+        }
+
+        if (bucketIndex < HeapConstants::BucketCount)
+        {
+            heapBuckets[bucketIndex].Sweep(recyclerSweep);
+        }
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+        else
+        {
+            mediumHeapBuckets[bucketIndex - HeapConstants::BucketCount].Sweep(recyclerSweep);
+        }
+#endif
+    }
+}
+#endif
+
 size_t
 HeapInfo::Rescan(RescanFlags flags)
 {
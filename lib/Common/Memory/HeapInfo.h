@@ -289,6 +289,9 @@ class HeapInfo
 #endif
 
     void SweepSmallNonFinalizable(RecyclerSweep& recyclerSweep);
+#if ENABLE_CONCURRENT_GC
+    void ParallelSweepSmallNonFinalizable(RecyclerSweep& recyclerSweep, volatile LONG * nextBucketIndex);
+#endif
     void SweepLargeNonFinalizable(RecyclerSweep& recyclerSweep);
 
 #if DBG || defined(RECYCLER_SLOW_CHECK_ENABLED)
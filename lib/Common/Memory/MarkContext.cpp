@@ -13,9 +13,10 @@
 MarkContext::MarkContext(Recycler * recycler, PagePool * pagePool) :
     recycler(recycler),
     pagePool(pagePool),
-    markStack(pagePool),
+    stealLock(4000),
+    markStack(pagePool, &stealLock),
 #ifdef RECYCLER_VISITED_HOST
-    preciseStack(pagePool),
+    preciseStack(pagePool, &stealLock),
 #endif
     trackStack(pagePool)
 {
@@ -112,6 +113,24 @@ uint MarkContext::Split(uint targetCount, __in_ecount(targetCount) MarkContext *
 #endif
 }
 
+bool MarkContext::Steal(MarkContext * victimContext)
+{
+    // Called by a parallel marker that ran out of work; takes a full chunk from a context another marker is still processing.
+    Assert(victimContext != this);
+
+    if (this->markStack.Steal(&victimContext->markStack))
+    {
+        return true;
+    }
+#ifdef RECYCLER_VISITED_HOST
+    if (this->preciseStack.Steal(&victimContext->preciseStack))
+    {
+        return true;
+    }
+#endif
+    return false;
+}
+
 
 void MarkContext::ProcessTracked()
 {
@@ -60,6 +60,7 @@ class MarkContext
     void ProcessTracked();
 
     uint Split(uint targetCount, __in_ecount(targetCount) MarkContext ** targetContexts);
+    bool Steal(MarkContext * victimContext);
 
     void Abort();
     void Release();
@@ -128,6 +129,9 @@ class MarkContext
 private:
     Recycler * recycler;
     PagePool * pagePool;
+
+    // Shared by the stacks other parallel markers can steal from; the track stack is never stolen from.
+    CriticalSection stealLock;
     PageStack<MarkCandidate> markStack;
 #ifdef RECYCLER_VISITED_HOST
     PageStack<IRecyclerVisitedObject*> preciseStack;
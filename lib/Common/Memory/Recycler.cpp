@@ -115,13 +115,8 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     threadPageAllocator(pageAllocator),
     markPagePool(configFlagsTable),
-    parallelMarkPagePool1(configFlagsTable),
-    parallelMarkPagePool2(configFlagsTable),
-    parallelMarkPagePool3(configFlagsTable),
     markContext(this, &this->markPagePool),
-    parallelMarkContext1(this, &this->parallelMarkPagePool1),
-    parallelMarkContext2(this, &this->parallelMarkPagePool2),
-    parallelMarkContext3(this, &this->parallelMarkPagePool3),
+    parallelMarkContextCount(0),
 #if ENABLE_PARTIAL_GC
     clientTrackedObjectAllocator(_u("CTO-List"), GetPageAllocator(), Js::Throw::OutOfMemory),
 #endif
@@ -146,14 +141,19 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     enableConcurrentMark(false),  // Default to non-concurrent
     enableParallelMark(false),
     enableConcurrentSweep(false),
+    enableParallelSweep(false),
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     allowAllocationsDuringConcurrentSweepForCollection(false),
 #endif
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
-    parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
-    parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
+    requestedMaxParallelism(0),
+    activeParallelMarkerCount(0),
+    parallelSweepWorkers(nullptr),
+    parallelSweepWorkerCount(0),
+    nextParallelSweepWorker(0),
+    nextParallelSweepBucket(0),
     priorityBoost(false),
     isAborting(false),
 #if DBG
@@ -251,9 +251,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
     markContext.SetMarkMap(markMap);
-    parallelMarkContext1.SetMarkMap(markMap);
-    parallelMarkContext2.SetMarkMap(markMap);
-    parallelMarkContext3.SetMarkMap(markMap);
 #endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
@@ -328,9 +325,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     // recycler requires at least Recycler::PrimaryMarkStackReservedPageCount to function properly for the main mark context
     this->markContext.SetMaxPageCount(max(static_cast<size_t>(GetRecyclerFlagsTable().MaxMarkStackPageCount), static_cast<size_t>(Recycler::PrimaryMarkStackReservedPageCount)));
-    this->parallelMarkContext1.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext2.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext3.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
 
     if (GetRecyclerFlagsTable().IsEnabled(Js::GCMemoryThresholdFlag))
     {
@@ -450,6 +444,15 @@ Recycler::ResetThreadId()
 }
 #endif
 
+Recycler::ParallelMarkContext::ParallelMarkContext(Recycler * recycler, Js::ConfigFlagsTable& configFlagsTable) :
+    pagePool(configFlagsTable),
+    markContext(recycler, &this->pagePool)
+#if ENABLE_CONCURRENT_GC
+    , parallelThread(recycler, &Recycler::ParallelWorkFunc, &this->markContext)
+#endif
+{
+}
+
 Recycler::~Recycler()
 {
 #if ENABLE_CONCURRENT_GC
@@ -532,9 +535,16 @@ Recycler::~Recycler()
 #endif
 
     markContext.Release();
-    parallelMarkContext1.Release();
-    parallelMarkContext2.Release();
-    parallelMarkContext3.Release();
+    this->ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->Release();
+    });
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        HeapDelete(this->parallelMarkContexts[i]);
+    }
+    this->parallelMarkContextCount = 0;
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -856,7 +866,14 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    uint parallelismLimit = this->requestedMaxParallelism != 0 ?
+        this->requestedMaxParallelism : (uint)CUSTOM_CONFIG_FLAG(GetRecyclerFlagsTable(), RecyclerMaxParallelism);
+    if (parallelismLimit == 0)
+    {
+        parallelismLimit = DefaultMaxParallelism;
+    }
+    parallelismLimit = min(parallelismLimit, (uint)MaxParallelism);
+    this->maxParallelism = (numProcs > parallelismLimit) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? parallelismLimit : numProcs;
 
     if (forceInThread)
     {
@@ -975,9 +992,10 @@ Recycler::ClearNeedOOMRescan()
 {
     this->needOOMRescan = false;
     markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    this->ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    });
 }
 
 bool
@@ -2246,13 +2264,29 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 
     RECYCLER_PROFILE_EXEC_THREAD_BEGIN(background, this, Js::MarkPhase);
 
-    if (this->enableScanInteriorPointers)
-    {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
-    }
-    else
+#if ENABLE_CONCURRENT_GC
+    InterlockedIncrement(&this->activeParallelMarkerCount);
+#endif
+
+    for (;;)
     {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        if (this->enableScanInteriorPointers)
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
+        }
+        else
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        }
+
+#if ENABLE_CONCURRENT_GC
+        // Out of work; take some from a marker that is still busy instead of idling until it finishes
+        if (this->StealParallelMarkWork(markContext))
+        {
+            continue;
+        }
+#endif
+        break;
     }
 
     RECYCLER_PROFILE_EXEC_THREAD_END(background, this, Js::MarkPhase);
@@ -2348,9 +2382,11 @@ Recycler::ResetMarkCollectionState()
 
     // If we aborted after doing a background parallel Mark, we wouldn't have cleaned up the
     // parallel markContexts yet. Clean these up now.
-    // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    // Note parallelMarkContexts[0] is not used in background parallel (see DoBackgroundParallelMark)
+    for (uint i = 1; i < this->parallelMarkContextCount; i++)
+    {
+        this->parallelMarkContexts[i]->markContext.Cleanup();
+    }
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2518,14 +2554,19 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= MaxParallelism);
+    Assert(this->parallelMarkContextCount == this->maxParallelism - 1);
 
     // Split the mark stack into [this->maxParallelism] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[MaxParallelism - 1];
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        splitContexts[i] = &this->parallelMarkContexts[i]->markContext;
+    }
     uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
 
-    Assert(actualSplitCount <= 3);
+    Assert(actualSplitCount <= this->parallelMarkContextCount);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2547,20 +2588,23 @@ Recycler::DoParallelMark()
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
 
     // If there's enough work to split, then kick off marking on parallel threads too.
+    // The main thread processes parallelMarkContexts[0]; every other split has its own thread.
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    if (concurrentSuccess && actualSplitCount >= 2)
+    bool parallelSuccess[MaxParallelism - 1] = { false };
+    if (concurrentSuccess)
     {
-        parallelSuccess1 = parallelThread1.StartConcurrent();
-        if (parallelSuccess1 && actualSplitCount == 3)
+        for (uint i = 1; i < actualSplitCount; i++)
         {
-            parallelSuccess2 = parallelThread2.StartConcurrent();
+            parallelSuccess[i] = this->parallelMarkContexts[i]->parallelThread.StartConcurrent();
+            if (!parallelSuccess[i])
+            {
+                break;
+            }
         }
     }
 
     // Process our portion of the split.
-    this->ProcessParallelMark(false, &parallelMarkContext1);
+    this->ProcessParallelMark(false, &this->parallelMarkContexts[0]->markContext);
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
@@ -2573,27 +2617,15 @@ Recycler::DoParallelMark()
         this->ProcessParallelMark(false, &markContext);
     }
 
-    if (actualSplitCount >= 2)
+    for (uint i = 1; i < actualSplitCount; i++)
     {
-        if (parallelSuccess1)
+        if (parallelSuccess[i])
         {
-            parallelThread1.WaitForConcurrent();
+            this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
         }
         else
         {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
-        }
-
-        if (actualSplitCount == 3)
-        {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
+            this->ProcessParallelMark(false, &this->parallelMarkContexts[i]->markContext);
         }
     }
 
@@ -2622,19 +2654,24 @@ Recycler::DoBackgroundParallelMark()
 {
     // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
+    // parallelMarkContexts[0] belongs to the main thread in DoParallelMark, so we split into the rest.
     uint actualSplitCount = 0;
-    MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[MaxParallelism - 2];
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism <= MaxParallelism);
+        Assert(this->parallelMarkContextCount == this->maxParallelism - 1);
         if (this->maxParallelism > 2)
         {
+            for (uint i = 1; i < this->parallelMarkContextCount; i++)
+            {
+                splitContexts[i - 1] = &this->parallelMarkContexts[i]->markContext;
+            }
             actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
         }
     }
 
-    Assert(actualSplitCount <= 2);
+    Assert(actualSplitCount <= MaxParallelism - 2);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2654,12 +2691,14 @@ Recycler::DoBackgroundParallelMark()
 
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    parallelSuccess1 = parallelThread1.StartConcurrent();
-    if (parallelSuccess1 && actualSplitCount == 2)
+    bool parallelSuccess[MaxParallelism - 1] = { false };
+    for (uint i = 1; i <= actualSplitCount; i++)
     {
-        parallelSuccess2 = parallelThread2.StartConcurrent();
+        parallelSuccess[i] = this->parallelMarkContexts[i]->parallelThread.StartConcurrent();
+        if (!parallelSuccess[i])
+        {
+            break;
+        }
     }
 
     // Process our portion of the split.
@@ -2667,28 +2706,95 @@ Recycler::DoBackgroundParallelMark()
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
-    if (parallelSuccess1)
+    for (uint i = 1; i <= actualSplitCount; i++)
     {
-        parallelThread1.WaitForConcurrent();
+        if (parallelSuccess[i])
+        {
+            this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
+        }
+        else
+        {
+            this->ProcessParallelMark(true, &this->parallelMarkContexts[i]->markContext);
+        }
     }
-    else
+
+    this->collectionState = CollectionStateConcurrentMark;
+}
+
+bool
+Recycler::DoParallelSweep(RecyclerSweep& recyclerSweep)
+{
+    Assert(recyclerSweep.IsBackground());
+
+    // The concurrent thread sweeps along with the parallel threads, which are only set up
+    // for parallelMarkContexts[1] and up (see DoParallelMark).
+    if (!this->enableParallelSweep || this->parallelMarkContextCount < 2)
     {
-        this->ProcessParallelMark(true, &parallelMarkContext2);
+        return false;
     }
 
-    if (actualSplitCount == 2)
+    // Force sweeping frees each object through NotifyFree and flips the recycler wide isForceSweeping
+    if (this->ForceSweepObject())
     {
-        if (parallelSuccess2)
+        return false;
+    }
+
+    const uint workerCount = this->parallelMarkContextCount;
+    RecyclerSweep * workerSweeps = HeapNewNoThrowArray(RecyclerSweep, workerCount);
+    if (workerSweeps == nullptr)
+    {
+        return false;
+    }
+
+    for (uint i = 0; i < workerCount; i++)
+    {
+        workerSweeps[i].BeginParallelSweepWorker(recyclerSweep);
+    }
+
+    this->parallelSweepWorkers = workerSweeps;
+    this->parallelSweepWorkerCount = workerCount;
+    this->nextParallelSweepWorker = 0;
+    this->nextParallelSweepBucket = 0;
+
+    // Buckets are handed out dynamically, so threads that fail to start just leave their share to the others.
+    bool parallelSuccess[MaxParallelism - 1] = { false };
+    for (uint i = 1; i < workerCount; i++)
+    {
+        parallelSuccess[i] = this->parallelMarkContexts[i]->parallelThread.StartConcurrent();
+        if (!parallelSuccess[i])
         {
-            parallelThread2.WaitForConcurrent();
+            break;
         }
-        else
+    }
+
+    this->ParallelSweepWorkFunc();
+
+    for (uint i = 1; i < workerCount; i++)
+    {
+        if (parallelSuccess[i])
         {
-            this->ProcessParallelMark(true, &parallelMarkContext3);
+            this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
         }
     }
 
-    this->collectionState = CollectionStateConcurrentMark;
+    for (uint i = 0; i < workerCount; i++)
+    {
+        recyclerSweep.MergeParallelSweepWorker(workerSweeps[i]);
+    }
+
+    this->parallelSweepWorkers = nullptr;
+    this->parallelSweepWorkerCount = 0;
+    HeapDeleteArray(workerCount, workerSweeps);
+    return true;
+}
+
+void
+Recycler::ParallelSweepWorkFunc()
+{
+    const uint workerIndex = (uint)(::InterlockedIncrement(&this->nextParallelSweepWorker) - 1);
+    Assert(workerIndex < this->parallelSweepWorkerCount);
+
+    this->autoHeap.ParallelSweepSmallNonFinalizable(this->parallelSweepWorkers[workerIndex], &this->nextParallelSweepBucket);
 }
 #endif
 
@@ -2806,15 +2912,17 @@ Recycler::EndMark()
     // Clean up mark contexts, which will release held free pages
     // Do this for all contexts before we decommit, to make sure all pages are freed
     markContext.Cleanup();
-    parallelMarkContext1.Cleanup();
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    this->ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->Cleanup();
+    });
 
     // Decommit all pages
     markContext.DecommitPages();
-    parallelMarkContext1.DecommitPages();
-    parallelMarkContext2.DecommitPages();
-    parallelMarkContext3.DecommitPages();
+    this->ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->DecommitPages();
+    });
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2904,9 +3012,12 @@ Recycler::EndMarkOnLowMemory()
     while (this->NeedOOMRescan());
 
     Assert(!markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+#if DBG
+    this->ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        Assert(!parallelMarkContext->GetPageAllocator()->DisableAllocationOutOfMemory());
+    });
+#endif
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2931,10 +3042,51 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    bool isEmpty = markContext.IsEmpty();
+    this->ForEachParallelMarkContext([&](MarkContext * parallelMarkContext)
+    {
+        isEmpty = parallelMarkContext->IsEmpty() && isEmpty;
+    });
+    return isEmpty;
 }
 #endif
 
+bool
+Recycler::HasPendingMarkObjects() const
+{
+    if (markContext.HasPendingMarkObjects())
+    {
+        return true;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (this->parallelMarkContexts[i]->markContext.HasPendingMarkObjects())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+Recycler::HasPendingTrackObjects() const
+{
+    if (markContext.HasPendingTrackObjects())
+    {
+        return true;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (this->parallelMarkContexts[i]->markContext.HasPendingTrackObjects())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 #ifdef HEAP_ENUMERATION_VALIDATION
 void
 Recycler::PostHeapEnumScan(PostHeapEnumScanCallback callback, void *data)
@@ -4366,9 +4518,10 @@ Recycler::ProcessTrackedObjects()
 
     // If we did a parallel mark, we need to process any queued tracked objects from the parallel mark stack as well.
     // If we didn't, this will do nothing.
-    parallelMarkContext1.ProcessTracked();
-    parallelMarkContext2.ProcessTracked();
-    parallelMarkContext3.ProcessTracked();
+    this->ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->ProcessTracked();
+    });
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4913,8 +5066,10 @@ Recycler::FinalizeConcurrent(bool restoreState)
 
     // Shutdown parallel threads and return the handle for them so the caller can
     // close it.
-    parallelThread1.Shutdown();
-    parallelThread2.Shutdown();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        this->parallelMarkContexts[i]->parallelThread.Shutdown();
+    }
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -4968,10 +5123,13 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     this->enableConcurrentMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentMarkPhase);
     this->enableParallelMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase);
     this->enableConcurrentSweep = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentSweepPhase);
+    // Parallel sweep is opt in (-on:ParallelSweep) until it has had more coverage
+    this->enableParallelSweep = CUSTOM_PHASE_ON1(GetRecyclerFlagsTable(), Js::ParallelSweepPhase);
 #else
     this->enableConcurrentMark = true;
     this->enableParallelMark = true;
     this->enableConcurrentSweep = true;
+    this->enableParallelSweep = false;
 #endif
 
     if (this->enableParallelMark && this->maxParallelism == 1)
@@ -4980,6 +5138,18 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
         this->enableParallelMark = false;
     }
 
+    if (this->enableParallelMark && !this->EnsureParallelMarkContexts())
+    {
+        // Couldn't allocate any parallel mark context
+        this->enableParallelMark = false;
+    }
+
+    if (!this->enableParallelMark || !this->enableConcurrentSweep)
+    {
+        // Parallel sweep runs on the parallel mark threads, in the background
+        this->enableParallelSweep = false;
+    }
+
     if (threadService->HasCallback())
     {
         this->threadService = threadService;
@@ -4988,32 +5158,19 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     else
     {
         bool startConcurrentThread = true;
-        bool startedParallelThread1 = false;
-        bool startedParallelThread2 = false;
+        uint startedParallelThreadCount = 0;
 
-        if (startAllThreads)
+        if (startAllThreads && this->enableParallelMark)
         {
-            if (this->enableParallelMark && this->maxParallelism > 2)
+            // parallelMarkContexts[0] is processed by the main thread, so it never needs a thread
+            for (uint i = 1; i < this->parallelMarkContextCount; i++)
             {
-                if (!parallelThread1.EnableConcurrent(true))
+                if (!this->parallelMarkContexts[i]->parallelThread.EnableConcurrent(true))
                 {
                     startConcurrentThread = false;
+                    break;
                 }
-                else
-                {
-                    startedParallelThread1 = true;
-                    if (this->maxParallelism > 3)
-                    {
-                        if (!parallelThread2.EnableConcurrent(true))
-                        {
-                            startConcurrentThread = false;
-                        }
-                        else
-                        {
-                            startedParallelThread2 = true;
-                        }
-                    }
-                }
+                startedParallelThreadCount = i;
             }
         }
 
@@ -5036,13 +5193,9 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
             }
         }
 
-        if (startedParallelThread1)
+        for (uint i = 1; i <= startedParallelThreadCount; i++)
         {
-            parallelThread1.Shutdown();
-            if (startedParallelThread2)
-            {
-                parallelThread2.Shutdown();
-            }
+            this->parallelMarkContexts[i]->parallelThread.Shutdown();
         }
     }
 
@@ -5050,6 +5203,7 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     this->enableConcurrentMark = false;
     this->enableParallelMark = false;
     this->enableConcurrentSweep = false;
+    this->enableParallelSweep = false;
 
     if (concurrentWorkReadyEvent)
     {
@@ -6691,13 +6845,10 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
 }
 
 
-template <uint parallelId>
 void
-Recycler::ParallelWorkFunc()
+Recycler::ParallelWorkFunc(MarkContext * markContext)
 {
-    Assert(parallelId == 0 || parallelId == 1);
-
-    MarkContext * markContext = (parallelId == 0 ? &this->parallelMarkContext2 : &this->parallelMarkContext3);
+    Assert(markContext != &this->markContext);
 
     switch (this->collectionState)
     {
@@ -6709,11 +6860,97 @@ Recycler::ParallelWorkFunc()
             this->ProcessParallelMark(true, markContext);
             break;
 
+        case CollectionStateConcurrentSweep:
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
+        case CollectionStateConcurrentSweepPass1:
+#endif
+            this->ParallelSweepWorkFunc();
+            break;
+
         default:
             Assert(false);
     }
 }
 
+bool
+Recycler::EnsureParallelMarkContexts()
+{
+    Assert(this->enableParallelMark);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= MaxParallelism);
+
+    while (this->parallelMarkContextCount < this->maxParallelism - 1)
+    {
+        ParallelMarkContext * parallelMarkContext = HeapNewNoThrow(ParallelMarkContext, this, this->GetRecyclerFlagsTable());
+        if (parallelMarkContext == nullptr)
+        {
+            // Scale back to the contexts we have, rather than not marking in parallel at all
+            this->maxParallelism = this->parallelMarkContextCount + 1;
+            break;
+        }
+
+#ifdef RECYCLER_MARK_TRACK
+        parallelMarkContext->markContext.SetMarkMap(this->markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        parallelMarkContext->markContext.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
+#endif
+        this->parallelMarkContexts[this->parallelMarkContextCount++] = parallelMarkContext;
+    }
+
+    return this->maxParallelism > 1;
+}
+
+bool
+Recycler::StealParallelMarkWork(MarkContext * thiefContext)
+{
+    // We ran out of work, so we are no longer active. Keep looking for work as long as some other
+    // marker is still active, since only an active marker can have work left to take.
+    InterlockedDecrement(&this->activeParallelMarkerCount);
+
+    // Back off exponentially between rounds so that idle markers don't keep hammering the victims' queues and the
+    // shared counter. Once the spin gets long, give up the time slice instead.
+    const uint maxSpinCount = 1024;
+    uint spinCount = 1;
+    while (true)
+    {
+        if (thiefContext != &this->markContext && thiefContext->Steal(&this->markContext))
+        {
+            InterlockedIncrement(&this->activeParallelMarkerCount);
+            RECYCLER_STATS_INTERLOCKED_INC(this, parallelMarkStealCount);
+            return true;
+        }
+
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            MarkContext * victimContext = &this->parallelMarkContexts[i]->markContext;
+            if (victimContext != thiefContext && thiefContext->Steal(victimContext))
+            {
+                InterlockedIncrement(&this->activeParallelMarkerCount);
+                RECYCLER_STATS_INTERLOCKED_INC(this, parallelMarkStealCount);
+                return true;
+            }
+        }
+
+        if (this->activeParallelMarkerCount == 0)
+        {
+            return false;
+        }
+
+        if (spinCount < maxSpinCount)
+        {
+            for (uint i = 0; i < spinCount; i++)
+            {
+                YieldProcessor();
+            }
+            spinCount *= 2;
+        }
+        else
+        {
+            SwitchToThread();
+        }
+    }
+}
+
 void
 RecyclerParallelThread::WaitForConcurrent()
 {
@@ -6816,7 +7053,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+            (recycler->*workFunc)(parallelThread->markContext);
 
             // We always wait after the first time
             mustWait = true;
@@ -6855,7 +7092,7 @@ RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
     Recycler * recycler = parallelThread->recycler;
     RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
-    (recycler->*workFunc)();
+    (recycler->*workFunc)(parallelThread->markContext);
 
     SetEvent(parallelThread->concurrentWorkDoneEvent);
 }
@@ -7199,6 +7436,8 @@ Recycler::PrintMarkCollectionStats()
     Output::Print(_u("                                        | Non GC Int: %9d %5.1f | Stack   :%9d | NewFalse:%9d\n"),
         collectionStats.tryMarkInteriorNonRecyclerMemoryCount, (double)collectionStats.tryMarkInteriorNonRecyclerMemoryCount / (double)nonMark * 100,
         collectionStats.stackCount, collectionStats.markThruFalseNewObjCount);
+    Output::Print(_u("                                        |                         | Steal   :%9d\n"),
+        collectionStats.parallelMarkStealCount);
 }
 
 void
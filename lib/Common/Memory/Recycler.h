@@ -488,6 +488,7 @@ struct RecyclerCollectionStats
     size_t finalizeCount;
     size_t markThruNewObjCount;
     size_t markThruFalseNewObjCount;
+    size_t parallelMarkStealCount;  // full mark stack chunks taken from another parallel marker
 
     struct MarkData
     {
@@ -549,6 +550,9 @@ struct RecyclerCollectionStats
 #define RECYCLER_STATS_INTERLOCKED_ADD(r, f, v) { InterlockedAdd((LONG *)&r->collectionStats.f, (LONG)(v)); }
 #define RECYCLER_STATS_SUB(r, f, v) r->collectionStats.f -= (v)
 #define RECYCLER_STATS_SET(r, f, v) r->collectionStats.f = v
+// Sweep stats go through the RecyclerSweep, which has its own during parallel sweep
+#define RECYCLER_SWEEP_STATS_INC(s, f) ++(s).GetCollectionStats()->f
+#define RECYCLER_SWEEP_STATS_ADD(s, f, v) (s).GetCollectionStats()->f += (v)
 #else
 #define RECYCLER_STATS_INC_IF(cond, r, f)
 #define RECYCLER_STATS_INC(r, f)
@@ -558,6 +562,8 @@ struct RecyclerCollectionStats
 #define RECYCLER_STATS_INTERLOCKED_ADD(r, f, v)
 #define RECYCLER_STATS_SUB(r, f, v)
 #define RECYCLER_STATS_SET(r, f, v)
+#define RECYCLER_SWEEP_STATS_INC(s, f)
+#define RECYCLER_SWEEP_STATS_ADD(s, f, v)
 #endif
 #ifdef RECYCLER_TRACE
 struct CollectionParam
@@ -585,11 +591,12 @@ struct CollectionParam
 class RecyclerParallelThread
 {
 public:
-    typedef void (Recycler::* WorkFunc)();
+    typedef void (Recycler::* WorkFunc)(MarkContext * markContext);
 
-    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc) :
+    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc, MarkContext * markContext) :
         recycler(recycler),
         workFunc(workFunc),
+        markContext(markContext),
         concurrentWorkReadyEvent(NULL),
         concurrentWorkDoneEvent(NULL),
         concurrentThread(NULL)
@@ -618,6 +625,7 @@ class RecyclerParallelThread
 private:
     WorkFunc workFunc;
     Recycler * recycler;
+    MarkContext * markContext;
     HANDLE concurrentWorkReadyEvent;// main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent;// concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
@@ -849,20 +857,42 @@ class Recycler
     MarkContext markContext;
 
     // Contexts for parallel marking.
-    // We support up to 4 way parallelism, main context + 3 additional parallel contexts.
-    MarkContext parallelMarkContext1;
-    MarkContext parallelMarkContext2;
-    MarkContext parallelMarkContext3;
+    // We support up to MaxParallelism way parallelism, main context + [maxParallelism - 1] additional
+    // parallel contexts, created when parallel mark is enabled. Each additional context but the first has
+    // a thread to process it, and markers that run out of work steal from the other contexts.
+    class ParallelMarkContext
+    {
+    public:
+        ParallelMarkContext(Recycler * recycler, Js::ConfigFlagsTable& configFlagsTable);
+
+        PagePool pagePool;
+        MarkContext markContext;
+#if ENABLE_CONCURRENT_GC
+        RecyclerParallelThread parallelThread;
+#endif
+    };
+
+    static const uint MaxParallelism = PageStack<void *>::MaxSplitTargets + 1;
+    static const uint DefaultMaxParallelism = 4;
+
+    ParallelMarkContext * parallelMarkContexts[MaxParallelism - 1];
+    uint parallelMarkContextCount;
 
-    // Page pools for above markContexts
+    template <typename Fn>
+    void ForEachParallelMarkContext(Fn fn)
+    {
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            fn(&this->parallelMarkContexts[i]->markContext);
+        }
+    }
+
+    // Page pool for above markContext
     PagePool markPagePool;
-    PagePool parallelMarkPagePool1;
-    PagePool parallelMarkPagePool2;
-    PagePool parallelMarkPagePool3;
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const;
+    bool HasPendingTrackObjects() const;
 
     RecyclerCollectionWrapper * collectionWrapper;
 
@@ -982,8 +1012,11 @@ class Recycler
     bool enableConcurrentMark;
     bool enableParallelMark;
     bool enableConcurrentSweep;
+    bool enableParallelSweep;
 
     uint maxParallelism;        // Max # of total threads to run in parallel
+    uint requestedMaxParallelism; // Host requested maxParallelism, 0 to use the RecyclerMaxParallelism flag
+    volatile LONG activeParallelMarkerCount;
 
     byte backgroundRescanCount;             // for ETW events and stats
     byte backgroundFinishMarkCount;
@@ -992,11 +1025,18 @@ class Recycler
     HANDLE concurrentWorkDoneEvent; // concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
 
-    template <uint parallelId>
-    void ParallelWorkFunc();
+    void ParallelWorkFunc(MarkContext * markContext);
+    bool EnsureParallelMarkContexts();
+    bool StealParallelMarkWork(MarkContext * markContext);
+
+    // Background sweep of the small/medium non-finalizable buckets, spread across the parallel threads
+    RecyclerSweep * parallelSweepWorkers;
+    uint parallelSweepWorkerCount;
+    volatile LONG nextParallelSweepWorker;
+    volatile LONG nextParallelSweepBucket;
 
-    RecyclerParallelThread parallelThread1;
-    RecyclerParallelThread parallelThread2;
+    bool DoParallelSweep(RecyclerSweep& recyclerSweep);
+    void ParallelSweepWorkFunc();
 
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
@@ -1130,6 +1170,10 @@ class Recycler
 #endif
 
     void Prime();
+#if ENABLE_CONCURRENT_GC
+    // Must be called before Initialize; 0 uses the default (see RecyclerMaxParallelism)
+    void SetMaxParallelism(uint maxParallelism) { this->requestedMaxParallelism = maxParallelism; }
+#endif
     void* GetOwnerContext() { return (void*) this->collectionWrapper; }
     PageAllocator * GetPageAllocator() { return threadPageAllocator; }
     bool NeedOOMRescan() const;
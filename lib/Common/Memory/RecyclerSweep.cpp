@@ -320,6 +320,20 @@ RecyclerSweep::GetRecycler() const
     return recycler;
 }
 
+#ifdef RECYCLER_STATS
+RecyclerCollectionStats *
+RecyclerSweep::GetCollectionStats()
+{
+#if ENABLE_CONCURRENT_GC
+    if (this->isParallelSweepWorker)
+    {
+        return &this->parallelSweepStats;
+    }
+#endif
+    return &recycler->collectionStats;
+}
+#endif
+
 bool
 RecyclerSweep::IsBackground() const
 {
@@ -491,6 +505,164 @@ RecyclerSweep::EndBackground()
     this->background = false;
 }
 
+// Parallel sweep gives each worker thread its own RecyclerSweep, so the pending lists and the
+// heuristic counters are never shared between threads. A worker starts off as a copy of the sweep
+// it is helping with (for the per bucket saved state and the partial heuristics it reads), minus
+// anything it accumulates, and is merged back once all the workers are done.
+void
+RecyclerSweep::BeginParallelSweepWorker(RecyclerSweep const& parentSweep)
+{
+    Assert(parentSweep.IsBackground());
+    Assert(!parentSweep.isParallelSweepWorker);
+
+    *this = parentSweep;
+    this->isParallelSweepWorker = true;
+
+    ResetParallelSweepWorkerData<SmallLeafHeapBlock>();
+    ResetParallelSweepWorkerData<SmallNormalHeapBlock>();
+    ResetParallelSweepWorkerData<SmallFinalizableHeapBlock>();
+#ifdef RECYCLER_VISITED_HOST
+    ResetParallelSweepWorkerData<SmallRecyclerVisitedHostHeapBlock>();
+#endif
+#ifdef RECYCLER_WRITE_BARRIER
+    ResetParallelSweepWorkerData<SmallNormalWithBarrierHeapBlock>();
+    ResetParallelSweepWorkerData<SmallFinalizableWithBarrierHeapBlock>();
+#endif
+    ResetParallelSweepWorkerData<MediumLeafHeapBlock>();
+    ResetParallelSweepWorkerData<MediumNormalHeapBlock>();
+    ResetParallelSweepWorkerData<MediumFinalizableHeapBlock>();
+#ifdef RECYCLER_VISITED_HOST
+    ResetParallelSweepWorkerData<MediumRecyclerVisitedHostHeapBlock>();
+#endif
+#ifdef RECYCLER_WRITE_BARRIER
+    ResetParallelSweepWorkerData<MediumNormalWithBarrierHeapBlock>();
+    ResetParallelSweepWorkerData<MediumFinalizableWithBarrierHeapBlock>();
+#endif
+
+    this->hasPendingSweepSmallHeapBlocks = false;
+    this->hasPendingEmptyBlocks = false;
+#ifdef RECYCLER_STATS
+    memset(&this->parallelSweepStats, 0, sizeof(this->parallelSweepStats));
+#endif
+#if ENABLE_PARTIAL_GC
+    this->reuseHeapBlockCount = 0;
+    this->reuseByteCount = 0;
+    this->partialUnusedFreeByteCount = 0;
+    this->parallelSweepBaseUncollectedAllocBytes = this->nextPartialUncollectedAllocBytes;
+    this->parallelSweepPartialUncollectedAllocBytes = 0;
+#endif
+}
+
+void
+RecyclerSweep::MergeParallelSweepWorker(RecyclerSweep& workerSweep)
+{
+    Assert(!this->isParallelSweepWorker);
+    Assert(workerSweep.isParallelSweepWorker);
+
+    MergeParallelSweepWorkerData<SmallLeafHeapBlock>(workerSweep);
+    MergeParallelSweepWorkerData<SmallNormalHeapBlock>(workerSweep);
+    MergeParallelSweepWorkerData<SmallFinalizableHeapBlock>(workerSweep);
+#ifdef RECYCLER_VISITED_HOST
+    MergeParallelSweepWorkerData<SmallRecyclerVisitedHostHeapBlock>(workerSweep);
+#endif
+#ifdef RECYCLER_WRITE_BARRIER
+    MergeParallelSweepWorkerData<SmallNormalWithBarrierHeapBlock>(workerSweep);
+    MergeParallelSweepWorkerData<SmallFinalizableWithBarrierHeapBlock>(workerSweep);
+#endif
+    MergeParallelSweepWorkerData<MediumLeafHeapBlock>(workerSweep);
+    MergeParallelSweepWorkerData<MediumNormalHeapBlock>(workerSweep);
+    MergeParallelSweepWorkerData<MediumFinalizableHeapBlock>(workerSweep);
+#ifdef RECYCLER_VISITED_HOST
+    MergeParallelSweepWorkerData<MediumRecyclerVisitedHostHeapBlock>(workerSweep);
+#endif
+#ifdef RECYCLER_WRITE_BARRIER
+    MergeParallelSweepWorkerData<MediumNormalWithBarrierHeapBlock>(workerSweep);
+    MergeParallelSweepWorkerData<MediumFinalizableWithBarrierHeapBlock>(workerSweep);
+#endif
+
+    this->hasPendingSweepSmallHeapBlocks = this->hasPendingSweepSmallHeapBlocks || workerSweep.hasPendingSweepSmallHeapBlocks;
+    this->hasPendingEmptyBlocks = this->hasPendingEmptyBlocks || workerSweep.hasPendingEmptyBlocks;
+
+#ifdef RECYCLER_STATS
+    // Only the counters updated by the small heap block sweep are ever non zero in a worker
+    RecyclerCollectionStats& stats = recycler->collectionStats;
+    RecyclerCollectionStats const& workerStats = workerSweep.parallelSweepStats;
+    for (uint i = 0; i < HeapBlock::BlockTypeCount; i++)
+    {
+        stats.heapBlockCount[i] += workerStats.heapBlockCount[i];
+        stats.heapBlockFreeByteCount[i] += workerStats.heapBlockFreeByteCount[i];
+    }
+    for (uint i = 0; i < HeapBlock::SmallBlockTypeCount; i++)
+    {
+        stats.heapBlockSweptCount[i] += workerStats.heapBlockSweptCount[i];
+        stats.heapBlockConcurrentSweptCount[i] += workerStats.heapBlockConcurrentSweptCount[i];
+        stats.numEmptySmallBlocks[i] += workerStats.numEmptySmallBlocks[i];
+#if ENABLE_PARTIAL_GC
+        stats.smallNonLeafHeapBlockPartialReuseCount[i] += workerStats.smallNonLeafHeapBlockPartialReuseCount[i];
+        stats.smallNonLeafHeapBlockPartialReuseBytes[i] += workerStats.smallNonLeafHeapBlockPartialReuseBytes[i];
+        stats.smallNonLeafHeapBlockPartialUnusedCount[i] += workerStats.smallNonLeafHeapBlockPartialUnusedCount[i];
+        stats.smallNonLeafHeapBlockPartialUnusedBytes[i] += workerStats.smallNonLeafHeapBlockPartialUnusedBytes[i];
+#endif
+    }
+    stats.numZeroedOutSmallBlocks += workerStats.numZeroedOutSmallBlocks;
+#endif
+
+#if ENABLE_PARTIAL_GC
+    this->reuseHeapBlockCount += workerSweep.reuseHeapBlockCount;
+    this->reuseByteCount += workerSweep.reuseByteCount;
+    this->partialUnusedFreeByteCount += workerSweep.partialUnusedFreeByteCount;
+
+    // The worker both adds (new objects on allocable blocks) and subtracts (new objects swept), so merge the net change
+    this->nextPartialUncollectedAllocBytes += workerSweep.nextPartialUncollectedAllocBytes - workerSweep.parallelSweepBaseUncollectedAllocBytes;
+    recycler->partialUncollectedAllocBytes += workerSweep.parallelSweepPartialUncollectedAllocBytes;
+#endif
+}
+
+template <typename TBlockType>
+void
+RecyclerSweep::ResetParallelSweepWorkerData()
+{
+    Data<TBlockType>& data = this->GetData<TBlockType>();
+    Assert(data.pendingMergeNewHeapBlockList == nullptr);
+    for (uint i = 0; i < TBlockType::HeapBlockAttributes::BucketCount; i++)
+    {
+        // These belong to the buckets that were swept before the workers started
+        data.bucketData[i].pendingSweepList = nullptr;
+        data.bucketData[i].pendingFinalizableSweptList = nullptr;
+        data.bucketData[i].pendingEmptyBlockList = nullptr;
+        data.bucketData[i].pendingEmptyBlockListTail = nullptr;
+    }
+}
+
+template <typename TBlockType>
+void
+RecyclerSweep::MergeParallelSweepWorkerData(RecyclerSweep& workerSweep)
+{
+    Data<TBlockType>& data = this->GetData<TBlockType>();
+    Data<TBlockType>& workerData = workerSweep.GetData<TBlockType>();
+    for (uint i = 0; i < TBlockType::HeapBlockAttributes::BucketCount; i++)
+    {
+        // Each bucket is swept by a single worker, so at most one of them has anything for it
+        BucketData<TBlockType>& bucketData = data.bucketData[i];
+        BucketData<TBlockType>& workerBucketData = workerData.bucketData[i];
+        if (workerBucketData.pendingSweepList != nullptr)
+        {
+            Assert(bucketData.pendingSweepList == nullptr);
+            bucketData.pendingSweepList = workerBucketData.pendingSweepList;
+            workerBucketData.pendingSweepList = nullptr;
+        }
+        Assert(workerBucketData.pendingFinalizableSweptList == nullptr);
+        if (workerBucketData.pendingEmptyBlockList != nullptr)
+        {
+            Assert(bucketData.pendingEmptyBlockList == nullptr);
+            bucketData.pendingEmptyBlockList = workerBucketData.pendingEmptyBlockList;
+            bucketData.pendingEmptyBlockListTail = workerBucketData.pendingEmptyBlockListTail;
+            workerBucketData.pendingEmptyBlockList = nullptr;
+            workerBucketData.pendingEmptyBlockListTail = nullptr;
+        }
+    }
+}
+
 #if DBG
 bool
 RecyclerSweep::HasPendingNewHeapBlocks() const
@@ -610,7 +782,17 @@ RecyclerSweep::AddUnaccountedNewObjectAllocBytes(SmallHeapBlockT<TBlockAttribute
         uint unaccountedAllocBytes = heapBlock->GetAndClearUnaccountedAllocBytes();
         Assert(heapBlock->lastUncollectedAllocBytes == 0 || unaccountedAllocBytes == 0);
         DebugOnly(heapBlock->lastUncollectedAllocBytes += unaccountedAllocBytes);
-        recycler->partialUncollectedAllocBytes += unaccountedAllocBytes;
+#if ENABLE_CONCURRENT_GC
+        if (this->isParallelSweepWorker)
+        {
+            // Other workers are sweeping too; this is added to the recycler when the workers are merged
+            this->parallelSweepPartialUncollectedAllocBytes += unaccountedAllocBytes;
+        }
+        else
+#endif
+        {
+            recycler->partialUncollectedAllocBytes += unaccountedAllocBytes;
+        }
         this->nextPartialUncollectedAllocBytes += unaccountedAllocBytes;
     }
     else
@@ -23,6 +23,9 @@ class RecyclerSweep
     void ShutdownCleanup();
 
     Recycler * GetRecycler() const;
+#ifdef RECYCLER_STATS
+    RecyclerCollectionStats * GetCollectionStats();
+#endif
     bool IsBackground() const;
     bool HasSetupBackgroundSweep() const;
     void FlushPendingTransferDisposedObjects();
@@ -40,6 +43,9 @@ class RecyclerSweep
     void BeginBackground(bool forceForeground);
     void EndBackground();
 
+    void BeginParallelSweepWorker(RecyclerSweep const& parentSweep);
+    void MergeParallelSweepWorker(RecyclerSweep& workerSweep);
+
     template <typename TBlockType> void SetPendingMergeNewHeapBlockList(TBlockType * heapBlockList);
     template <typename TBlockType> void MergePendingNewHeapBlockList();
     template <typename TBlockType> void MergePendingNewMediumHeapBlockList();
@@ -119,6 +125,10 @@ class RecyclerSweep
     };
 
     template <typename TBlockType> Data<TBlockType>& GetData();
+#if ENABLE_CONCURRENT_GC
+    template <typename TBlockType> void ResetParallelSweepWorkerData();
+    template <typename TBlockType> void MergeParallelSweepWorkerData(RecyclerSweep& workerSweep);
+#endif
     template <> Data<SmallLeafHeapBlock>& GetData<SmallLeafHeapBlock>() { return leafData; }
     template <> Data<SmallNormalHeapBlock>& GetData<SmallNormalHeapBlock>() { return normalData; }
     template <> Data<SmallFinalizableHeapBlock>& GetData<SmallFinalizableHeapBlock>() { return finalizableData; }
@@ -171,6 +181,13 @@ class RecyclerSweep
     bool hasPendingSweepSmallHeapBlocks;
     bool hasPendingEmptyBlocks;
     bool inPartialCollect;
+#if ENABLE_CONCURRENT_GC
+    bool isParallelSweepWorker;
+#ifdef RECYCLER_STATS
+    // Parallel sweep worker only: the sweep stats, added to the recycler's once the workers are merged
+    RecyclerCollectionStats parallelSweepStats;
+#endif
+#endif
 #if ENABLE_PARTIAL_GC
     bool adjustPartialHeuristics;
     size_t lastPartialUncollectedAllocBytes;
@@ -187,6 +204,13 @@ class RecyclerSweep
     // Data to update unusedPartialCollectFreeBytes
     size_t partialUnusedFreeByteCount;
 
+#if ENABLE_CONCURRENT_GC
+    // Parallel sweep worker only: nextPartialUncollectedAllocBytes when the worker started, and the bytes
+    // to add to recycler->partialUncollectedAllocBytes once the workers are merged
+    size_t parallelSweepBaseUncollectedAllocBytes;
+    size_t parallelSweepPartialUncollectedAllocBytes;
+#endif
+
 #if DBG
     bool partial;
 #endif
@@ -401,8 +401,8 @@ SmallNormalHeapBucketBase<TBlockType>::SweepPartialReusePages(RecyclerSweep& rec
                 reuseBlocklist = heapBlock;
             }
 
-            RECYCLER_STATS_ADD(recyclerSweep.GetRecycler(), smallNonLeafHeapBlockPartialReuseBytes[heapBlock->GetHeapBlockType()], expectFreeByteCount);
-            RECYCLER_STATS_INC(recyclerSweep.GetRecycler(), smallNonLeafHeapBlockPartialReuseCount[heapBlock->GetHeapBlockType()]);
+            RECYCLER_SWEEP_STATS_ADD(recyclerSweep, smallNonLeafHeapBlockPartialReuseBytes[heapBlock->GetHeapBlockType()], expectFreeByteCount);
+            RECYCLER_SWEEP_STATS_INC(recyclerSweep, smallNonLeafHeapBlockPartialReuseCount[heapBlock->GetHeapBlockType()]);
         }
         else
         {
@@ -414,8 +414,8 @@ SmallNormalHeapBucketBase<TBlockType>::SweepPartialReusePages(RecyclerSweep& rec
             unusedBlockList = heapBlock;
 
             recyclerSweep.AddUnusedFreeByteCount(expectFreeByteCount);
-            RECYCLER_STATS_ADD(recyclerSweep.GetRecycler(), smallNonLeafHeapBlockPartialUnusedBytes[heapBlock->GetHeapBlockType()], expectFreeByteCount);
-            RECYCLER_STATS_INC(recyclerSweep.GetRecycler(), smallNonLeafHeapBlockPartialUnusedCount[heapBlock->GetHeapBlockType()]);
+            RECYCLER_SWEEP_STATS_ADD(recyclerSweep, smallNonLeafHeapBlockPartialUnusedBytes[heapBlock->GetHeapBlockType()], expectFreeByteCount);
+            RECYCLER_SWEEP_STATS_INC(recyclerSweep, smallNonLeafHeapBlockPartialUnusedCount[heapBlock->GetHeapBlockType()]);
         }
     });
 }
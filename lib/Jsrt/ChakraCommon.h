@@ -230,6 +230,11 @@ typedef unsigned short uint16_t;
         /// </summary>
         JsNoWeakRefRequired,
         /// <summary>
+        ///     The callback passed to JsSerializeWithCallback returned false, so the serialized script was not
+        ///     written in full.
+        /// </summary>
+        JsErrorSerializeCallbackFailed,
+        /// <summary>
         ///     Category of errors that relates to errors occurring within the engine itself.
         /// </summary>
         JsErrorCategoryEngine = 0x20000,
@@ -450,6 +455,24 @@ typedef unsigned short uint16_t;
         ///     Disable Failfast fatal error on OOM
         /// </summary>
         JsRuntimeAttributeDisableFatalOnOOM = 0x00000080,
+        /// <summary>
+        ///     Runtime will redefer functions that have not run for a few garbage collections, dropping
+        ///     their byte code, inline caches and profile data until they are called again. Intended for
+        ///     long running hosts that load much more script than they keep running.
+        /// </summary>
+        JsRuntimeAttributeReclaimColdFunctions = 0x00000100,
+        /// <summary>
+        ///     Runtime will keep the byte code of <c>Function</c> constructor bodies and indirect
+        ///     <c>eval</c> code compiled more than once, so that any context of the runtime compiling the
+        ///     same text again can reuse it instead of parsing it.
+        /// </summary>
+        JsRuntimeAttributeEnableDynamicCodeCache = 0x00000200,
+        /// <summary>
+        ///     Bits 16-22 hold the maximum number of threads (including the thread doing the collection)
+        ///     the garbage collector uses to mark in parallel, e.g. <c>(8 &lt;&lt; 16)</c>. Zero uses the
+        ///     default; the count is capped at 64 and at the number of processors.
+        /// </summary>
+        JsRuntimeAttributeParallelMarkThreadCountMask = 0x007F0000,
 
     } JsRuntimeAttributes;
 
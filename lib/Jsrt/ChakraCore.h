@@ -309,6 +309,19 @@ typedef bool (CHAKRA_CALLBACK * JsSerializedLoadScriptCallback)
     (JsSourceContext sourceContext, _Out_ JsValueRef *value,
     _Out_ JsParseScriptAttributes *parseAttributes);
 
+/// <summary>
+///     Called by the runtime with the next part of a serialized script.
+/// </summary>
+/// <param name="data">The next bytes of the serialized script. Only valid during the call.</param>
+/// <param name="byteCount">The number of bytes in data.</param>
+/// <param name="callbackState">The state passed to <c>JsSerializeWithCallback</c>.</param>
+/// <returns>
+///     true if the operation succeeded, false to stop serializing.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK * JsSerializedScriptWriteCallback)
+    (_In_reads_bytes_(byteCount) const unsigned char *data, _In_ unsigned int byteCount,
+    _In_opt_ void *callbackState);
+
 /// <summary>
 ///     Create JavascriptString variable from ASCII or Utf8 string
 /// </summary>
@@ -569,6 +582,34 @@ CHAKRA_API
         _Out_ JsValueRef *buffer,
         _In_ JsParseScriptAttributes parseAttributes);
 
+/// <summary>
+///     Serializes a parsed script, handing the serialized form to a callback a part at a time.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Produces the same bytes as <c>JsSerialize</c>, but never holds the whole serialized script in
+///     memory, so the host can write large scripts straight to a file. The parts are passed in order
+///     and are at most 64KB each.
+///     </para>
+/// </remarks>
+/// <param name="script">The script to serialize</param>
+/// <param name="writeCallback">Callback called with each part of the serialized script.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="parseAttributes">Encoding for the script.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorSerializeCallbackFailed</c> if
+///     <c>writeCallback</c> returned false, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSerializeWithCallback(
+        _In_ JsValueRef script,
+        _In_ JsSerializedScriptWriteCallback writeCallback,
+        _In_opt_ void *callbackState,
+        _In_ JsParseScriptAttributes parseAttributes);
+
 /// <summary>
 ///     Parses a serialized script and returns a function representing the script.
 ///     Provides the ability to lazy load the script source only if/when it is needed.
@@ -577,6 +618,11 @@ CHAKRA_API
 ///     <para>
 ///     Requires an active script context.
 ///     </para>
+///     <para>
+///     Functions are only read from the buffer when they are first called. A host that creates the
+///     ExternalArrayBuffer over a read-only mapping of a file written by <c>JsSerializeWithCallback</c>
+///     only pages in the parts of the script that run.
+///     </para>
 /// </remarks>
 /// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
 /// <param name="scriptLoadCallback">
@@ -1036,5 +1082,196 @@ CHAKRA_API
     JsSetHostPromiseRejectionTracker(
         _In_ JsHostPromiseRejectionTrackerCallback promiseRejectionTrackerCallback, 
         _In_opt_ void *callbackState);
+
+/// <summary>
+///     Serializes the execution profiles the engine has collected for the scripts run in the current
+///     script context, so that a later process can start from them instead of re-learning them.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Only scripts run with a source context other than <c>JS_SOURCE_CONTEXT_NONE</c> are included, and the
+///     host must use the same source context for the same script when it runs it again. The data is specific
+///     to the engine build that produced it.
+///     </para>
+/// </remarks>
+/// <param name="buffer">An ArrayBuffer holding the serialized profile data.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorOutOfMemory</c> if the buffer could not
+///     be allocated or sized, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSerializeProfileData(
+        _Out_ JsValueRef *buffer);
+
+/// <summary>
+///     Seeds the current script context with profile data produced by <c>JsSerializeProfileData</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Should be called before the scripts the profile data was collected on are run. Functions that pick up
+///     a profile start from its type information; those that were hot when the data was recorded are also
+///     scheduled for full JIT on their first call. Profiles that no longer match their function (because the
+///     script changed) are ignored. Corrupt data is rejected as a whole and leaves the script context unchanged.
+///     </para>
+///     <para>
+///     Value types and built-in callee ids are validated, but a well formed profile still decides how functions
+///     are specialized. Only pass data produced by <c>JsSerializeProfileData</c> and stored where other parties
+///     cannot modify it.
+///     </para>
+/// </remarks>
+/// <param name="buffer">An ArrayBuffer holding the serialized profile data.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the data is
+///     corrupt or was produced by a different engine build, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetProfileData(
+        _In_ JsValueRef buffer);
+
+/// <summary>
+///     A handle to a script compile started with <c>JsParseScriptAsync</c>.
+/// </summary>
+typedef void *JsParseScriptAsyncTask;
+
+/// <summary>
+///     Called by the runtime when the background compile started by <c>JsParseScriptAsync</c> is done.
+/// </summary>
+/// <remarks>
+///     The callback is called exactly once per task, before <c>JsParseScriptAsyncResult</c> returns for it,
+///     unless the task is canceled with <c>JsParseScriptAsyncCancel</c> before it runs. It is usually invoked on the background thread that did the compile, but can also be invoked on the
+///     calling thread from <c>JsParseScriptAsync</c> or <c>JsParseScriptAsyncResult</c>. It must not call into
+///     the runtime; the host is expected to post the task back to the thread that owns the script context and
+///     call <c>JsParseScriptAsyncResult</c> there.
+/// </remarks>
+/// <param name="task">The task that completed.</param>
+/// <param name="callbackState">The state passed to <c>JsParseScriptAsync</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsParseScriptAsyncCallback)(_In_ JsParseScriptAsyncTask task, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Starts parsing and generating byte code for a script on a background thread.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The compile is queued to a background thread of the runtime's own, separate from its background JIT
+///     work, so the calling thread is free to keep running script. It uses a private runtime created with the
+///     attributes of the current runtime that affect compilation, which is kept for the runtime's later compiles.
+///     If the runtime was created with <c>JsRuntimeAttributeDisableBackgroundWork</c>, the callback is called
+///     right away and <c>JsParseScriptAsyncResult</c> compiles the script on the calling thread.
+///     </para>
+///     <para>
+///     The runtime holds on to <c>script</c> until the task is either taken with <c>JsParseScriptAsyncResult</c>
+///     or freed with <c>JsParseScriptAsyncCancel</c>. Exactly one of the two must be called, on the thread that
+///     owns the current script context, before the context is disposed. An ArrayBuffer script is copied, so the
+///     host may change or detach it after this returns.
+///     </para>
+///     <para>
+///         Script source can be either JavascriptString or JavascriptExternalArrayBuffer.
+///         In case it is an ExternalArrayBuffer, and the encoding of the buffer is Utf16,
+///         JsParseScriptAttributeArrayBufferIsUtf16Encoded is expected on parseAttributes.
+///     </para>
+/// </remarks>
+/// <param name="script">The script to parse.</param>
+/// <param name="parseAttributes">Attribute mask for parsing the script</param>
+/// <param name="callback">Called once the compile is done, usually on a background thread.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="task">A handle to pass to <c>JsParseScriptAsyncResult</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsParseScriptAsync(
+        _In_ JsValueRef script,
+        _In_ JsParseScriptAttributes parseAttributes,
+        _In_ JsParseScriptAsyncCallback callback,
+        _In_opt_ void *callbackState,
+        _Out_ JsParseScriptAsyncTask *task);
+
+/// <summary>
+///     Returns a function representing the script compiled by a <c>JsParseScriptAsync</c> task.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires the script context that was current when the task was started.
+///     </para>
+///     <para>
+///     Blocks if the background compile hasn't completed yet. If it failed, for example because the script
+///     has a syntax error, the script is parsed again on the calling thread so that the error is reported the
+///     same way <c>JsParse</c> reports it. The task handle is invalid once this returns, except when it
+///     returns <c>JsErrorNullArgument</c>, <c>JsErrorNoCurrentContext</c>, <c>JsErrorWrongRuntime</c> or
+///     <c>JsErrorInvalidArgument</c> because <c>sourceUrl</c> isn't a string.
+///     </para>
+/// </remarks>
+/// <param name="task">The task returned by <c>JsParseScriptAsync</c>.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="result">A function representing the script code.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsParseScriptAsyncResult(
+        _In_ JsParseScriptAsyncTask task,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Frees a <c>JsParseScriptAsync</c> task whose result isn't needed.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires the script context that was current when the task was started.
+///     </para>
+///     <para>
+///     A compile that hasn't started yet is dropped, and its callback isn't called. A compile that is running is
+///     waited for. Either way the callback isn't called after this returns. The task handle is invalid once this
+///     returns <c>JsNoError</c>.
+///     </para>
+/// </remarks>
+/// <param name="task">The task returned by <c>JsParseScriptAsync</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsParseScriptAsyncCancel(
+        _In_ JsParseScriptAsyncTask task);
+
+/// <summary>
+///     Gets the number of functions the runtime has redeferred, and an estimate of the memory that
+///     was released by redeferring them.
+/// </summary>
+/// <remarks>
+///     <para>
+///     A redeferred function drops its byte code, inline caches, profile data and native code entry
+///     points, and is parsed again the next time it is called. The counts are totals over the lifetime
+///     of the runtime. Create the runtime with <c>JsRuntimeAttributeReclaimColdFunctions</c> to
+///     redefer functions as soon as they have been unused for a few garbage collections.
+///     </para>
+///     <para>
+///     This API is not thread safe, and must only be called when the runtime is not running script.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to query.</param>
+/// <param name="redeferredFunctionCount">The number of functions redeferred so far.</param>
+/// <param name="reclaimedBytes">The approximate number of bytes released by redeferral so far.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeRedeferralStats(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ size_t *redeferredFunctionCount,
+        _Out_ size_t *reclaimedBytes);
 #endif // _CHAKRACOREBUILD
 #endif // _CHAKRACORE_H_
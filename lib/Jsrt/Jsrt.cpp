@@ -9,6 +9,9 @@
 #include "jsrtHelper.h"
 
 #include "JsrtSourceHolder.h"
+#include "DataStructures/Option.h"
+#include "DataStructures/ImmutableList.h"
+#include "DataStructures/BufferBuilder.h"
 #include "ByteCode/ByteCodeSerializer.h"
 #include "Common/ByteSwap.h"
 #include "Library/DataView.h"
@@ -281,7 +284,10 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeEnableExperimentalFeatures |
             JsRuntimeAttributeDispatchSetExceptionsToDebugger |
-            JsRuntimeAttributeDisableFatalOnOOM
+            JsRuntimeAttributeDisableFatalOnOOM |
+            JsRuntimeAttributeReclaimColdFunctions |
+            JsRuntimeAttributeEnableDynamicCodeCache |
+            JsRuntimeAttributeParallelMarkThreadCountMask
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -338,6 +344,21 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             threadContext->SetThreadContextFlag(ThreadContextFlagDisableFatalOnOOM);
         }
 
+        if (attributes & JsRuntimeAttributeReclaimColdFunctions)
+        {
+            threadContext->EnableColdFunctionReclaim(CONFIG_FLAG(ReclaimColdFunctionsGCCount));
+        }
+
+        if (attributes & JsRuntimeAttributeEnableDynamicCodeCache)
+        {
+            threadContext->EnableDynamicCodeCache(CONFIG_FLAG(DynamicCodeCacheSize) * 1024);
+        }
+
+        if (attributes & JsRuntimeAttributeParallelMarkThreadCountMask)
+        {
+            threadContext->SetRecyclerMaxParallelism((attributes & JsRuntimeAttributeParallelMarkThreadCountMask) >> 16);
+        }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.PrimeRecycler)
         {
@@ -348,7 +369,7 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
         bool enableIdle = (attributes & JsRuntimeAttributeEnableIdleProcessing) == JsRuntimeAttributeEnableIdleProcessing;
         bool dispatchExceptions = (attributes & JsRuntimeAttributeDispatchSetExceptionsToDebugger) == JsRuntimeAttributeDispatchSetExceptionsToDebugger;
 
-        JsrtRuntime * runtime = HeapNew(JsrtRuntime, threadContext, enableIdle, dispatchExceptions);
+        JsrtRuntime * runtime = HeapNew(JsrtRuntime, threadContext, attributes, enableIdle, dispatchExceptions);
         threadContext->SetCurrentThreadId(ThreadContext::NoThread);
         *runtimeHandle = runtime->ToHandle();
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -480,6 +501,11 @@ CHAKRA_API JsDisposeRuntime(_In_ JsRuntimeHandle runtimeHandle)
             return JsErrorInThreadServiceCallback;
         }
 
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+        // Stop the JsParseScriptAsync thread and dispose of the runtime it compiles in
+        runtime->CloseParseScriptAsync(true);
+#endif
+
         // Invoke and clear the callbacks while the contexts and runtime are still available
         {
             Recycler* recycler = threadContext->GetRecycler();
@@ -3170,6 +3196,20 @@ CHAKRA_API JsGetRuntimeMemoryUsage(_In_ JsRuntimeHandle runtimeHandle, _Out_ siz
     return JsNoError;
 }
 
+CHAKRA_API JsGetRuntimeRedeferralStats(_In_ JsRuntimeHandle runtimeHandle, _Out_ size_t * redeferredFunctionCount, _Out_ size_t * reclaimedBytes)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(redeferredFunctionCount);
+    PARAM_NOT_NULL(reclaimedBytes);
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+    *redeferredFunctionCount = threadContext->GetRedeferredFunctionCount();
+    *reclaimedBytes = threadContext->GetRedeferredFunctionBytes();
+
+    return JsNoError;
+}
+
 CHAKRA_API JsSetRuntimeMemoryLimit(_In_ JsRuntimeHandle runtimeHandle, _In_ size_t memoryLimit)
 {
     VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
@@ -3684,7 +3724,8 @@ CHAKRA_API JsExperimentalApiRunModule(_In_z_ const WCHAR * script,
 
 JsErrorCode JsSerializeScriptCore(const byte *script, size_t cb,
     LoadScriptFlag loadScriptFlag, BYTE *functionTable, int functionTableSize,
-    unsigned char *buffer, unsigned int *bufferSize, JsValueRef scriptSource)
+    unsigned char *buffer, unsigned int *bufferSize, JsValueRef scriptSource,
+    Js::BufferBuilderSink *sink = nullptr)
 {
     Js::JavascriptFunction *function;
     CompileScriptException se;
@@ -3775,16 +3816,32 @@ JsErrorCode JsSerializeScriptCore(const byte *script, size_t cb,
         // We cast buffer size to DWORD* because on Windows, DWORD = unsigned long = unsigned int
         // On 64-bit clang on linux, this is not true, unsigned long is larger than unsigned int
         // However, the PAL defines DWORD for us on linux as unsigned int so the cast is safe here.
-        HRESULT hr = Js::ByteCodeSerializer::SerializeToBuffer(scriptContext,
-            tempAllocator, static_cast<DWORD>(cSourceCodeLength), utf8Code,
-            functionBody, functionBody->GetHostSrcInfo(), false, &buffer,
-            (DWORD*) bufferSize, dwFlags);
+        HRESULT hr;
+        if (sink != nullptr)
+        {
+            hr = Js::ByteCodeSerializer::SerializeToSink(scriptContext,
+                tempAllocator, static_cast<DWORD>(cSourceCodeLength), utf8Code,
+                functionBody, functionBody->GetHostSrcInfo(), sink,
+                (DWORD*) bufferSize, dwFlags);
+        }
+        else
+        {
+            hr = Js::ByteCodeSerializer::SerializeToBuffer(scriptContext,
+                tempAllocator, static_cast<DWORD>(cSourceCodeLength), utf8Code,
+                functionBody, functionBody->GetHostSrcInfo(), false, &buffer,
+                (DWORD*) bufferSize, dwFlags);
+        }
         END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
 
         if (SUCCEEDED(hr))
         {
             return JsNoError;
         }
+        else if (hr == E_ABORT)
+        {
+            // The host's write callback failed
+            return JsErrorSerializeCallbackFailed;
+        }
         else
         {
             return JsErrorScriptCompile;
@@ -4964,17 +5021,9 @@ CHAKRA_API JsCopyPropertyId(
     return JsNoError;
 }
 
-CHAKRA_API JsSerialize(
-    _In_ JsValueRef scriptVal,
-    _Out_ JsValueRef *bufferVal,
-    _In_ JsParseScriptAttributes parseAttributes)
+static JsErrorCode GetSerializeScriptSource(JsValueRef scriptVal, JsParseScriptAttributes parseAttributes,
+    const byte **script, size_t *cb, LoadScriptFlag *scriptFlag)
 {
-    PARAM_NOT_NULL(scriptVal);
-    PARAM_NOT_NULL(bufferVal);
-    VALIDATE_JSREF(scriptVal);
-
-    *bufferVal = nullptr;
-
     bool isExternalArray = Js::ExternalArrayBuffer::Is(scriptVal),
          isString = false;
     bool isUtf8   = !(parseAttributes & JsParseScriptAttributeArrayBufferIsUtf16Encoded);
@@ -4987,29 +5036,51 @@ CHAKRA_API JsSerialize(
         }
     }
 
-    LoadScriptFlag scriptFlag;
-    const byte* script = isExternalArray ?
+    *script = isExternalArray ?
         ((Js::ExternalArrayBuffer*)(scriptVal))->GetBuffer() :
         (const byte*)((Js::JavascriptString*)(scriptVal))->GetSz();
-    const size_t cb = isExternalArray ?
+    *cb = isExternalArray ?
         ((Js::ExternalArrayBuffer*)(scriptVal))->GetByteLength() :
         ((Js::JavascriptString*)(scriptVal))->GetLength();
 
     if (isExternalArray && isUtf8)
     {
-        scriptFlag = (LoadScriptFlag) (LoadScriptFlag_ExternalArrayBuffer | LoadScriptFlag_Utf8Source);
+        *scriptFlag = (LoadScriptFlag) (LoadScriptFlag_ExternalArrayBuffer | LoadScriptFlag_Utf8Source);
     }
     else if (isUtf8)
     {
-        scriptFlag = (LoadScriptFlag) (LoadScriptFlag_Utf8Source);
+        *scriptFlag = (LoadScriptFlag) (LoadScriptFlag_Utf8Source);
     }
     else
     {
-        scriptFlag = LoadScriptFlag_None;
+        *scriptFlag = LoadScriptFlag_None;
+    }
+
+    return JsNoError;
+}
+
+CHAKRA_API JsSerialize(
+    _In_ JsValueRef scriptVal,
+    _Out_ JsValueRef *bufferVal,
+    _In_ JsParseScriptAttributes parseAttributes)
+{
+    PARAM_NOT_NULL(scriptVal);
+    PARAM_NOT_NULL(bufferVal);
+    VALIDATE_JSREF(scriptVal);
+
+    *bufferVal = nullptr;
+
+    const byte *script;
+    size_t cb;
+    LoadScriptFlag scriptFlag;
+    JsErrorCode errorCode = GetSerializeScriptSource(scriptVal, parseAttributes, &script, &cb, &scriptFlag);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
     }
 
     unsigned int bufferSize = 0;
-    JsErrorCode errorCode = JsSerializeScriptCore(script, cb, scriptFlag, nullptr,
+    errorCode = JsSerializeScriptCore(script, cb, scriptFlag, nullptr,
         0, nullptr, &bufferSize, scriptVal);
 
     if (errorCode != JsNoError)
@@ -5032,6 +5103,47 @@ CHAKRA_API JsSerialize(
     return errorCode;
 }
 
+class JsrtSerializedScriptSink : public Js::BufferBuilderSink
+{
+public:
+    JsrtSerializedScriptSink(JsSerializedScriptWriteCallback writeCallback, void *callbackState)
+        : writeCallback(writeCallback), callbackState(callbackState) { }
+
+    HRESULT Write(const byte * content, uint32 size) override
+    {
+        return writeCallback(content, size, callbackState) ? S_OK : E_ABORT;
+    }
+
+private:
+    JsSerializedScriptWriteCallback writeCallback;
+    void *callbackState;
+};
+
+CHAKRA_API JsSerializeWithCallback(
+    _In_ JsValueRef scriptVal,
+    _In_ JsSerializedScriptWriteCallback writeCallback,
+    _In_opt_ void *callbackState,
+    _In_ JsParseScriptAttributes parseAttributes)
+{
+    PARAM_NOT_NULL(scriptVal);
+    PARAM_NOT_NULL(writeCallback);
+    VALIDATE_JSREF(scriptVal);
+
+    const byte *script;
+    size_t cb;
+    LoadScriptFlag scriptFlag;
+    JsErrorCode errorCode = GetSerializeScriptSource(scriptVal, parseAttributes, &script, &cb, &scriptFlag);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    JsrtSerializedScriptSink sink(writeCallback, callbackState);
+    unsigned int bufferSize = 0;
+    return JsSerializeScriptCore(script, cb, scriptFlag, nullptr,
+        0, nullptr, &bufferSize, scriptVal, &sink);
+}
+
 CHAKRA_API JsParseSerialized(
     _In_ JsValueRef bufferVal,
     _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
@@ -5343,4 +5455,469 @@ CHAKRA_API JsSetHostPromiseRejectionTracker(_In_ JsHostPromiseRejectionTrackerCa
     /*allowInObjectBeforeCollectCallback*/true);
 }
 
+CHAKRA_API JsSerializeProfileData(_Out_ JsValueRef *buffer)
+{
+    PARAM_NOT_NULL(buffer);
+    *buffer = nullptr;
+
+#if ENABLE_PROFILE_INFO
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        // Allocating the buffer may collect scripts that are no longer referenced, which usually only shrinks the
+        // data; the reader ignores anything after the last profile. Should the data have grown in between anyway,
+        // size it again.
+        const uint maxAttempts = 3;
+        for (uint attempt = 0; attempt < maxAttempts; attempt++)
+        {
+            size_t byteLength = Js::SourceDynamicProfileManager::GetSerializedProfileDataSize(scriptContext);
+            if (byteLength > UINT32_MAX)
+            {
+                Js::Throw::OutOfMemory();
+            }
+
+            Js::ArrayBuffer* arrayBuffer = scriptContext->GetLibrary()->CreateArrayBuffer((uint32)byteLength);
+            if (Js::SourceDynamicProfileManager::SerializeProfileData(scriptContext, (char *)arrayBuffer->GetBuffer(), byteLength))
+            {
+                *buffer = arrayBuffer;
+                return JsNoError;
+            }
+        }
+
+        // The data kept growing faster than it could be sized, which only happens under allocation pressure
+        return JsErrorOutOfMemory;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API JsSetProfileData(_In_ JsValueRef buffer)
+{
+    VALIDATE_JSREF(buffer);
+
+#if ENABLE_PROFILE_INFO
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(buffer, scriptContext);
+
+        if (!Js::ArrayBuffer::Is(buffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer* arrayBuffer = Js::ArrayBuffer::FromVar(buffer);
+        if (!Js::SourceDynamicProfileManager::DeserializeProfileData(scriptContext,
+            (char const *)arrayBuffer->GetBuffer(), arrayBuffer->GetByteLength()))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+class JsrtParseScriptAsyncJob;
+#endif
+
+// State of a JsParseScriptAsync compile. Allocated when the compile is started and freed by JsParseScriptAsyncResult
+// or JsParseScriptAsyncCancel.
+struct JsrtParseScriptAsyncTask
+{
+    JsrtContext * context;
+    JsrtRuntime * runtime;
+    JsValueRef script;                          // Rooted until the result is taken
+    JsValueRef source;                          // What JsParseScriptAsyncResult loads; set there
+    const byte * scriptBuffer;
+    byte * scriptCopy;                          // malloc'ed copy of an ArrayBuffer script, which can change or be detached
+    unsigned int scriptByteLength;
+    JsParseScriptAttributes parseAttributes;
+    JsParseScriptAsyncCallback callback;
+    void * callbackState;
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    JsrtParseScriptAsyncJob * job;              // Null if there is no background thread to compile on
+#endif
+
+    // Written by the job before it calls the callback
+    JsErrorCode compileResult;
+    byte * byteCode;                            // malloc'ed, so it can be handed over to an external ArrayBuffer
+    unsigned int byteCodeLength;
+};
+
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+static JsErrorCode EnsurePrivateRuntimeContext(JsrtRuntime *owner, JsContextRef *context)
+{
+    *context = owner->GetParseScriptAsyncContext();
+    if (*context != JS_INVALID_REFERENCE)
+    {
+        return JsNoError;
+    }
+
+    // The byte code serializer only depends on process-wide state (built-in property ids, config flags), so the
+    // buffer produced by another runtime can be loaded into the owning runtime. Carry over the attributes that
+    // change how script compiles. Running out of memory here only means the script is compiled on the owning
+    // thread instead, so it mustn't be fatal.
+    const JsRuntimeAttributes compileAttributes = (JsRuntimeAttributes)(
+        JsRuntimeAttributeEnableExperimentalFeatures |
+        JsRuntimeAttributeDisableEval
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        | JsRuntimeAttributeSerializeLibraryByteCode
+#endif
+        );
+
+    JsRuntimeHandle runtime;
+    JsErrorCode errorCode = JsCreateRuntime(
+        (JsRuntimeAttributes)((owner->GetAttributes() & compileAttributes) |
+            JsRuntimeAttributeDisableBackgroundWork | JsRuntimeAttributeDisableNativeCodeGeneration | JsRuntimeAttributeDisableFatalOnOOM),
+        nullptr, &runtime);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    // Kept for the next compiles, until the owning runtime is disposed
+    errorCode = JsCreateContext(runtime, context);
+    if (errorCode == JsNoError)
+    {
+        errorCode = JsAddRef(*context, nullptr);
+    }
+    if (errorCode != JsNoError)
+    {
+        JsDisposeRuntime(runtime);
+        return errorCode;
+    }
+
+    owner->SetParseScriptAsyncContext(runtime, *context);
+    return JsNoError;
+}
+
+static JsErrorCode SerializeScriptInPrivateRuntime(JsrtParseScriptAsyncTask *task)
+{
+    JsContextRef context;
+    JsErrorCode errorCode = EnsurePrivateRuntimeContext(task->runtime, &context);
+    if (errorCode == JsNoError)
+    {
+        errorCode = JsSetCurrentContext(context);
+    }
+
+    if (errorCode == JsNoError)
+    {
+        JsValueRef script;
+        JsValueRef buffer;
+        errorCode = JsCreateExternalArrayBuffer((void *)task->scriptBuffer, task->scriptByteLength, nullptr, nullptr, &script);
+        if (errorCode == JsNoError)
+        {
+            errorCode = JsSerialize(script, &buffer, task->parseAttributes);
+        }
+
+        if (errorCode == JsNoError)
+        {
+            Js::ArrayBuffer *arrayBuffer = Js::ArrayBuffer::FromVar(buffer);
+            task->byteCodeLength = arrayBuffer->GetByteLength();
+            task->byteCode = (byte *)malloc(task->byteCodeLength);
+            if (task->byteCode == nullptr)
+            {
+                errorCode = JsErrorOutOfMemory;
+            }
+            else
+            {
+                memcpy_s(task->byteCode, task->byteCodeLength, arrayBuffer->GetBuffer(), task->byteCodeLength);
+            }
+        }
+
+        JsSetCurrentContext(JS_INVALID_REFERENCE);
+    }
+
+    return errorCode;
+}
+
+// Runs a JsParseScriptAsync compile on the runtime's JsParseScriptAsync thread.
+class JsrtParseScriptAsyncJob sealed : public JsUtil::WaitableSingleJobManager
+{
+public:
+    JsrtParseScriptAsyncJob(JsUtil::JobProcessor *const processor, JsrtParseScriptAsyncTask *task) :
+        JsUtil::WaitableSingleJobManager(processor),
+        task(task)
+    {
+    }
+
+protected:
+    virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override
+    {
+        // The job is processed on the owning thread if JsParseScriptAsyncResult prioritizes it before a background
+        // thread gets to it. That thread has a current context already, so leave the compile to
+        // JsParseScriptAsyncResult.
+        if (threadData != nullptr)
+        {
+            task->compileResult = SerializeScriptInPrivateRuntime(task);
+        }
+        task->callback(task, task->callbackState);
+        return task->compileResult == JsNoError;
+    }
+
+private:
+    JsrtParseScriptAsyncTask *task;
+};
+#endif
+
+static void FreeParseScriptAsyncTask(JsrtParseScriptAsyncTask *task)
+{
+    task->context->GetScriptContext()->GetRecycler()->RootRelease(task->script);
+    free(task->scriptCopy);
+    free(task->byteCode);
+    HeapDelete(task);
+}
+
+static bool CHAKRA_CALLBACK ParseScriptAsyncLoadScriptCallback(JsSourceContext sourceContext,
+    _Out_ JsValueRef *value, _Out_ JsParseScriptAttributes *parseAttributes)
+{
+    JsrtParseScriptAsyncTask *task = (JsrtParseScriptAsyncTask *)sourceContext;
+    *value = task->source;
+    *parseAttributes = task->parseAttributes;
+    return true;
+}
+
+static void CHAKRA_CALLBACK ParseScriptAsyncFreeBuffer(_In_opt_ void *data)
+{
+    free(data);
+}
+
+CHAKRA_API JsParseScriptAsync(
+    _In_ JsValueRef script,
+    _In_ JsParseScriptAttributes parseAttributes,
+    _In_ JsParseScriptAsyncCallback callback,
+    _In_opt_ void *callbackState,
+    _Out_ JsParseScriptAsyncTask *task)
+{
+    PARAM_NOT_NULL(task);
+    *task = nullptr;
+    PARAM_NOT_NULL(callback);
+    VALIDATE_JSREF(script);
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(script, scriptContext);
+
+        const byte *scriptBuffer;
+        size_t scriptByteLength;
+        bool isArrayBuffer = false;
+        if (Js::ExternalArrayBuffer::Is(script))
+        {
+            scriptBuffer = ((Js::ExternalArrayBuffer *)script)->GetBuffer();
+            scriptByteLength = ((Js::ExternalArrayBuffer *)script)->GetByteLength();
+            isArrayBuffer = true;
+        }
+        else if (Js::JavascriptString::Is(script))
+        {
+            // Flatten the string here; the background thread must not touch the recycler. The string is rooted below,
+            // and strings don't change, so the buffer stays valid until the result is taken.
+            Js::JavascriptString *jsString = Js::JavascriptString::FromVar(script);
+            scriptBuffer = (const byte *)jsString->GetSz();
+            scriptByteLength = jsString->GetLength() * sizeof(char16);
+            parseAttributes = (JsParseScriptAttributes)(parseAttributes | JsParseScriptAttributeArrayBufferIsUtf16Encoded);
+        }
+        else
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        if (scriptByteLength > UINT_MAX)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        JsrtContext *context = JsrtContext::GetCurrent();
+        JsrtRuntime *runtime = context->GetRuntime();
+
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+        JsUtil::BackgroundJobProcessor *processor = nullptr;
+        if (!(runtime->GetAttributes() & JsRuntimeAttributeDisableBackgroundWork))
+        {
+            processor = runtime->EnsureParseScriptAsyncProcessor();
+        }
+#endif
+
+        JsrtParseScriptAsyncTask *asyncTask = HeapNewStructZ(JsrtParseScriptAsyncTask);
+        asyncTask->context = context;
+        asyncTask->runtime = runtime;
+        asyncTask->script = script;
+        asyncTask->source = script;
+        asyncTask->scriptBuffer = scriptBuffer;
+        asyncTask->scriptByteLength = (unsigned int)scriptByteLength;
+        asyncTask->parseAttributes = parseAttributes;
+        asyncTask->callback = callback;
+        asyncTask->callbackState = callbackState;
+
+        // Until a background compile succeeds, JsParseScriptAsyncResult compiles on the calling thread
+        asyncTask->compileResult = JsErrorBadSerializedScript;
+
+        if (isArrayBuffer)
+        {
+            // The host can change or detach an ArrayBuffer while it's being compiled, so compile (and later load)
+            // a copy of it.
+            asyncTask->scriptCopy = (byte *)malloc(scriptByteLength);
+            if (asyncTask->scriptCopy == nullptr)
+            {
+                HeapDelete(asyncTask);
+                return JsErrorOutOfMemory;
+            }
+            memcpy_s(asyncTask->scriptCopy, scriptByteLength, scriptBuffer, scriptByteLength);
+            asyncTask->scriptBuffer = asyncTask->scriptCopy;
+        }
+
+        Recycler *recycler = scriptContext->GetRecycler();
+        recycler->RootAddRef(script);
+
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+        if (processor != nullptr)
+        {
+            asyncTask->job = HeapNewNoThrow(JsrtParseScriptAsyncJob, processor, asyncTask);
+            if (asyncTask->job == nullptr)
+            {
+                FreeParseScriptAsyncTask(asyncTask);
+                return JsErrorOutOfMemory;
+            }
+
+            processor->AddManager(asyncTask->job);
+            asyncTask->job->AddJobToProcessor(false /*prioritize*/);
+        }
+        else
+#endif
+        {
+            // No background thread to compile on (JsRuntimeAttributeDisableBackgroundWork);
+            // JsParseScriptAsyncResult compiles the script instead.
+            callback(asyncTask, callbackState);
+        }
+
+        *task = asyncTask;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsParseScriptAsyncResult(
+    _In_ JsParseScriptAsyncTask task,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(task);
+    PARAM_NOT_NULL(result);
+    *result = nullptr;
+    PARAM_NOT_NULL(sourceUrl);
+
+    JsrtParseScriptAsyncTask *asyncTask = (JsrtParseScriptAsyncTask *)task;
+    JsrtContext *context = JsrtContext::GetCurrent();
+    if (context == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+    if (context != asyncTask->context)
+    {
+        return JsErrorWrongRuntime;
+    }
+    if (!Js::JavascriptString::Is(sourceUrl))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    if (asyncTask->job != nullptr)
+    {
+        asyncTask->job->WaitForJobProcessed();
+        asyncTask->job->Processor()->RemoveManager(asyncTask->job);
+        HeapDelete(asyncTask->job);
+        asyncTask->job = nullptr;
+    }
+#endif
+
+    Js::ScriptContext *scriptContext = context->GetScriptContext();
+    JsErrorCode errorCode = JsNoError;
+    if (asyncTask->scriptCopy != nullptr)
+    {
+        // Load the copy that was compiled, so the source matches the byte code. The external ArrayBuffer owns it now.
+        errorCode = JsCreateExternalArrayBuffer(asyncTask->scriptCopy, asyncTask->scriptByteLength,
+            ParseScriptAsyncFreeBuffer, asyncTask->scriptCopy, &asyncTask->source);
+        if (errorCode == JsNoError)
+        {
+            asyncTask->scriptCopy = nullptr;
+        }
+    }
+
+    if (errorCode == JsNoError)
+    {
+        bool useByteCode = asyncTask->compileResult == JsNoError && !scriptContext->IsScriptContextInDebugMode();
+#if ENABLE_TTD
+        useByteCode = useByteCode && !scriptContext->IsTTDRecordOrReplayModeEnabled();
+#endif
+
+        errorCode = JsErrorBadSerializedScript;
+        if (useByteCode)
+        {
+            JsValueRef byteCode;
+            errorCode = JsCreateExternalArrayBuffer(asyncTask->byteCode, asyncTask->byteCodeLength,
+                ParseScriptAsyncFreeBuffer, asyncTask->byteCode, &byteCode);
+            if (errorCode == JsNoError)
+            {
+                // The external ArrayBuffer owns the byte code now
+                asyncTask->byteCode = nullptr;
+
+                errorCode = RunSerializedScriptCore(
+                    (JsSerializedLoadScriptCallback)ParseScriptAsyncLoadScriptCallback, DummyScriptUnloadCallback,
+                    (JsSourceContext)asyncTask, // only used by ParseScriptAsyncLoadScriptCallback
+                    Js::ArrayBuffer::FromVar(byteCode)->GetBuffer(), byteCode,
+                    sourceContext, ((Js::JavascriptString *)sourceUrl)->GetSz(), true, result);
+            }
+
+            if (errorCode == JsNoError)
+            {
+                // The source holder calls back for the source on first use, which would be after the task is gone.
+                // Map it now; the holder then keeps the script alive itself.
+                errorCode = ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *) -> JsErrorCode {
+                    Js::JavascriptFunction::FromVar(*result)->GetFunctionProxy()->GetUtf8SourceInfo()->GetSource(_u("JsParseScriptAsyncResult"));
+                    return JsNoError;
+                });
+            }
+        }
+
+        if (errorCode == JsErrorBadSerializedScript)
+        {
+            // The background compile failed (most likely a syntax error), didn't run, or its byte code can't be used
+            // here. Compile on this thread, which also reports any error the same way JsParse does.
+            errorCode = CompileRun(asyncTask->source, sourceContext, sourceUrl, asyncTask->parseAttributes, result, true);
+        }
+    }
+
+    FreeParseScriptAsyncTask(asyncTask);
+    return errorCode;
+}
+
+CHAKRA_API JsParseScriptAsyncCancel(_In_ JsParseScriptAsyncTask task)
+{
+    PARAM_NOT_NULL(task);
+
+    JsrtParseScriptAsyncTask *asyncTask = (JsrtParseScriptAsyncTask *)task;
+    JsrtContext *context = JsrtContext::GetCurrent();
+    if (context == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+    if (context != asyncTask->context)
+    {
+        return JsErrorWrongRuntime;
+    }
+
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    if (asyncTask->job != nullptr)
+    {
+        // Drops the job if it hasn't started, waits for it otherwise. Either way the callback isn't called after this.
+        asyncTask->job->Processor()->RemoveManager(asyncTask->job);
+        HeapDelete(asyncTask->job);
+        asyncTask->job = nullptr;
+    }
+#endif
+
+    FreeParseScriptAsyncTask(asyncTask);
+    return JsNoError;
+}
+
 #endif // _CHAKRACOREBUILD
@@ -7,7 +7,8 @@
 #include "jsrtHelper.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Base/ThreadBoundThreadContextManager.h"
-JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispatchExceptions)
+#include "Base/NativeCodeHintCache.h"
+JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, JsRuntimeAttributes attributes, bool useIdle, bool dispatchExceptions)
 {
     Assert(threadContext != NULL);
     this->threadContext = threadContext;
@@ -16,6 +17,7 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
+    this->attributes = attributes;
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
     if (useIdle)
@@ -27,6 +29,11 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     serializeByteCodeForLibrary = false;
 #endif
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    this->parseScriptAsyncProcessor = nullptr;
+    this->parseScriptAsyncRuntime = JS_INVALID_RUNTIME_HANDLE;
+    this->parseScriptAsyncContext = JS_INVALID_REFERENCE;
+#endif
 #ifdef ENABLE_SCRIPT_DEBUGGING
     this->jsrtDebugManager = nullptr;
 #endif
@@ -34,6 +41,9 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
 
 JsrtRuntime::~JsrtRuntime()
 {
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    Assert(this->parseScriptAsyncProcessor == nullptr);
+#endif
     HeapDelete(allocationPolicyManager);
 #ifdef ENABLE_SCRIPT_DEBUGGING
     if (this->jsrtDebugManager != nullptr)
@@ -54,6 +64,15 @@ void JsrtRuntime::Uninitialize()
 {
     ThreadContext* currentThreadContext = ThreadContext::GetThreadContextList();
     ThreadContext* tmpThreadContext;
+
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    // Stop the JsParseScriptAsync threads first. Their private runtimes are in the list and are cleaned up below.
+    for (ThreadContext* threadContext = currentThreadContext; threadContext; threadContext = threadContext->Next())
+    {
+        static_cast<JsrtRuntime*>(threadContext->GetJSRTRuntime())->CloseParseScriptAsync(false);
+    }
+#endif
+
     while (currentThreadContext)
     {
         Assert(!currentThreadContext->IsScriptActive());
@@ -72,8 +91,49 @@ void JsrtRuntime::Uninitialize()
         HeapDelete(currentRuntime);
 #endif
     }
+
+#if ENABLE_NATIVE_CODEGEN
+    Js::NativeCodeHintCache::Cleanup();
+#endif
+}
+
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+JsUtil::BackgroundJobProcessor * JsrtRuntime::EnsureParseScriptAsyncProcessor()
+{
+    if (this->parseScriptAsyncProcessor == nullptr)
+    {
+        // A single thread, the private runtime can't be used by two compiles at once
+        this->parseScriptAsyncProcessor = HeapNew(JsUtil::BackgroundJobProcessor, nullptr, nullptr, true /*disableParallelThreads*/);
+    }
+    return this->parseScriptAsyncProcessor;
+}
+
+void JsrtRuntime::SetParseScriptAsyncContext(JsRuntimeHandle runtime, JsContextRef context)
+{
+    Assert(this->parseScriptAsyncRuntime == JS_INVALID_RUNTIME_HANDLE);
+    this->parseScriptAsyncRuntime = runtime;
+    this->parseScriptAsyncContext = context;
 }
 
+void JsrtRuntime::CloseParseScriptAsync(bool disposeRuntime)
+{
+    if (this->parseScriptAsyncProcessor != nullptr)
+    {
+        // Every task has been taken or canceled by now, which removed its job manager
+        this->parseScriptAsyncProcessor->Close();
+        HeapDelete(this->parseScriptAsyncProcessor);
+        this->parseScriptAsyncProcessor = nullptr;
+    }
+
+    if (disposeRuntime && this->parseScriptAsyncRuntime != JS_INVALID_RUNTIME_HANDLE)
+    {
+        JsDisposeRuntime(this->parseScriptAsyncRuntime);
+        this->parseScriptAsyncRuntime = JS_INVALID_RUNTIME_HANDLE;
+        this->parseScriptAsyncContext = JS_INVALID_REFERENCE;
+    }
+}
+#endif
+
 void JsrtRuntime::CloseContexts()
 {
     while (this->contextList != NULL)
@@ -17,7 +17,7 @@ class JsrtRuntime
     friend class JsrtContext;
 
 public:
-    JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispatchExceptions);
+    JsrtRuntime(ThreadContext * threadContext, JsRuntimeAttributes attributes, bool useIdle, bool dispatchExceptions);
     ~JsrtRuntime();
 
     ThreadContext * GetThreadContext() { return this->threadContext; }
@@ -31,6 +31,8 @@ class JsrtRuntime
     }
     static void Uninitialize();
 
+    JsRuntimeAttributes GetAttributes() const { return attributes; }
+
     bool UseIdle() const { return useIdle; }
     unsigned int Idle();
 
@@ -44,6 +46,16 @@ class JsrtRuntime
     bool IsSerializeByteCodeForLibrary() const { return serializeByteCodeForLibrary; }
 #endif
 
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    // JsParseScriptAsync compiles run on a thread of their own, so they don't hold up background JIT, in a private
+    // runtime that is kept for the next compile. Both are created by the first compile. The private runtime is only
+    // used on that thread.
+    JsUtil::BackgroundJobProcessor * EnsureParseScriptAsyncProcessor();
+    JsContextRef GetParseScriptAsyncContext() const { return parseScriptAsyncContext; }
+    void SetParseScriptAsyncContext(JsRuntimeHandle runtime, JsContextRef context);
+    void CloseParseScriptAsync(bool disposeRuntime);
+#endif
+
 #ifdef ENABLE_SCRIPT_DEBUGGING
     void EnsureJsrtDebugManager();
     void DeleteJsrtDebugManager();
@@ -67,11 +79,17 @@ class JsrtRuntime
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
     void * callbackContext;
+    JsRuntimeAttributes attributes;
     bool useIdle;
     bool dispatchExceptions;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     bool serializeByteCodeForLibrary;
 #endif
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    JsUtil::BackgroundJobProcessor * parseScriptAsyncProcessor;
+    JsRuntimeHandle parseScriptAsyncRuntime;
+    JsContextRef parseScriptAsyncContext;
+#endif
 #ifdef ENABLE_SCRIPT_DEBUGGING
     JsrtDebugManager * jsrtDebugManager;
 #endif
@@ -76,7 +76,8 @@ Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator
 #else
 Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator *alloc, bool isBackground)
 #endif
-    : m_nodeAllocator(_u("Parser"), alloc ? alloc : scriptContext->GetThreadContext()->GetPageAllocator(), Parser::OutOfMemory),
+    : m_localNodeAllocator(_u("Parser"), alloc ? alloc : scriptContext->GetThreadContext()->GetPageAllocator(), Parser::OutOfMemory),
+    m_nodeAllocator(&m_localNodeAllocator),
     m_cactIdentToNodeLookup(0),
     m_grfscr(fscrNil),
     m_length(0),
@@ -156,6 +157,16 @@ Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator
 {
     AssertMsg(size == sizeof(Parser), "verify conditionals affecting the size of Parser agree");
     Assert(scriptContext != nullptr);
+
+    if (alloc == nullptr && !isBackground)
+    {
+        // Parsing on the thread's page allocator: use a pooled arena that still has the pages of an earlier parse
+        ParseNodeAllocator * pooledAllocator = scriptContext->GetThreadContext()->GetParserArena(Parser::OutOfMemory);
+        if (pooledAllocator != nullptr)
+        {
+            m_nodeAllocator = pooledAllocator;
+        }
+    }
 }
 
 Parser::~Parser(void)
@@ -188,6 +199,10 @@ Parser::~Parser(void)
 
     Release();
 
+    if (m_nodeAllocator != &m_localNodeAllocator)
+    {
+        m_scriptContext->GetThreadContext()->ReleaseParserArena(m_nodeAllocator);
+    }
 }
 
 void Parser::OutOfMemory()
@@ -674,7 +689,7 @@ LabelId* Parser::CreateLabelId(IdentPtr pid)
 {
     LabelId* pLabelId;
 
-    pLabelId = (LabelId*)m_nodeAllocator.Alloc(sizeof(LabelId));
+    pLabelId = (LabelId*)m_nodeAllocator->Alloc(sizeof(LabelId));
     if (NULL == pLabelId)
         Error(ERRnoMemory);
     pLabelId->pid = pid;
@@ -744,7 +759,7 @@ template <OpCode nop>
 ParseNodePtr Parser::CreateNodeT(charcount_t ichMin,charcount_t ichLim)
 {
     Assert(!this->m_deferringAST);
-    ParseNodePtr pnode = StaticCreateNodeT<nop>(&m_nodeAllocator, ichMin, ichLim);
+    ParseNodePtr pnode = StaticCreateNodeT<nop>(m_nodeAllocator, ichMin, ichLim);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += GetNodeSize<nop>();
@@ -896,7 +911,7 @@ Symbol* Parser::AddDeclForPid(ParseNodePtr pnode, IdentPtr pid, SymbolType symbo
         if (scope == nullptr)
         {
             Assert(blockInfo->pnodeBlock->sxBlock.blockType == PnodeBlockType::Regular);
-            scope = Anew(&m_nodeAllocator, Scope, &m_nodeAllocator, ScopeType_Block);
+            scope = Anew(m_nodeAllocator, Scope, m_nodeAllocator, ScopeType_Block);
             if (this->IsCurBlockInLoop())
             {
                 scope->SetIsBlockInLoop();
@@ -953,7 +968,7 @@ Symbol* Parser::AddDeclForPid(ParseNodePtr pnode, IdentPtr pid, SymbolType symbo
             SymbolName const symName(name, nameLength);
 
             Assert(!scope->FindLocalSymbol(symName));
-            sym = Anew(&m_nodeAllocator, Symbol, symName, pnode, symbolType);
+            sym = Anew(m_nodeAllocator, Symbol, symName, pnode, symbolType);
             scope->AddNewSymbol(sym);
             sym->SetPid(pid);
         }
@@ -1093,7 +1108,7 @@ ParseNodePtr Parser::CreateNode(OpCode nop, charcount_t ichMin)
     ParseNodePtr pnode;
     int cb = (nop >= knopNone && nop < knopLim) ? g_mpnopcbNode[nop] : g_mpnopcbNode[knopEmpty];
 
-    pnode = (ParseNodePtr)m_nodeAllocator.Alloc(cb);
+    pnode = (ParseNodePtr)m_nodeAllocator->Alloc(cb);
     Assert(pnode != nullptr);
 
     if (!m_deferringAST)
@@ -1118,7 +1133,7 @@ ParseNodePtr Parser::CreateUniNode(OpCode nop, ParseNodePtr pnode1)
 {
     Assert(!this->m_deferringAST);
     DebugOnly(VerifyNodeSize(nop, kcbPnUni));
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnUni);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnUni);
 
     Assert(m_pCurrentAstSize != nullptr);
     *m_pCurrentAstSize += kcbPnUni;
@@ -1189,7 +1204,7 @@ ParseNodePtr Parser::CreateSuperReferenceNode(OpCode nop, ParseNodePtr pnode1, P
     Assert(pnode2 != nullptr);
     Assert(nop == knopDot || nop == knopIndex);
 
-    ParseNodePtr pnode = StaticCreateSuperReferenceNode(nop, pnode1, pnode2, &m_nodeAllocator);
+    ParseNodePtr pnode = StaticCreateSuperReferenceNode(nop, pnode1, pnode2, m_nodeAllocator);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += kcbPnSuperReference;
@@ -1240,7 +1255,7 @@ ParseNodePtr Parser::CreateTriNode(OpCode nop, ParseNodePtr pnode1,
 
 ParseNodePtr Parser::CreateBlockNode(charcount_t ichMin,charcount_t ichLim, PnodeBlockType blockType)
 {
-    return StaticCreateBlockNode(&m_nodeAllocator, ichMin, ichLim, this->m_nextBlockId++, blockType);
+    return StaticCreateBlockNode(m_nodeAllocator, ichMin, ichLim, this->m_nextBlockId++, blockType);
 }
 
 ParseNodePtr
@@ -1248,7 +1263,7 @@ Parser::CreateCallNode(OpCode nop, ParseNodePtr pnode1, ParseNodePtr pnode2,char
 {
     Assert(!this->m_deferringAST);
     DebugOnly(VerifyNodeSize(nop, kcbPnCall));
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnCall);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnCall);
 
     Assert(m_pCurrentAstSize != nullptr);
     *m_pCurrentAstSize += kcbPnCall;
@@ -1362,7 +1377,7 @@ ParseNodePtr Parser::CreateSuperCallNode(ParseNodePtr pnode1, ParseNodePtr pnode
     Assert(pnode1 && pnode1->isSpecialName && pnode1->sxSpecialName.isSuper);
 
     DebugOnly(VerifyNodeSize(knopSuperCall, kcbPnSuperCall));
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnSuperCall);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnSuperCall);
 
     Assert(m_pCurrentAstSize != nullptr);
     *m_pCurrentAstSize += kcbPnSuperCall;
@@ -1528,7 +1543,7 @@ ParseNodePtr Parser::StartParseBlockWithCapacity(PnodeBlockType blockType, Scope
 
     // Block scopes are not created lazily in the case where we're repopulating a persisted scope.
 
-    scope = Anew(&m_nodeAllocator, Scope, &m_nodeAllocator, scopeType, capacity);
+    scope = Anew(m_nodeAllocator, Scope, m_nodeAllocator, scopeType, capacity);
     PushScope(scope);
 
     return StartParseBlockHelper<buildAST>(blockType, scope, nullptr);
@@ -1541,7 +1556,7 @@ ParseNodePtr Parser::StartParseBlock(PnodeBlockType blockType, ScopeType scopeTy
     // Block scopes are created lazily when we discover block-scoped content.
     if (scopeType != ScopeType_Unknown && scopeType != ScopeType_Block)
     {
-        scope = Anew(&m_nodeAllocator, Scope, &m_nodeAllocator, scopeType);
+        scope = Anew(m_nodeAllocator, Scope, m_nodeAllocator, scopeType);
         PushScope(scope);
     }
 
@@ -1982,7 +1997,7 @@ void Parser::PopStmt(StmtNest *pStmt)
 
 BlockInfoStack *Parser::PushBlockInfo(ParseNodePtr pnodeBlock)
 {
-    BlockInfoStack *newBlockInfo = (BlockInfoStack *)m_nodeAllocator.Alloc(sizeof(BlockInfoStack));
+    BlockInfoStack *newBlockInfo = (BlockInfoStack *)m_nodeAllocator->Alloc(sizeof(BlockInfoStack));
     Assert(nullptr != newBlockInfo);
 
     newBlockInfo->pnodeBlock = pnodeBlock;
@@ -2018,7 +2033,7 @@ void Parser::PushDynamicBlock()
     {
         return;
     }
-    BlockIdsStack *info = (BlockIdsStack *)m_nodeAllocator.Alloc(sizeof(BlockIdsStack));
+    BlockIdsStack *info = (BlockIdsStack *)m_nodeAllocator->Alloc(sizeof(BlockIdsStack));
     if (nullptr == info)
     {
         Error(ERRnoMemory);
@@ -2411,7 +2426,7 @@ IdentPtrList* Parser::EnsureRequestedModulesList()
 {
     if (m_currentNodeProg->sxModule.requestedModules == nullptr)
     {
-        m_currentNodeProg->sxModule.requestedModules = Anew(&m_nodeAllocator, IdentPtrList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.requestedModules = Anew(m_nodeAllocator, IdentPtrList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.requestedModules;
 }
@@ -2420,7 +2435,7 @@ ModuleImportOrExportEntryList* Parser::EnsureModuleImportEntryList()
 {
     if (m_currentNodeProg->sxModule.importEntries == nullptr)
     {
-        m_currentNodeProg->sxModule.importEntries = Anew(&m_nodeAllocator, ModuleImportOrExportEntryList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.importEntries = Anew(m_nodeAllocator, ModuleImportOrExportEntryList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.importEntries;
 }
@@ -2429,7 +2444,7 @@ ModuleImportOrExportEntryList* Parser::EnsureModuleLocalExportEntryList()
 {
     if (m_currentNodeProg->sxModule.localExportEntries == nullptr)
     {
-        m_currentNodeProg->sxModule.localExportEntries = Anew(&m_nodeAllocator, ModuleImportOrExportEntryList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.localExportEntries = Anew(m_nodeAllocator, ModuleImportOrExportEntryList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.localExportEntries;
 }
@@ -2438,7 +2453,7 @@ ModuleImportOrExportEntryList* Parser::EnsureModuleIndirectExportEntryList()
 {
     if (m_currentNodeProg->sxModule.indirectExportEntries == nullptr)
     {
-        m_currentNodeProg->sxModule.indirectExportEntries = Anew(&m_nodeAllocator, ModuleImportOrExportEntryList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.indirectExportEntries = Anew(m_nodeAllocator, ModuleImportOrExportEntryList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.indirectExportEntries;
 }
@@ -2447,7 +2462,7 @@ ModuleImportOrExportEntryList* Parser::EnsureModuleStarExportEntryList()
 {
     if (m_currentNodeProg->sxModule.starExportEntries == nullptr)
     {
-        m_currentNodeProg->sxModule.starExportEntries = Anew(&m_nodeAllocator, ModuleImportOrExportEntryList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.starExportEntries = Anew(m_nodeAllocator, ModuleImportOrExportEntryList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.starExportEntries;
 }
@@ -2476,7 +2491,7 @@ ModuleImportOrExportEntry* Parser::AddModuleImportOrExportEntry(ModuleImportOrEx
 
 ModuleImportOrExportEntry* Parser::AddModuleImportOrExportEntry(ModuleImportOrExportEntryList* importOrExportEntryList, IdentPtr importName, IdentPtr localName, IdentPtr exportName, IdentPtr moduleRequest)
 {
-    ModuleImportOrExportEntry* importOrExportEntry = Anew(&m_nodeAllocator, ModuleImportOrExportEntry);
+    ModuleImportOrExportEntry* importOrExportEntry = Anew(m_nodeAllocator, ModuleImportOrExportEntry);
 
     importOrExportEntry->importName = importName;
     importOrExportEntry->localName = localName;
@@ -2675,7 +2690,7 @@ ParseNodePtr Parser::ParseImport()
     }
     else
     {
-        ModuleImportOrExportEntryList importEntryList(&m_nodeAllocator);
+        ModuleImportOrExportEntryList importEntryList(m_nodeAllocator);
 
         // Parse the import clause (default binding can only exist before the comma).
         ParseImportClause<buildAST>(&importEntryList);
@@ -2919,7 +2934,7 @@ ParseNodePtr Parser::ParseExportDeclaration(bool *needTerminator)
 
     case tkLCurly:
         {
-            ModuleImportOrExportEntryList exportEntryList(&m_nodeAllocator);
+            ModuleImportOrExportEntryList exportEntryList(m_nodeAllocator);
 
             ParseNamedImportOrExportClause<buildAST>(&exportEntryList, true);
 
@@ -4486,7 +4501,7 @@ ParseNodePtr Parser::ParseMemberList(LPCOLESTR pNameHint, uint32* pNameHintLengt
         return nullptr;
     }
 
-    ArenaAllocator tempAllocator(_u("MemberNames"), m_nodeAllocator.GetPageAllocator(), Parser::OutOfMemory);
+    ArenaAllocator tempAllocator(_u("MemberNames"), m_nodeAllocator->GetPageAllocator(), Parser::OutOfMemory);
 
     bool hasDeferredInitError = false;
 
@@ -5341,7 +5356,7 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, usho
     {
         FinishParseBlock(pnodeFncExprScope);
         m_nextBlockId--;
-        Adelete(&m_nodeAllocator, fncExprScope);
+        Adelete(m_nodeAllocator, fncExprScope);
         fncExprScope = nullptr;
         pnodeFncExprScope = nullptr;
     }
@@ -5420,13 +5435,13 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, usho
 #if ENABLE_BACKGROUND_PARSING
         if (!fLambda &&
             !isDeferredFnc &&
-            !isLikelyIIFE &&
+            (!isLikelyIIFE || CONFIG_FLAG_RELEASE(ParallelParseIIFE)) &&
             !this->IsBackgroundParser() &&
             !this->m_doingFastScan &&
             !(pnodeFncSave && m_currDeferredStub) &&
             !(this->m_parseType == ParseType_Deferred && this->m_functionBody && this->m_functionBody->GetScopeInfo() && !isTopLevelDeferredFunc))
         {
-            doParallel = DoParallelParse(pnodeFnc);
+            doParallel = DoParallelParse(pnodeFnc, isLikelyIIFE);
 
             if (doParallel)
             {
@@ -5450,6 +5465,12 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, usho
                         // so we don't want the background thread to try and touch it.
                         pnodeFnc->ichLim = m_pscan->IchLimTok();
                         pnodeFnc->sxFnc.cbLim = m_pscan->IecpLimTok();
+
+                        if (PHASE_TRACE1(Js::ParallelParsePhase))
+                        {
+                            Output::Print(_u("Parsing %s in the background\n"), GetFunctionName(pnodeFnc, pNameHint));
+                            Output::Flush();
+                        }
                     }
                 }
             }
@@ -6024,16 +6045,34 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
     this->m_deferringAST = FALSE;
 }
 
-bool Parser::DoParallelParse(ParseNodePtr pnodeFnc) const
+bool Parser::HasBackgroundParser() const
 {
 #if ENABLE_BACKGROUND_PARSING
-    if (!PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
+    return m_scriptContext->GetBackgroundParser() != nullptr;
+#else
+    return false;
+#endif
+}
+
+bool Parser::DoParallelParse(ParseNodePtr pnodeFnc, bool isLikelyIIFE) const
+{
+#if ENABLE_BACKGROUND_PARSING
+    BackgroundParser *bgp = m_scriptContext->GetBackgroundParser();
+    if (bgp == nullptr)
     {
         return false;
     }
 
-    BackgroundParser *bgp = m_scriptContext->GetBackgroundParser();
-    return bgp != nullptr;
+    if (PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
+    {
+        return true;
+    }
+
+    // A likely IIFE is never deferred and runs as soon as the script does, so its full parse is on the
+    // critical path. Let a background thread build its AST while this thread fast-scans past the body.
+    return isLikelyIIFE &&
+        CONFIG_FLAG_RELEASE(ParallelParseIIFE) &&
+        !PHASE_OFF_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId);
 #else
     return false;
 #endif
@@ -6144,7 +6183,7 @@ bool Parser::FastScanFormalsAndBody()
                 if (curlyDepth == 1)
                 {
                     Assert(strTmplDepth == 0);
-                    if (PHASE_TRACE1(Js::ParallelParsePhase))
+                    if (PHASE_VERBOSE_TRACE1(Js::ParallelParsePhase))
                     {
                         Output::Print(_u("Finished fast seek: %d. %s -- %d...%d\n"),
                                       m_currentNodeFunc->sxFnc.functionId,
@@ -6311,7 +6350,7 @@ bool Parser::FastScanFormalsAndBody()
             case tkScanError:
             case tkEOF:
                 // Unexpected token.
-                if (PHASE_TRACE1(Js::ParallelParsePhase))
+                if (PHASE_VERBOSE_TRACE1(Js::ParallelParsePhase))
                 {
                     Output::Print(_u("Failed fast seek: %d. %s -- %d...%d\n"),
                                   m_currentNodeFunc->sxFnc.functionId,
@@ -6401,7 +6440,7 @@ void Parser::ParseNestedDeferredFunc(ParseNodePtr pnodeFnc, bool fLambda, bool *
         // Record the end of the function and the function ID increment that happens inside the function.
         // Byte code gen will use this to build stub information to allow us to skip this function when the
         // enclosing function is fully parsed.
-        RestorePoint *restorePoint = Anew(&m_nodeAllocator, RestorePoint);
+        RestorePoint *restorePoint = Anew(m_nodeAllocator, RestorePoint);
         m_pscan->Capture(restorePoint,
                          *m_nextFunctionId - pnodeFnc->sxFnc.functionId - 1,
                          lengthBeforeBody - this->GetSourceLength());
@@ -6664,7 +6703,7 @@ void Parser::ParseFncFormals(ParseNodePtr pnodeFnc, ParseNodePtr pnodeParentFnc,
         {
             Error(ERRGetterMustHaveNoParameters);
         }
-        SList<IdentPtr> formals(&m_nodeAllocator);
+        SList<IdentPtr> formals(m_nodeAllocator);
         ParseNodePtr pnodeT = nullptr;
         bool seenRestParameter = false;
         bool isNonSimpleParameterList = false;
@@ -7160,7 +7199,7 @@ void Parser::CheckStrictFormalParameters()
 
     if (m_token.tk != tkRParen)
     {
-        SList<IdentPtr> formals(&m_nodeAllocator);
+        SList<IdentPtr> formals(m_nodeAllocator);
         for (;;)
         {
             if (m_token.tk != tkID)
@@ -7675,7 +7714,7 @@ ParseNodePtr Parser::ParseClassDecl(BOOL isDeclaration, LPCOLESTR pNameHint, uin
     uint32 nameHintLength = pHintLength ? *pHintLength : 0;
     uint32 nameHintOffset = pShortNameOffset ? *pShortNameOffset : 0;
 
-    ArenaAllocator tempAllocator(_u("ClassMemberNames"), m_nodeAllocator.GetPageAllocator(), Parser::OutOfMemory);
+    ArenaAllocator tempAllocator(_u("ClassMemberNames"), m_nodeAllocator->GetPageAllocator(), Parser::OutOfMemory);
 
     size_t cbMinConstructor = 0;
     ParseNodePtr pnodeClass = nullptr;
@@ -9255,12 +9294,12 @@ Js::PropertyId PnPid::PropertyIdFromNameNode() const
 
 PidRefStack* Parser::PushPidRef(IdentPtr pid)
 {
-    if (PHASE_ON1(Js::ParallelParsePhase))
+    if (this->HasBackgroundParser())
     {
-        // NOTE: the phase check is here to protect perf. See OSG 1020424.
+        // NOTE: the check is here to protect perf. See OSG 1020424.
         // In some LS AST-rewrite cases we lose a lot of perf searching the PID ref stack rather
         // than just pushing on the top. This hasn't shown up as a perf issue in non-LS benchmarks.
-        return pid->FindOrAddPidRef(&m_nodeAllocator, GetCurrentBlock()->sxBlock.blockId, GetCurrentFunctionNode()->sxFnc.functionId);
+        return pid->FindOrAddPidRef(m_nodeAllocator, GetCurrentBlock()->sxBlock.blockId, GetCurrentFunctionNode()->sxFnc.functionId);
     }
 
     Assert(GetCurrentBlock() != nullptr);
@@ -9270,7 +9309,7 @@ PidRefStack* Parser::PushPidRef(IdentPtr pid)
     int funcId = GetCurrentFunctionNode()->sxFnc.functionId;
     if (!ref || (ref->GetScopeId() < blockId))
     {
-        ref = Anew(&m_nodeAllocator, PidRefStack);
+        ref = Anew(m_nodeAllocator, PidRefStack);
         if (ref == nullptr)
         {
             Error(ERRnoMemory);
@@ -9291,7 +9330,7 @@ PidRefStack* Parser::PushPidRef(IdentPtr pid)
 
 PidRefStack* Parser::FindOrAddPidRef(IdentPtr pid, int scopeId, Js::LocalFunctionId funcId)
 {
-    PidRefStack *ref = pid->FindOrAddPidRef(&m_nodeAllocator, scopeId, funcId);
+    PidRefStack *ref = pid->FindOrAddPidRef(m_nodeAllocator, scopeId, funcId);
     if (ref == NULL)
     {
         Error(ERRnoMemory);
@@ -9305,7 +9344,7 @@ void Parser::RemovePrevPidRef(IdentPtr pid, PidRefStack *ref)
     Assert(prevRef);
     if (prevRef->GetSym() == nullptr)
     {
-        AllocatorDelete(ArenaAllocator, &m_nodeAllocator, prevRef);
+        AllocatorDelete(ArenaAllocator, m_nodeAllocator, prevRef);
     }
 }
 
@@ -9745,7 +9784,7 @@ ParseNodePtr Parser::ParseCatch()
             const char16 *name = reinterpret_cast<const char16*>(pidCatch->Psz());
             int nameLength = pidCatch->Cch();
             SymbolName const symName(name, nameLength);
-            Symbol *sym = Anew(&m_nodeAllocator, Symbol, symName, pnodeParam, STVariable);
+            Symbol *sym = Anew(m_nodeAllocator, Symbol, symName, pnodeParam, STVariable);
             if (sym == nullptr)
             {
                 Error(ERRnoMemory);
@@ -11999,7 +12038,7 @@ void Parser::AddFastScannedRegExpNode(ParseNodePtr const pnode)
 
     if (fastScannedRegExpNodes == nullptr)
     {
-        fastScannedRegExpNodes = Anew(&m_nodeAllocator, NodeDList, &m_nodeAllocator);
+        fastScannedRegExpNodes = Anew(m_nodeAllocator, NodeDList, m_nodeAllocator);
     }
     fastScannedRegExpNodes->Append(pnode);
 }
@@ -12009,7 +12048,7 @@ void Parser::AddBackgroundRegExpNode(ParseNodePtr const pnode)
     Assert(IsBackgroundParser());
     Assert(currBackgroundParseItem != nullptr);
 
-    currBackgroundParseItem->AddRegExpNode(pnode, &m_nodeAllocator);
+    currBackgroundParseItem->AddRegExpNode(pnode, m_nodeAllocator);
 }
 
 HRESULT Parser::ParseFunctionInBackground(ParseNodePtr pnodeFnc, ParseContext *parseContext, bool topLevelDeferred, CompileScriptException *pse)
@@ -12195,7 +12234,7 @@ ParseNodePtr Parser::CreateNode(OpCode nop, charcount_t ichMin, charcount_t ichL
     __analysis_assume(nop < knopLim);
     int cb = nop >= 0 && nop < knopLim ? g_mpnopcbNode[nop] : kcbPnNone;
 
-    pnode = (ParseNodePtr)m_nodeAllocator.Alloc(cb);
+    pnode = (ParseNodePtr)m_nodeAllocator->Alloc(cb);
     Assert(pnode);
 
     Assert(m_pCurrentAstSize != NULL);
@@ -12222,7 +12261,7 @@ ParseNodePtr Parser::CreateUniNode(OpCode nop, ParseNodePtr pnode1, charcount_t
     Assert(!this->m_deferringAST);
     DebugOnly(VerifyNodeSize(nop, kcbPnUni));
 
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnUni);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnUni);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += kcbPnUni;
@@ -12241,7 +12280,7 @@ ParseNodePtr Parser::CreateBinNode(OpCode nop, ParseNodePtr pnode1,
                                    ParseNodePtr pnode2,charcount_t ichMin,charcount_t ichLim)
 {
     Assert(!this->m_deferringAST);
-    ParseNodePtr pnode = StaticCreateBinNode(nop, pnode1, pnode2, &m_nodeAllocator);
+    ParseNodePtr pnode = StaticCreateBinNode(nop, pnode1, pnode2, m_nodeAllocator);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += kcbPnBin;
@@ -12258,7 +12297,7 @@ ParseNodePtr Parser::CreateTriNode(OpCode nop, ParseNodePtr pnode1,
 {
     Assert(!this->m_deferringAST);
     DebugOnly(VerifyNodeSize(nop, kcbPnTri));
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnTri);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnTri);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += kcbPnTri;
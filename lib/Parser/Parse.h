@@ -136,6 +136,7 @@ class Parser
     bool IsBackgroundParser() const { return false; }
     bool IsDoingFastScan() const { return false; }
 #endif
+    bool HasBackgroundParser() const;
 
     bool GetIsInParsingArgList() const { return m_isInParsingArgList; }
     void SetIsInParsingArgList(bool set) { m_isInParsingArgList = set; }
@@ -147,7 +148,7 @@ class Parser
 
     ParseNode* CopyPnode(ParseNode* pnode);
 
-    ArenaAllocator *GetAllocator() { return &m_nodeAllocator;}
+    ArenaAllocator *GetAllocator() { return m_nodeAllocator;}
 
     size_t GetSourceLength() { return m_length; }
     size_t GetOriginalSourceLength() { return m_originalLength; }
@@ -193,7 +194,8 @@ class Parser
     /***********************************************************************
     Core members.
     ***********************************************************************/
-    ParseNodeAllocator m_nodeAllocator;
+    ParseNodeAllocator m_localNodeAllocator;
+    ParseNodeAllocator *m_nodeAllocator;  // m_localNodeAllocator, or an arena taken from the thread context's pool
     int32        m_cactIdentToNodeLookup;
     uint32       m_grfscr;
     size_t      m_length;             // source length in characters excluding comments and literals
@@ -740,7 +742,7 @@ class Parser
     bool FastScanFormalsAndBody();
     bool ScanAheadToFunctionEnd(uint count);
 
-    bool DoParallelParse(ParseNodePtr pnodeFnc) const;
+    bool DoParallelParse(ParseNodePtr pnodeFnc, bool isLikelyIIFE) const;
 
     // TODO: We should really call this StartScope and separate out the notion of scopes and blocks;
     // blocks refer to actual curly braced syntax, whereas scopes contain symbols.  All blocks have
@@ -4,6 +4,110 @@
 //-------------------------------------------------------------------------------------------------------
 #include "ParserPch.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+/*****************************************************************************
+*
+*  Block scanning of the character runs that SkipComment, ScanStringConstant
+*  and ScanIdentifierContinue would otherwise read one unit at a time. Each
+*  helper returns the first position in [p, last) that the caller has to look
+*  at itself; the caller's regular loop handles that character and the tail
+*  of the buffer that doesn't fill a whole block.
+*
+*  Only UTF-8 sources are block scanned; the UTF-16 scanner is only used for
+*  syntax coloring.
+*/
+
+#if defined(_M_IX86) || defined(_M_X64)
+template <typename TStopMask>
+static LPCUTF8 SkipRun(LPCUTF8 p, LPCUTF8 last, TStopMask stopMask)
+{
+    while (last - p >= (ptrdiff_t)sizeof(__m128i))
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        UnitWord32 mask = stopMask(block);
+        if (mask != 0)
+        {
+            DWORD index;
+            GetFirstBitSet(&index, mask);
+            return p + index;
+        }
+        p += sizeof(__m128i);
+    }
+    return p;
+}
+
+static inline __m128i MatchByte(__m128i block, char ch)
+{
+    return _mm_cmpeq_epi8(block, _mm_set1_epi8(ch));
+}
+
+static inline __m128i InByteRange(__m128i block, char chMin, char chMax)
+{
+    // Bytes >= 0x80 compare as negative and are never in an ASCII range
+    return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(chMin - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8(chMax + 1)));
+}
+#endif
+
+static inline LPCOLESTR SkipCommentRun(LPCOLESTR p, LPCOLESTR last) { return p; }
+static inline LPCOLESTR SkipStringRun(LPCOLESTR p, LPCOLESTR last) { return p; }
+static inline LPCOLESTR SkipIdentifierRun(LPCOLESTR p, LPCOLESTR last) { return p; }
+
+static LPCUTF8 SkipCommentRun(LPCUTF8 p, LPCUTF8 last)
+{
+#if defined(_M_IX86) || defined(_M_X64)
+    // Stop at '*', line breaks, NUL and the lead byte of any multi-unit character
+    return SkipRun(p, last, [](__m128i block) -> UnitWord32
+    {
+        __m128i stop = _mm_or_si128(
+            _mm_or_si128(MatchByte(block, '*'), MatchByte(block, '\n')),
+            _mm_or_si128(MatchByte(block, '\r'), MatchByte(block, '\0')));
+        return _mm_movemask_epi8(_mm_or_si128(stop, block));
+    });
+#else
+    return p;
+#endif
+}
+
+static LPCUTF8 SkipStringRun(LPCUTF8 p, LPCUTF8 last)
+{
+#if defined(_M_IX86) || defined(_M_X64)
+    // Stop at quotes, template delimiters, escapes, line breaks, NUL and the lead byte of any multi-unit character
+    return SkipRun(p, last, [](__m128i block) -> UnitWord32
+    {
+        __m128i stop = _mm_or_si128(
+            _mm_or_si128(
+                _mm_or_si128(MatchByte(block, '"'), MatchByte(block, '\'')),
+                _mm_or_si128(MatchByte(block, '`'), MatchByte(block, '$'))),
+            _mm_or_si128(
+                _mm_or_si128(MatchByte(block, '\\'), MatchByte(block, '\n')),
+                _mm_or_si128(MatchByte(block, '\r'), MatchByte(block, '\0'))));
+        return _mm_movemask_epi8(_mm_or_si128(stop, block));
+    });
+#else
+    return p;
+#endif
+}
+
+static LPCUTF8 SkipIdentifierRun(LPCUTF8 p, LPCUTF8 last)
+{
+#if defined(_M_IX86) || defined(_M_X64)
+    // Stop at anything that isn't an ASCII identifier part ([0-9A-Za-z_$])
+    return SkipRun(p, last, [](__m128i block) -> UnitWord32
+    {
+        __m128i lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+        __m128i idPart = _mm_or_si128(
+            _mm_or_si128(InByteRange(block, '0', '9'), InByteRange(lower, 'a', 'z')),
+            _mm_or_si128(MatchByte(block, '_'), MatchByte(block, '$')));
+        return ~_mm_movemask_epi8(idPart) & 0xFFFF;
+    });
+#else
+    return p;
+#endif
+}
+
 /*****************************************************************************
 *
 *  The following table speeds various tests of characters, such as whether
@@ -400,6 +504,7 @@ BOOL Scanner<EncodingPolicy>::FastIdentifierContinue(EncodedCharPtr&p, EncodedCh
 {
     if (EncodingPolicy::MultiUnitEncoding)
     {
+        p = SkipIdentifierRun(p, last);
         while (p < last)
         {
             EncodedChar currentChar = *p;
@@ -1006,6 +1111,14 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
 
     for (;;)
     {
+        EncodedCharPtr pchRun = p;
+        p = SkipStringRun(p, last);
+        if (p != pchRun)
+        {
+            m_tempChBuf.template AppendRun<true>(pchRun, (uint32)(p - pchRun));
+            m_tempChBufSecondary.template AppendRun<createRawString>(pchRun, (uint32)(p - pchRun));
+        }
+
         switch ((rawch = ch = this->ReadFirst(p, last)))
         {
         case kchRET:
@@ -1420,6 +1533,8 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
 
     for (;;)
     {
+        p = SkipCommentRun(p, last);
+
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
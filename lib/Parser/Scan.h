@@ -643,6 +643,25 @@ class Scanner : public IScanner, public EncodingPolicy
             }
         }
 
+        // Append a run of single unit characters (ASCII, for UTF-8 sources)
+        template<bool performAppend, typename EncodedChar> void AppendRun(const EncodedChar *pch, uint32 cch)
+        {
+            if (performAppend)
+            {
+                while (m_cchMax - m_ichCur < cch)
+                {
+                    Grow();
+                }
+
+                OLECHAR *pchDest = m_prgch + m_ichCur;
+                for (uint32 i = 0; i < cch; i++)
+                {
+                    pchDest[i] = static_cast<OLECHAR>(pch[i]);
+                }
+                m_ichCur += cch;
+            }
+        }
+
         void Grow()
         {
             Assert(m_pscanner != nullptr);
@@ -0,0 +1,215 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+#include "DynamicCodeCache.h"
+
+namespace Js
+{
+    DynamicCodeCache::Key::Key(const char16 * source, charcount_t sourceLength, uint32 grfscr, bool strictMode) :
+        sourceHash(JsUtil::CharacterBuffer<char16>::StaticGetHashCode(source, sourceLength)),
+        sourceLength(sourceLength),
+        grfscr(grfscr),
+        strictMode(strictMode)
+    {
+    }
+
+    DynamicCodeCache::DynamicCodeCache(size_t budget) :
+        entries(&HeapAllocator::Instance),
+        compiledOnce(&HeapAllocator::Instance),
+        head(nullptr),
+        tail(nullptr),
+        size(0),
+        budget(budget)
+    {
+    }
+
+    DynamicCodeCache::~DynamicCodeCache()
+    {
+        while (head != nullptr)
+        {
+            Remove(head);
+        }
+    }
+
+    bool DynamicCodeCache::CanCache(charcount_t sourceLength) const
+    {
+        // Don't let a single entry take more than a quarter of the budget. The byte code is usually a few times
+        // the size of the source.
+        return sourceLength * sizeof(char16) * 4 <= budget / 4;
+    }
+
+    size_t DynamicCodeCache::GetAllocSize(charcount_t sourceLength, CodeInfo const& codeInfo)
+    {
+        return sizeof(Entry) + sourceLength * sizeof(char16) + codeInfo.utf8SourceSize + 1 + codeInfo.byteCodeSize;
+    }
+
+    bool DynamicCodeCache::TryGet(Key const& key, const char16 * source, CodeInfo * codeInfo)
+    {
+        Entry * entry;
+        if (!entries.TryGetValue(key, &entry) ||
+            wmemcmp(entry->source, source, key.sourceLength) != 0)
+        {
+            return false;
+        }
+
+        MoveToFront(entry);
+        *codeInfo = entry->codeInfo;
+        return true;
+    }
+
+    bool DynamicCodeCache::NotifyCompile(Key const& key)
+    {
+        if (compiledOnce.Contains(key))
+        {
+            compiledOnce.Remove(key);
+            return true;
+        }
+
+        if (compiledOnce.Count() >= MaxCompiledOnceCount)
+        {
+            compiledOnce.Clear();
+        }
+
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+            compiledOnce.AddNew(key);
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            // The cache is only an optimization
+        }
+        return false;
+    }
+
+    void DynamicCodeCache::Add(Key const& key, const char16 * source, CodeInfo const& codeInfo)
+    {
+        size_t allocSize = GetAllocSize(key.sourceLength, codeInfo);
+        if (allocSize > budget)
+        {
+            return;
+        }
+
+        Entry * existingEntry;
+        if (entries.TryGetValue(key, &existingEntry))
+        {
+            // Either the same text compiled again, or a hash collision. Keep the latest.
+            Remove(existingEntry);
+        }
+
+        while (tail != nullptr && size + allocSize > budget)
+        {
+            Remove(tail);
+        }
+
+        // The cache is only an optimization, so don't throw if there's no memory for the entry
+        Entry * entry = HeapNewNoThrowStructZ(Entry);
+        if (entry == nullptr)
+        {
+            return;
+        }
+        entry->key = key;
+        entry->allocSize = allocSize;
+        entry->codeInfo = codeInfo;
+        entry->source = HeapNewNoThrowArray(char16, key.sourceLength);
+        entry->codeInfo.utf8Source = HeapNewNoThrowArray(utf8char_t, codeInfo.utf8SourceSize + 1);
+        entry->codeInfo.byteCode = HeapNewNoThrowArray(byte, codeInfo.byteCodeSize);
+        if (entry->source == nullptr || entry->codeInfo.utf8Source == nullptr || entry->codeInfo.byteCode == nullptr)
+        {
+            Free(entry);
+            return;
+        }
+
+        js_wmemcpy_s(entry->source, key.sourceLength, source, key.sourceLength);
+        utf8char_t * utf8Source = const_cast<utf8char_t *>(entry->codeInfo.utf8Source);
+        js_memcpy_s(utf8Source, codeInfo.utf8SourceSize, codeInfo.utf8Source, codeInfo.utf8SourceSize);
+        utf8Source[codeInfo.utf8SourceSize] = 0;
+        js_memcpy_s(entry->codeInfo.byteCode, codeInfo.byteCodeSize, codeInfo.byteCode, codeInfo.byteCodeSize);
+
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+            entries.Add(key, entry);
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            Free(entry);
+            return;
+        }
+        size += allocSize;
+
+        MoveToFront(entry);
+    }
+
+    void DynamicCodeCache::MoveToFront(Entry * entry)
+    {
+        if (entry == head)
+        {
+            return;
+        }
+
+        Unlink(entry);
+
+        entry->next = head;
+        if (head != nullptr)
+        {
+            head->prev = entry;
+        }
+        head = entry;
+        if (tail == nullptr)
+        {
+            tail = entry;
+        }
+    }
+
+    void DynamicCodeCache::Unlink(Entry * entry)
+    {
+        if (entry->prev != nullptr)
+        {
+            entry->prev->next = entry->next;
+        }
+        else if (head == entry)
+        {
+            head = entry->next;
+        }
+
+        if (entry->next != nullptr)
+        {
+            entry->next->prev = entry->prev;
+        }
+        else if (tail == entry)
+        {
+            tail = entry->prev;
+        }
+
+        entry->prev = nullptr;
+        entry->next = nullptr;
+    }
+
+    void DynamicCodeCache::Remove(Entry * entry)
+    {
+        Unlink(entry);
+        entries.Remove(entry->key);
+        size -= entry->allocSize;
+        Free(entry);
+    }
+
+    void DynamicCodeCache::Free(Entry * entry)
+    {
+        if (entry->source != nullptr)
+        {
+            HeapDeleteArray(entry->key.sourceLength, entry->source);
+        }
+        if (entry->codeInfo.utf8Source != nullptr)
+        {
+            HeapDeleteArray(entry->codeInfo.utf8SourceSize + 1, const_cast<utf8char_t *>(entry->codeInfo.utf8Source));
+        }
+        if (entry->codeInfo.byteCode != nullptr)
+        {
+            HeapDeleteArray(entry->codeInfo.byteCodeSize, entry->codeInfo.byteCode);
+        }
+        HeapDelete(entry);
+    }
+};
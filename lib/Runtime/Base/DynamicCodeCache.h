@@ -0,0 +1,113 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // Runtime-wide cache of the serialized byte code of `new Function` bodies and indirect eval code.
+    //
+    // Each script context caches the functions it compiled from dynamic code itself, but those can't be used by
+    // another context. This cache keeps the byte code in serialized form, which isn't tied to a context, so a
+    // context that compiles the same text as another context in the runtime deserializes it instead of parsing
+    // and generating byte code again. Text is only serialized the second time it's compiled, so dynamic code
+    // that is compiled once per runtime pays for nothing but hashing. Entries are dropped least recently used
+    // first once the total size goes over the budget.
+    //
+    // Like the rest of the runtime's state, the cache is only used from the thread the runtime runs on.
+    class DynamicCodeCache
+    {
+    public:
+        struct Key
+        {
+            hash_t sourceHash;
+            charcount_t sourceLength;
+            uint32 grfscr;
+            bool strictMode;
+
+            Key() : sourceHash(0), sourceLength(0), grfscr(0), strictMode(false) {}
+            Key(const char16 * source, charcount_t sourceLength, uint32 grfscr, bool strictMode);
+
+            bool operator==(Key const& other) const
+            {
+                return sourceHash == other.sourceHash &&
+                    sourceLength == other.sourceLength &&
+                    grfscr == other.grfscr &&
+                    strictMode == other.strictMode;
+            }
+
+            operator hash_t() const
+            {
+                return sourceHash ^ (sourceLength * 31) ^ (grfscr << 7) ^ (hash_t)strictMode;
+            }
+        };
+
+        // What a context needs to recreate the function compiled from the text
+        struct CodeInfo
+        {
+            byte * byteCode;
+            DWORD byteCodeSize;
+            LPCUTF8 utf8Source;
+            DWORD utf8SourceSize;
+            // Flags recorded on the function and its source info by the compile that produced the byte code
+            uint32 functionGrfscr;
+            ULONG parseFlags;
+            ULONG byteCodeGenerationFlags;
+        };
+
+        DynamicCodeCache(size_t budget);
+        ~DynamicCodeCache();
+
+        // Whether text of the given length could ever be cached
+        bool CanCache(charcount_t sourceLength) const;
+
+        // Looks up the code compiled from the given text. The returned pointers stay valid until the next call
+        // to Add.
+        bool TryGet(Key const& key, const char16 * source, CodeInfo * codeInfo);
+
+        // Records that the text is being compiled. Returns whether it has been compiled before, in which case
+        // the result is worth serializing and adding to the cache.
+        bool NotifyCompile(Key const& key);
+
+        // Copies the byte code and source into a new entry, evicting older entries to stay within the budget.
+        void Add(Key const& key, const char16 * source, CodeInfo const& codeInfo);
+
+        uint GetEntryCount() const { return entries.Count(); }
+        size_t GetSize() const { return size; }
+
+    private:
+        struct Entry
+        {
+            Key key;
+            Entry * prev;
+            Entry * next;
+            size_t allocSize;
+            char16 * source;
+            CodeInfo codeInfo;
+        };
+
+        static size_t GetAllocSize(charcount_t sourceLength, CodeInfo const& codeInfo);
+
+        void MoveToFront(Entry * entry);
+        void Unlink(Entry * entry);
+        void Remove(Entry * entry);
+        static void Free(Entry * entry);
+
+        // Bound the record of text compiled once, in case a host generates lots of distinct dynamic code.
+        static const uint MaxCompiledOnceCount = 4 * 1024;
+
+        typedef JsUtil::BaseDictionary<Key, Entry *, HeapAllocator, PrimeSizePolicy> EntryMap;
+        typedef JsUtil::BaseHashSet<Key, HeapAllocator, PrimeSizePolicy> KeySet;
+
+        EntryMap entries;
+        KeySet compiledOnce;
+
+        // Most recently used first
+        Entry * head;
+        Entry * tail;
+
+        size_t size;
+        size_t budget;
+    };
+};
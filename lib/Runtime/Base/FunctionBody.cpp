@@ -12,6 +12,7 @@
 
 #include "ByteCode/ScopeInfo.h"
 #include "Base/EtwTrace.h"
+#include "Base/NativeCodeHintCache.h"
 #ifdef VTUNE_PROFILING
 #include "Base/VTuneChakraProfile.h"
 #endif
@@ -570,6 +571,10 @@ namespace Js
 #endif /* IR_VIEWER */
         , m_isFromNativeCodeModule(false)
         , hasHotLoop(false)
+#if ENABLE_NATIVE_CODEGEN
+        , hasCheckedNativeCodeHint(false)
+        , hasRecordedNativeCodeHint(false)
+#endif
         , m_isPartialDeserializedFunction(false)
 #if DBG
         , m_isSerialized(false)
@@ -699,6 +704,10 @@ namespace Js
 #endif /* IR_VIEWER */
         , m_isFromNativeCodeModule(false)
         , hasHotLoop(false)
+#if ENABLE_NATIVE_CODEGEN
+        , hasCheckedNativeCodeHint(false)
+        , hasRecordedNativeCodeHint(false)
+#endif
         , m_isPartialDeserializedFunction(false)
 #if DBG
         , m_isSerialized(false)
@@ -899,27 +908,9 @@ namespace Js
     {
         Assert(this->CanBeDeferred());
 
-#if DBG
-        if (PHASE_STATS(RedeferralPhase, this))
-        {
-            ThreadContext * threadContext = this->GetScriptContext()->GetThreadContext();
-            threadContext->redeferredFunctions++;
-            threadContext->recoveredBytes += sizeof(*this) + this->GetInlineCacheCount() * sizeof(InlineCache);
-            if (this->byteCodeBlock)
-            {
-                threadContext->recoveredBytes += this->byteCodeBlock->GetLength();
-                if (this->GetAuxiliaryData())
-                {
-                    threadContext->recoveredBytes += this->GetAuxiliaryData()->GetLength();
-                }
-            }
-            this->MapEntryPoints([&](int index, FunctionEntryPointInfo * info) {
-                threadContext->recoveredBytes += sizeof(info);
-            });
-
-            // TODO: Get size of polymorphic caches, jitted code, etc.
-        }
+        this->GetScriptContext()->GetThreadContext()->RecordRedeferredFunction(this->GetRedeferralReclaimableBytes());
 
+#if DBG
         // We can't get here if the function is being jitted. Jitting was either completed or not begun.
         this->UnlockCounters();
 #endif
@@ -948,6 +939,47 @@ namespace Js
         functionInfo->SetOriginalEntryPoint(DefaultEntryThunk);
     }
 
+    size_t FunctionBody::GetRedeferralReclaimableBytes() const
+    {
+        size_t bytes = sizeof(*this);
+
+        if (this->inlineCaches)
+        {
+            // Root object caches are owned by the root object and outlive the function
+            uint totalCacheCount = this->GetInlineCacheCount() + this->GetIsInstInlineCacheCount();
+            bytes += totalCacheCount * sizeof(void*);
+            bytes += this->GetRootObjectLoadInlineCacheStart() * sizeof(InlineCache);
+            bytes += this->GetIsInstInlineCacheCount() * sizeof(IsInstInlineCache);
+        }
+
+        if (this->byteCodeBlock)
+        {
+            bytes += this->byteCodeBlock->GetLength();
+        }
+        if (this->GetAuxiliaryData())
+        {
+            bytes += this->GetAuxiliaryData()->GetLength();
+        }
+        if (this->GetAuxiliaryContextData())
+        {
+            bytes += this->GetAuxiliaryContextData()->GetLength();
+        }
+
+#if ENABLE_PROFILE_INFO
+        if (this->HasDynamicProfileInfo())
+        {
+            bytes += DynamicProfileInfo::GetAllocSize(const_cast<FunctionBody *>(this));
+        }
+#endif
+
+        this->MapEntryPoints([&](int index, FunctionEntryPointInfo * info) {
+            bytes += sizeof(*info);
+        });
+
+        // TODO: Get size of polymorphic caches, jitted code, etc.
+        return bytes;
+    }
+
     void FunctionBody::RedeferFunctionObjectTypes()
     {
         this->MapFunctionObjectTypes([&](ScriptFunctionType* functionType)
@@ -3402,6 +3434,25 @@ namespace Js
                 }
             }
 #endif
+
+#if ENABLE_NATIVE_CODEGEN
+            if (this->dynamicProfileInfo != nullptr &&
+                sourceDynamicProfileManager->IsSeededHotFunction(this->GetLocalFunctionId()) &&
+                !Configuration::Global.flags.EnforceExecutionModeLimits &&
+                !PHASE_OFF(Phase::FullJitPhase, this))
+            {
+                // The host handed us the profile from a previous run of this script in which this function was hot,
+                // so there is nothing left for the profiling interpreter and simple JIT to learn. Go straight to full
+                // JIT. Functions that were cold keep their usual thresholds and only benefit from the profile.
+                executionState.CommitExecutedIterations();
+                TraceExecutionMode("SeededProfile (before)");
+                if (executionState.GetFullJitThreshold() > 1)
+                {
+                    executionState.SetFullJitThreshold(1, true);
+                }
+                TraceExecutionMode("SeededProfile");
+            }
+#endif
         }
 
 #ifdef DYNAMIC_PROFILE_MUTATOR
@@ -7495,6 +7546,82 @@ namespace Js
         TraceExecutionMode("HasHotLoop");
     }
 
+#if ENABLE_NATIVE_CODEGEN
+    void FunctionBody::CheckNativeCodeHint()
+    {
+        if(hasCheckedNativeCodeHint)
+        {
+            return;
+        }
+        hasCheckedNativeCodeHint = true;
+
+        if(Configuration::Global.flags.EnforceExecutionModeLimits ||
+            PHASE_OFF(Phase::SharedNativeCodeHintPhase, this) ||
+            PHASE_OFF(Phase::FullJitPhase, this) ||
+            !DoInterpreterProfile() ||
+            GetExecutionMode() == ExecutionMode::SimpleJit ||
+            GetExecutionMode() == ExecutionMode::FullJit)
+        {
+            return;
+        }
+
+        NativeCodeHintCache::Key key;
+        if(!NativeCodeHintCache::TryGetKey(this, &key) || !NativeCodeHintCache::WasFullJitted(key))
+        {
+            return;
+        }
+
+        // A function with identical source was full JITed by another runtime in this process. Skip simple JIT and
+        // the remaining auto-profiling iterations, and only run the profiling interpreter long enough to collect the
+        // profile data that full JIT needs.
+        executionState.CommitExecutedIterations();
+        TraceExecutionMode("NativeCodeHint (before)");
+        const uint16 profiledIterations =
+            static_cast<uint16>(Configuration::Global.flags.ProfilingInterpreter0Limit + Configuration::Global.flags.ProfilingInterpreter1Limit);
+        const uint16 fullJitThreshold = max(static_cast<uint16>(1), profiledIterations);
+        if(executionState.GetFullJitThreshold() > fullJitThreshold)
+        {
+            executionState.SetFullJitThreshold(fullJitThreshold, true);
+        }
+        TraceExecutionMode("NativeCodeHint");
+
+#if DBG_DUMP
+        if(PHASE_TRACE(Phase::SharedNativeCodeHintPhase, this))
+        {
+            // The source context ids of the runtimes differ between runs, so only the name is printed
+            Output::Print(
+                _u("SharedNativeCodeHint: function %s: skipping simple JIT, full JIT threshold %u\n"),
+                GetDisplayName(),
+                executionState.GetFullJitThreshold());
+            Output::Flush();
+        }
+#endif
+    }
+
+    void FunctionBody::RecordNativeCodeHint()
+    {
+        if(hasRecordedNativeCodeHint)
+        {
+            return;
+        }
+        hasRecordedNativeCodeHint = true;
+
+        if(PHASE_OFF(Phase::SharedNativeCodeHintPhase, this) || GetIsAsmjsMode())
+        {
+            return;
+        }
+
+        // Also skip the lookup later on, there's nothing to gain for a function that is already full JITed here
+        hasCheckedNativeCodeHint = true;
+
+        NativeCodeHintCache::Key key;
+        if(NativeCodeHintCache::TryGetKey(this, &key))
+        {
+            NativeCodeHintCache::RecordFullJit(key);
+        }
+    }
+#endif
+
     bool FunctionBody::IsInlineApplyDisabled()
     {
         return this->disableInlineApply;
@@ -2375,6 +2375,11 @@ namespace Js
         FieldWithBarrier(bool) m_hasActiveReference : 1;
 
         FieldWithBarrier(bool) m_isJsBuiltInForceInline : 1;
+#if ENABLE_NATIVE_CODEGEN
+        // Used by NativeCodeHintCache, to look up and record the function at most once
+        FieldWithBarrier(bool) hasCheckedNativeCodeHint : 1;
+        FieldWithBarrier(bool) hasRecordedNativeCodeHint : 1;
+#endif
 #if DBG
         FieldWithBarrier(bool) m_isSerialized : 1;
 #endif
@@ -2481,6 +2486,8 @@ namespace Js
 
         bool DoRedeferFunction(uint inactiveThreshold) const;
         void RedeferFunction();
+        // Approximate number of bytes released when the function is redeferred.
+        size_t GetRedeferralReclaimableBytes() const;
         void RedeferFunctionObjectTypes();
         bool IsActiveFunction(ActiveFunctionSet * pActiveFuncs) const;
         bool TestAndUpdateActiveFunctions(ActiveFunctionSet * pActiveFuncs) const;
@@ -2896,6 +2903,11 @@ namespace Js
         bool GetHasHotLoop() const { return hasHotLoop; };
         void SetHasHotLoop();
 
+#if ENABLE_NATIVE_CODEGEN
+        void CheckNativeCodeHint();
+        void RecordNativeCodeHint();
+#endif
+
         bool GetHasNestedLoop() const { return hasNestedLoop; };
         void SetHasNestedLoop(bool nest) { hasNestedLoop = nest; };
 
@@ -25,113 +25,254 @@ namespace Js
     }
 
     LineOffsetCache::LineOffsetCache(Recycler* allocator,
-        _In_z_ LPCUTF8 sourceStartCharacter,
-        _In_z_ LPCUTF8 sourceEndCharacter,
+        Utf8SourceInfo* sourceInfo,
         charcount_t startingCharacterOffset,
         charcount_t startingByteOffset) :
-        lineCharacterOffsetCacheList(nullptr),
-        lineByteOffsetCacheList(nullptr)
+        recycler(allocator),
+        sourceInfo(sourceInfo),
+        lineChunks(nullptr),
+        lineCharacterDeltas(nullptr),
+        lineByteDeltas(nullptr),
+        lastLineCharacterOffset(0),
+        lastLineByteOffset(0),
+        hasByteOffsets(false)
     {
         AssertMsg(allocator, "An allocator must be supplied to the cache for allocation of items.");
-        this->BuildCache(allocator, sourceStartCharacter, sourceEndCharacter, startingCharacterOffset, startingByteOffset);
+        AssertMsg(sourceInfo, "The source info passed in is null.");
+        this->Initialize();
+
+        // Add the first line in the cache list.
+        this->AddLine(startingCharacterOffset, startingByteOffset);
     }
 
     LineOffsetCache::LineOffsetCache(Recycler *allocator,
         _In_reads_(numberOfLines) const charcount_t *lineCharacterOffsets,
         _In_reads_opt_(numberOfLines) const charcount_t *lineByteOffsets,
-        __in int numberOfLines)
+        __in int numberOfLines) :
+        recycler(allocator),
+        sourceInfo(nullptr),
+        lineChunks(nullptr),
+        lineCharacterDeltas(nullptr),
+        lineByteDeltas(nullptr),
+        lastLineCharacterOffset(0),
+        lastLineByteOffset(0),
+        hasByteOffsets(false)
     {
-        this->lineCharacterOffsetCacheList = LineOffsetCacheReadOnlyList::New(allocator, (charcount_t *)lineCharacterOffsets, numberOfLines);
-        if (lineByteOffsets)
-        {
-            this->lineByteOffsetCacheList = LineOffsetCacheReadOnlyList::New(allocator, (charcount_t *)lineByteOffsets, numberOfLines);
-        }
-        else
+        this->Initialize();
+        this->lineCharacterDeltas->EnsureArray(numberOfLines);
+
+        for (int i = 0; i < numberOfLines; i++)
         {
-            this->lineByteOffsetCacheList = nullptr;
+            this->AddLine(lineCharacterOffsets[i], lineByteOffsets ? lineByteOffsets[i] : lineCharacterOffsets[i]);
         }
     }
 
+    void LineOffsetCache::Initialize()
+    {
+        this->lineChunks = RecyclerNew(this->recycler, LineChunkList, this->recycler);
+        this->lineCharacterDeltas = RecyclerNew(this->recycler, LineDeltaList, this->recycler);
+    }
+
     // outLineCharOffset - The character offset of the start of the line returned
     int LineOffsetCache::GetLineForCharacterOffset(charcount_t characterOffset, charcount_t *outLineCharOffset, charcount_t *outByteOffset)
     {
-        Assert(this->lineCharacterOffsetCacheList->Count() > 0);
+        // The line holding the offset is only known once the start of the line after it has been seen.
+        this->ScanWhile([&]() { return this->lastLineCharacterOffset <= characterOffset; });
 
-        // The list is sorted, so binary search to find the line info.
-        int closestIndex = -1;
-        int minRange = INT_MAX;
+        return this->FindLineInScannedLines(characterOffset, outLineCharOffset, outByteOffset);
+    }
 
-        this->lineCharacterOffsetCacheList->BinarySearch([&](const charcount_t item, int index)
+    bool LineOffsetCache::TryGetLineForCharacterOffset(charcount_t characterOffset, int *outLine, charcount_t *outLineCharOffset, charcount_t *outByteOffset) const
+    {
+        // The main thread may still be adding lines to a cache that isn't complete; only a complete cache is
+        // safe to read here. Pairs with the barrier in ScanWhile.
+        if (!this->IsComplete())
         {
-            int offsetRange = characterOffset - item;
-            if (offsetRange >= 0)
-            {
-                if (offsetRange < minRange)
-                {
-                    // There are potentially many lines with starting offsets greater than the one we're searching
-                    // for.  As a result, we should track which index we've encountered so far that is the closest
-                    // to the offset we're looking for without going under.  This will find the line that contains
-                    // the offset.
-                    closestIndex = index;
-                    minRange = offsetRange;
-                }
+            return false;
+        }
+        MemoryBarrier();
 
-                // Search lower to see if we can find a closer index.
-                return -1;
-            }
-            else
-            {
-                // Search higher to get into a range that is greater than the offset.
-                return 1;
-            }
+        *outLine = this->FindLineInScannedLines(characterOffset, outLineCharOffset, outByteOffset);
+        return true;
+    }
 
-            // Note that we purposely don't return 0 (==) here.  We want the search to end in failure (-1) because
-            // we're searching for the closest element, not necessarily an exact element offset.  Exact offsets
-            // are possible when the offset we're searching for is the first character of the line, but that will
-            // be handled by the if statement above.
-        });
+    int LineOffsetCache::FindLineInScannedLines(charcount_t characterOffset, charcount_t *outLineCharOffset, charcount_t *outByteOffset) const
+    {
+        Assert(this->GetScannedLineCount() > 0);
 
-        if (closestIndex >= 0)
+        int chunkIndex = this->FindLastChunk([&](const LineChunk& chunk) { return chunk.characterOffset <= characterOffset; });
+        if (chunkIndex < 0)
         {
-            charcount_t lastItemCharacterOffset = GetCharacterOffsetForLine(closestIndex, outByteOffset);
+            return -1;
+        }
 
-            if (outLineCharOffset != nullptr)
-            {
-                *outLineCharOffset = lastItemCharacterOffset;
-            }
+        charcount_t lineCharacterOffset;
+        charcount_t line = this->WalkChunk(chunkIndex,
+            [&](charcount_t, charcount_t nextLineCharacterOffset) { return nextLineCharacterOffset <= characterOffset; },
+            &lineCharacterOffset, outByteOffset);
+
+        if (outLineCharOffset != nullptr)
+        {
+            *outLineCharOffset = lineCharacterOffset;
         }
 
-        return closestIndex;
+        return line;
     }
 
-    charcount_t LineOffsetCache::GetCharacterOffsetForLine(charcount_t line, charcount_t *outByteOffset) const
+    charcount_t LineOffsetCache::GetCharacterOffsetForLine(charcount_t line, charcount_t *outByteOffset)
     {
-        AssertMsg(line < this->GetLineCount(), "Invalid line value passed in.");
+        this->ScanWhile([&]() { return this->GetScannedLineCount() <= line; });
 
-        charcount_t characterOffset = this->lineCharacterOffsetCacheList->Item(line);
+        AssertMsg(line < this->GetScannedLineCount(), "Invalid line value passed in.");
 
-        if (outByteOffset != nullptr)
-        {            
-            *outByteOffset = this->lineByteOffsetCacheList? this->lineByteOffsetCacheList->Item(line) : characterOffset;            
-        }
+        int chunkIndex = this->FindLastChunk([&](const LineChunk& chunk) { return chunk.firstLine <= line; });
+        Assert(chunkIndex >= 0);
+
+        charcount_t characterOffset;
+        this->WalkChunk(chunkIndex,
+            [&](charcount_t nextLine, charcount_t) { return nextLine <= line; },
+            &characterOffset, outByteOffset);
 
         return characterOffset;
     }
 
-    uint32 LineOffsetCache::GetLineCount() const
+    bool LineOffsetCache::HasLine(charcount_t line)
+    {
+        this->ScanWhile([&]() { return this->GetScannedLineCount() <= line; });
+        return line < this->GetScannedLineCount();
+    }
+
+    uint32 LineOffsetCache::GetLineCount()
+    {
+        this->ScanWhile([]() { return true; });
+        return this->GetScannedLineCount();
+    }
+
+    bool LineOffsetCache::HasByteOffsets() const
+    {
+        AssertMsg(this->IsComplete(), "GetLineCount should have been called.");
+        return this->hasByteOffsets;
+    }
+
+    void LineOffsetCache::CopyLineOffsets(
+        _Out_writes_(lineCount) charcount_t *lineCharacterOffsets,
+        _Out_writes_opt_(lineCount) charcount_t *lineByteOffsets,
+        uint32 lineCount) const
+    {
+        AssertMsg(this->IsComplete(), "GetLineCount should have been called.");
+        AssertMsg(lineCount == this->GetScannedLineCount(), "Buffers must hold every line.");
+
+        charcount_t characterOffset = 0;
+        charcount_t byteOffset = 0;
+        int nextChunkIndex = 0;
+        for (uint32 line = 0; line < lineCount; line++)
+        {
+            if (nextChunkIndex < this->lineChunks->Count() && this->lineChunks->Item(nextChunkIndex).firstLine == line)
+            {
+                const LineChunk& chunk = this->lineChunks->Item(nextChunkIndex++);
+                characterOffset = chunk.characterOffset;
+                byteOffset = chunk.byteOffset;
+            }
+            else
+            {
+                characterOffset += this->lineCharacterDeltas->Item(line);
+                byteOffset += this->lineByteDeltas ? this->lineByteDeltas->Item(line) : this->lineCharacterDeltas->Item(line);
+            }
+
+            lineCharacterOffsets[line] = characterOffset;
+            if (lineByteOffsets != nullptr)
+            {
+                lineByteOffsets[line] = byteOffset;
+            }
+        }
+    }
+
+    template <class Fn>
+    void LineOffsetCache::ScanWhile(Fn needMoreLines)
     {
-        AssertMsg(this->lineCharacterOffsetCacheList != nullptr, "The list was either not set from the ByteCode or not created.");
-        return this->lineCharacterOffsetCacheList->Count();
+        if (this->IsComplete() || !needMoreLines())
+        {
+            return;
+        }
+
+        LPCUTF8 sourceStartCharacter = this->sourceInfo->GetSource(_u("LineOffsetCache::ScanWhile"));
+        LPCUTF8 sourceEndCharacter = sourceStartCharacter + this->sourceInfo->GetCbLength(_u("LineOffsetCache::ScanWhile"));
+        AssertMsg(sourceStartCharacter + this->lastLineByteOffset <= sourceEndCharacter, "The scan position should not be beyond the source end character.");
+
+        // Resume at the start of the last line found. Its offsets are only committed by AddLine, so a failure
+        // part way through leaves the cache where it was.
+        LPCUTF8 currentSourcePosition = sourceStartCharacter + this->lastLineByteOffset;
+        charcount_t characterOffset = this->lastLineCharacterOffset;
+        charcount_t byteOffset = this->lastLineByteOffset;
+
+        do
+        {
+            if (!FindNextLine(currentSourcePosition, sourceEndCharacter, characterOffset, byteOffset))
+            {
+                // Every line has been found, the source isn't needed anymore. The cache doesn't change after
+                // this, so make the lines visible to TryGetLineForCharacterOffset before marking it complete.
+                MemoryBarrier();
+                this->sourceInfo = nullptr;
+                return;
+            }
+
+            this->AddLine(characterOffset, byteOffset);
+        } while (needMoreLines());
     }
 
-    const charcount_t * LineOffsetCache::GetLineCharacterOffsetBuffer() const
+    template <class Fn>
+    int LineOffsetCache::FindLastChunk(Fn isAtOrBefore) const
     {
-        return this->lineCharacterOffsetCacheList->GetBuffer();
+        // Chunks are sorted, so isAtOrBefore holds for a prefix of the list.
+        int low = 0;
+        int high = this->lineChunks->Count() - 1;
+        int found = -1;
+        while (low <= high)
+        {
+            int mid = low + (high - low) / 2;
+            if (isAtOrBefore(this->lineChunks->Item(mid)))
+            {
+                found = mid;
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid - 1;
+            }
+        }
+        return found;
     }
 
-    const charcount_t * LineOffsetCache::GetLineByteOffsetBuffer() const
+    template <class Fn>
+    charcount_t LineOffsetCache::WalkChunk(int chunkIndex, Fn shouldAdvance, charcount_t *outCharacterOffset, charcount_t *outByteOffset) const
     {
-        return this->lineByteOffsetCacheList ? this->lineByteOffsetCacheList->GetBuffer() : nullptr;
+        const LineChunk& chunk = this->lineChunks->Item(chunkIndex);
+        charcount_t chunkEnd = chunkIndex + 1 < this->lineChunks->Count() ?
+            this->lineChunks->Item(chunkIndex + 1).firstLine :
+            this->GetScannedLineCount();
+
+        charcount_t line = chunk.firstLine;
+        charcount_t characterOffset = chunk.characterOffset;
+        charcount_t byteOffset = chunk.byteOffset;
+        while (line + 1 < chunkEnd)
+        {
+            charcount_t nextLineCharacterOffset = characterOffset + this->lineCharacterDeltas->Item(line + 1);
+            if (!shouldAdvance(line + 1, nextLineCharacterOffset))
+            {
+                break;
+            }
+
+            line++;
+            byteOffset += this->lineByteDeltas ? this->lineByteDeltas->Item(line) : this->lineCharacterDeltas->Item(line);
+            characterOffset = nextLineCharacterOffset;
+        }
+
+        *outCharacterOffset = characterOffset;
+        if (outByteOffset != nullptr)
+        {
+            *outByteOffset = byteOffset;
+        }
+        return line;
     }
 
     bool LineOffsetCache::FindNextLine(_In_z_ LPCUTF8 &currentSourcePosition, _In_z_ LPCUTF8 sourceEndCharacter, charcount_t &inOutCharacterOffset, charcount_t &inOutByteOffset, charcount_t maxCharacterOffset)
@@ -190,59 +331,69 @@ namespace Js
         return false;
     }
 
-    // Builds the cache of line offsets from the passed in source.
-    void LineOffsetCache::BuildCache(Recycler * allocator, _In_z_ LPCUTF8 sourceStartCharacter,
-        _In_z_ LPCUTF8 sourceEndCharacter,
-        charcount_t startingCharacterOffset,
-        charcount_t startingByteOffset)
+    // Tracks a new line offset in the cache.
+    void LineOffsetCache::AddLine(charcount_t characterOffset, charcount_t byteOffset)
     {
-        AssertMsg(sourceStartCharacter, "The source start character passed in is null.");
-        AssertMsg(sourceEndCharacter, "The source end character passed in is null.");
-        AssertMsg(sourceStartCharacter <= sourceEndCharacter, "The source start character should not be beyond the source end character.");
-        AssertMsg(!this->lineCharacterOffsetCacheList, "The cache is already built.");
+        uint32 line = this->GetScannedLineCount();
+        Assert(this->lineByteDeltas == nullptr || (uint32)this->lineByteDeltas->Count() == line);
 
-        this->lineCharacterOffsetCacheList = RecyclerNew(allocator, LineOffsetCacheList, allocator);
+        charcount_t characterDelta = 0;
+        charcount_t byteDelta = 0;
+        bool startsChunk = true;
+        if (line > 0)
+        {
+            // Ensure that the list remains sorted during insertion.
+            AssertMsg(characterOffset > this->lastLineCharacterOffset, "The character offsets must be inserted in increasing order per line.");
+            AssertMsg(byteOffset > this->lastLineByteOffset, "The byte offsets must be inserted in increasing order per line.");
 
-        // Add the first line in the cache list.
-        this->AddLine(allocator, startingCharacterOffset, startingByteOffset);
+            characterDelta = characterOffset - this->lastLineCharacterOffset;
+            byteDelta = byteOffset - this->lastLineByteOffset;
 
-        while (FindNextLine(sourceStartCharacter, sourceEndCharacter, startingCharacterOffset, startingByteOffset))
-        {
-            this->AddLine(allocator, startingCharacterOffset, startingByteOffset);
+            const LineChunk& lastChunk = this->lineChunks->Item(this->lineChunks->Count() - 1);
+            startsChunk = line - lastChunk.firstLine >= LinesPerChunk ||
+                characterDelta > UINT16_MAX ||
+                byteDelta > UINT16_MAX;
         }
 
-    }
+        if (startsChunk)
+        {
+            characterDelta = 0;
+            byteDelta = 0;
+        }
 
-    // Tracks a new line offset in the cache.
-    void LineOffsetCache::AddLine(Recycler * allocator, charcount_t characterOffset, charcount_t byteOffset)
-    {
-        LineOffsetCacheList * characterOffsetList = (LineOffsetCacheList *)(LineOffsetCacheReadOnlyList*)this->lineCharacterOffsetCacheList;
-        characterOffsetList->Add(characterOffset);
-        LineOffsetCacheList * byteOffsetList = (LineOffsetCacheList *)(LineOffsetCacheReadOnlyList*)this->lineByteOffsetCacheList;
-        if (byteOffsetList == nullptr && characterOffset != byteOffset)
+        // Make room in every list before changing any of them, so that running out of memory here leaves the
+        // cache consistent.
+        this->lineCharacterDeltas->EnsureArray(line + 1);
+        if (this->lineByteDeltas == nullptr && byteDelta != characterDelta)
         {
-            byteOffsetList = RecyclerNew(allocator, LineOffsetCacheList, allocator);
-            byteOffsetList->Copy(characterOffsetList);
-            this->lineByteOffsetCacheList = byteOffsetList;
+            LineDeltaList * byteDeltas = RecyclerNew(this->recycler, LineDeltaList, this->recycler);
+            byteDeltas->EnsureArray(line + 1);
+            byteDeltas->Copy(this->lineCharacterDeltas);
+            this->lineByteDeltas = byteDeltas;
         }
-        else if (byteOffsetList != nullptr)
+        else if (this->lineByteDeltas != nullptr)
         {
-            byteOffsetList->Add(byteOffset);
-        }        
+            this->lineByteDeltas->EnsureArray(line + 1);
+        }
+        if (startsChunk)
+        {
+            this->lineChunks->EnsureArray(this->lineChunks->Count() + 1);
+        }
 
-#if DBG
-        Assert(this->lineByteOffsetCacheList == nullptr || this->lineByteOffsetCacheList->Count() == this->lineCharacterOffsetCacheList->Count());
-        if (this->lineCharacterOffsetCacheList->Count() > 1)
+        // Nothing below allocates.
+        if (startsChunk)
         {
-            // Ensure that the list remains sorted during insertion.
-            charcount_t previousCharacterOffset = this->lineCharacterOffsetCacheList->Item(this->lineCharacterOffsetCacheList->Count() - 2);
-            AssertMsg(characterOffset > previousCharacterOffset, "The character offsets must be inserted in increasing order per line.");
-            if (this->lineByteOffsetCacheList != nullptr)
-            {
-                charcount_t previousByteOffset = this->lineByteOffsetCacheList->Item(this->lineByteOffsetCacheList->Count() - 2);
-                AssertMsg(byteOffset > previousByteOffset, "The byte offsets must be inserted in increasing order per line.");
-            }
+            LineChunk chunk = { line, characterOffset, byteOffset };
+            this->lineChunks->Add(chunk);
         }
-#endif // DBG
+        this->lineCharacterDeltas->Add((uint16)characterDelta);
+        if (this->lineByteDeltas != nullptr)
+        {
+            this->lineByteDeltas->Add((uint16)byteDelta);
+        }
+
+        this->lastLineCharacterOffset = characterOffset;
+        this->lastLineByteOffset = byteOffset;
+        this->hasByteOffsets = this->hasByteOffsets || characterOffset != byteOffset;
     }
 }
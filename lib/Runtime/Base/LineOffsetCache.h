@@ -6,11 +6,29 @@
 
 namespace Js
 {
+    class Utf8SourceInfo;
+
+    // Maps between character offsets in a UTF-8 source and line numbers.
+    //
+    // The cache is filled in lazily: the source is only scanned as far as the furthest line or offset that has
+    // been asked for, so formatting a stack frame near the top of a large bundle doesn't index all of it.
+    // Line starts are stored in chunks of up to LinesPerChunk lines. A chunk records the absolute offsets of its
+    // first line and the lines after that are stored as 16-bit deltas from the line before. A line whose delta
+    // doesn't fit in 16 bits starts a new chunk.
     class LineOffsetCache
     {
     private:
-        typedef JsUtil::List<charcount_t, Recycler, true /*isLeaf*/> LineOffsetCacheList;
-        typedef JsUtil::ReadOnlyList<charcount_t> LineOffsetCacheReadOnlyList;
+        static const charcount_t LinesPerChunk = 64;
+
+        struct LineChunk
+        {
+            charcount_t firstLine;
+            charcount_t characterOffset;
+            charcount_t byteOffset;
+        };
+
+        typedef JsUtil::List<LineChunk, Recycler, true /*isLeaf*/> LineChunkList;
+        typedef JsUtil::List<uint16, Recycler, true /*isLeaf*/> LineDeltaList;
 
     public:
 
@@ -21,9 +39,9 @@ namespace Js
             charcount_t &inOutByteOffset,
             charcount_t characterOffset);
 
+        // Lines are found on demand by scanning the source of sourceInfo, starting at the given offsets.
         LineOffsetCache(Recycler* allocator,
-            _In_z_ LPCUTF8 sourceStartCharacter,
-            _In_z_ LPCUTF8 sourceEndCharacter,
+            Utf8SourceInfo* sourceInfo,
             charcount_t startingCharacterOffset = 0,
             charcount_t startingByteOffset = 0);
 
@@ -35,26 +53,72 @@ namespace Js
         // outLineCharOffset - The character offset of the start of the line returned
         int GetLineForCharacterOffset(charcount_t characterOffset, charcount_t *outLineCharOffset, charcount_t *outByteOffset);
 
-        charcount_t GetCharacterOffsetForLine(charcount_t line, charcount_t *outByteOffset) const;
+        // Same as GetLineForCharacterOffset, but never scans or allocates, so it can be used off the main thread
+        // (e.g. by the background JIT). Only succeeds once the whole source has been scanned; the cache doesn't
+        // change after that.
+        bool TryGetLineForCharacterOffset(charcount_t characterOffset, int *outLine, charcount_t *outLineCharOffset, charcount_t *outByteOffset) const;
 
-        uint32 GetLineCount() const;
+        charcount_t GetCharacterOffsetForLine(charcount_t line, charcount_t *outByteOffset);
 
-        const charcount_t * GetLineCharacterOffsetBuffer() const;
-        const charcount_t * GetLineByteOffsetBuffer() const;
+        // Returns whether the source has the given line, without scanning past it.
+        bool HasLine(charcount_t line);
+
+        // Scans the rest of the source if it hasn't been scanned yet.
+        uint32 GetLineCount();
+
+        // Whether any line starts at a byte offset different from its character offset. Only valid once the line
+        // count is known.
+        bool HasByteOffsets() const;
+
+        // Expands the cache into flat arrays of lineCount entries. lineByteOffsets is only written if HasByteOffsets.
+        void CopyLineOffsets(
+            _Out_writes_(lineCount) charcount_t *lineCharacterOffsets,
+            _Out_writes_opt_(lineCount) charcount_t *lineByteOffsets,
+            uint32 lineCount) const;
 
     private:
 
         static bool FindNextLine(_In_z_ LPCUTF8 &currentSourcePosition, _In_z_ LPCUTF8 sourceEndCharacter, charcount_t &inOutCharacterOffset, charcount_t &inOutByteOffset, charcount_t maxCharacterOffset = UINT32_MAX);
 
-        // Builds the cache of line offsets from the passed in source.
-        void BuildCache(Recycler * allocator, _In_z_ LPCUTF8 sourceStartCharacter, _In_z_ LPCUTF8 sourceEndCharacter, charcount_t startingCharacterOffset, charcount_t startingByteOffset);
+        bool IsComplete() const { return this->sourceInfo == nullptr; }
+
+        // Looks the offset up in the lines scanned so far.
+        int FindLineInScannedLines(charcount_t characterOffset, charcount_t *outLineCharOffset, charcount_t *outByteOffset) const;
+        uint32 GetScannedLineCount() const { return this->lineCharacterDeltas->Count(); }
+
+        void Initialize();
+
+        // Scans the source for further lines for as long as needMoreLines returns true.
+        template <class Fn>
+        void ScanWhile(Fn needMoreLines);
+
+        // Index of the last chunk for which isAtOrBefore returns true, or -1.
+        template <class Fn>
+        int FindLastChunk(Fn isAtOrBefore) const;
+
+        // Walks the lines of a chunk for as long as shouldAdvance(nextLine, nextLineCharacterOffset) returns true.
+        // Returns the line stopped at.
+        template <class Fn>
+        charcount_t WalkChunk(int chunkIndex, Fn shouldAdvance, charcount_t *outCharacterOffset, charcount_t *outByteOffset) const;
 
         // Tracks a new line offset in the cache.
-        void AddLine(Recycler * allocator, charcount_t characterOffset, charcount_t byteOffset);
-        
+        void AddLine(charcount_t characterOffset, charcount_t byteOffset);
+
     private:
-        // Line offset cache list used for quickly finding line/column offsets.
-        Field(LineOffsetCacheReadOnlyList*) lineCharacterOffsetCacheList;
-        Field(LineOffsetCacheReadOnlyList*) lineByteOffsetCacheList;
+        FieldNoBarrier(Recycler*) recycler;
+
+        // The source still being scanned; null once every line has been found.
+        Field(Utf8SourceInfo*) sourceInfo;
+
+        Field(LineChunkList*) lineChunks;
+        Field(LineDeltaList*) lineCharacterDeltas;
+        // Only allocated once some line's byte delta differs from its character delta.
+        Field(LineDeltaList*) lineByteDeltas;
+
+        // Start of the last line found, where scanning resumes.
+        Field(charcount_t) lastLineCharacterOffset;
+        Field(charcount_t) lastLineByteOffset;
+
+        Field(bool) hasByteOffsets;
     };
 }
@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+#include "NativeCodeHintCache.h"
+
+#if ENABLE_NATIVE_CODEGEN
+namespace Js
+{
+    NativeCodeHintCache::KeySet * NativeCodeHintCache::fullJittedFunctions = nullptr;
+    CriticalSection NativeCodeHintCache::cs;
+
+    bool NativeCodeHintCache::TryGetKey(FunctionBody * functionBody, Key * key)
+    {
+        Assert(functionBody);
+        Assert(key);
+
+        Utf8SourceInfo * sourceInfo = functionBody->GetUtf8SourceInfo();
+        if (sourceInfo == nullptr ||
+            sourceInfo->GetIsLibraryCode() ||
+            sourceInfo->GetSourceHolder()->IsDeferrable() ||
+            functionBody->LengthInBytes() == 0)
+        {
+            // Don't force the source of a deferred-source script to be loaded just to compute the key
+            return false;
+        }
+
+        LPCUTF8 source = functionBody->GetSource(_u("NativeCodeHintCache::TryGetKey"));
+        key->sourceHash = JsUtil::CharacterBuffer<utf8char_t>::StaticGetHashCode(source, functionBody->LengthInBytes());
+        key->sourceByteLength = functionBody->LengthInBytes();
+        key->byteCodeCount = functionBody->GetByteCodeCount();
+        key->isStrictMode = functionBody->GetIsStrictMode();
+        return true;
+    }
+
+    void NativeCodeHintCache::RecordFullJit(Key const& key)
+    {
+        AutoCriticalSection autocs(&cs);
+        if (fullJittedFunctions == nullptr)
+        {
+            fullJittedFunctions = HeapNewNoThrow(KeySet, &HeapAllocator::Instance);
+            if (fullJittedFunctions == nullptr)
+            {
+                // The hint is only an optimization
+                return;
+            }
+        }
+        else if (fullJittedFunctions->Count() >= MaxEntryCount)
+        {
+            fullJittedFunctions->Clear();
+        }
+
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+            fullJittedFunctions->AddNew(key);
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            // The hint is only an optimization
+        }
+    }
+
+    bool NativeCodeHintCache::WasFullJitted(Key const& key)
+    {
+        AutoCriticalSection autocs(&cs);
+        return fullJittedFunctions != nullptr && fullJittedFunctions->Contains(key);
+    }
+
+    void NativeCodeHintCache::Cleanup()
+    {
+        AutoCriticalSection autocs(&cs);
+        if (fullJittedFunctions != nullptr)
+        {
+            HeapDelete(fullJittedFunctions);
+            fullJittedFunctions = nullptr;
+        }
+    }
+};
+#endif
@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_NATIVE_CODEGEN
+namespace Js
+{
+    // Process-wide, content-addressed record of functions that reached full JIT in some runtime.
+    //
+    // Native code can't be shared between runtimes directly: the JIT bakes in the addresses of the owning
+    // ScriptContext's inline caches, types, library objects and number allocations. What can be shared is
+    // the knowledge that a function with byte-identical source was hot enough to be full JITed elsewhere.
+    // A runtime that loads the same bundle uses that to skip simple JIT and the execution mode warm-up for
+    // the function, and schedules it for full JIT as soon as the minimal profiling interpreter run completes.
+    //
+    // The hint only changes when a function is full JITed, never the code: each runtime still JITs from its own
+    // byte code and profile, under its own flags. So the key only has to make a match likely to be as hot. It
+    // includes strict mode, which the function can inherit from the enclosing code and which changes its byte
+    // code without changing its source. Other differences between the runtimes (process-wide config flags are the
+    // same for all of them) can at worst get a function full JITed earlier than it would have been.
+    class NativeCodeHintCache
+    {
+    public:
+        struct Key
+        {
+            hash_t sourceHash;
+            uint sourceByteLength;
+            uint byteCodeCount;
+            bool isStrictMode;
+
+            bool operator==(Key const& other) const
+            {
+                return sourceHash == other.sourceHash &&
+                    sourceByteLength == other.sourceByteLength &&
+                    byteCodeCount == other.byteCodeCount &&
+                    isStrictMode == other.isStrictMode;
+            }
+
+            operator hash_t() const
+            {
+                return sourceHash ^ (sourceByteLength * 31) ^ (byteCodeCount << 7) ^ (isStrictMode ? 1 : 0);
+            }
+        };
+
+        static bool TryGetKey(FunctionBody * functionBody, Key * key);
+        static void RecordFullJit(Key const& key);
+        static bool WasFullJitted(Key const& key);
+
+        // Frees the table when the process shuts the engine down; it is recreated on the next use.
+        static void Cleanup();
+
+    private:
+        // Bound the table so a long running process that keeps loading new sources doesn't grow it forever.
+        static const uint MaxEntryCount = 64 * 1024;
+
+        typedef JsUtil::BaseHashSet<Key, HeapAllocator, PrimeSizePolicy> KeySet;
+        static KeySet * fullJittedFunctions;   // Created on first use
+        static CriticalSection cs;
+    };
+};
+#endif
@@ -269,6 +269,8 @@ namespace Js
         byteCodeAuxiliaryDataSize = 0;
         byteCodeAuxiliaryContextDataSize = 0;
         memset(byteCodeHistogram, 0, sizeof(byteCodeHistogram));
+        byteCodePairHistogram = nullptr;
+        lastTracedOpCode = OpCode::ByteCodeLast;
 #endif
 
 #if DBG || defined(RUNTIME_DATA_COLLECTION)
@@ -527,6 +529,14 @@ namespace Js
         }
 #endif
 
+#if DBG_DUMP
+        if (this->byteCodePairHistogram != nullptr)
+        {
+            HeapDeleteArray((uint)OpCode::ByteCodeLast * (uint)OpCode::ByteCodeLast, this->byteCodePairHistogram);
+            this->byteCodePairHistogram = nullptr;
+        }
+#endif
+
 #ifdef ASMJS_PLAT
         if (this->asmJsInterpreterThunkEmitter != nullptr)
         {
@@ -1282,7 +1292,8 @@ namespace Js
         this->guestArena = this->GetRecycler()->CreateGuestArena(_u("Guest"), Throw::OutOfMemory);
 
 #if ENABLE_BACKGROUND_PARSING
-        if (PHASE_ON1(Js::ParallelParsePhase))
+        if (PHASE_ON1(Js::ParallelParsePhase) ||
+            (CONFIG_FLAG_RELEASE(ParallelParseIIFE) && !PHASE_OFF1(Js::ParallelParsePhase)))
         {
             this->backgroundParser = BackgroundParser::New(this);
         }
@@ -2605,7 +2616,13 @@ namespace Js
         }
 
 #if ENABLE_PROFILE_INFO
-        if (!this->startupComplete)
+        SourceDynamicProfileManager * seededProfileManager = nullptr;
+        if (this->Cache()->seededSourceDynamicProfileManagerMap != nullptr &&
+            this->Cache()->seededSourceDynamicProfileManagerMap->TryGetValueAndRemove(sourceContext, &seededProfileManager))
+        {
+            sourceContextInfo->sourceDynamicProfileManager = seededProfileManager;
+        }
+        else if (!this->startupComplete)
         {
             sourceContextInfo->sourceDynamicProfileManager = SourceDynamicProfileManager::LoadFromDynamicProfileStorage(sourceContextInfo, this, profileDataCache);
             Assert(sourceContextInfo->sourceDynamicProfileManager != NULL);
@@ -2616,6 +2633,42 @@ namespace Js
         return sourceContextInfo;
     }
 
+#if ENABLE_PROFILE_INFO
+    //
+    // Returns the profile manager that profile data set by the host for the given source context goes into.
+    // A script that is already loaded gets it directly, so the functions it hasn't compiled yet pick up the profiles;
+    // otherwise the manager is held until CreateSourceContextInfo is called for that source context.
+    //
+    SourceDynamicProfileManager * ScriptContext::EnsureSeededSourceDynamicProfileManager(DWORD_PTR hostSourceContext)
+    {
+        Assert(hostSourceContext != Js::Constants::NoHostSourceContext);
+
+        EnsureSourceContextInfoMap();
+        SourceContextInfo * sourceContextInfo = nullptr;
+        if (this->Cache()->sourceContextInfoMap->TryGetValue(hostSourceContext, &sourceContextInfo))
+        {
+            if (sourceContextInfo->sourceDynamicProfileManager == nullptr)
+            {
+                sourceContextInfo->sourceDynamicProfileManager = RecyclerNew(this->GetRecycler(), SourceDynamicProfileManager, this->GetRecycler());
+            }
+            return sourceContextInfo->sourceDynamicProfileManager;
+        }
+
+        if (this->Cache()->seededSourceDynamicProfileManagerMap == nullptr)
+        {
+            this->Cache()->seededSourceDynamicProfileManagerMap = RecyclerNew(this->GetRecycler(), SeededSourceDynamicProfileManagerMap, this->GetRecycler());
+        }
+
+        SourceDynamicProfileManager * profileManager = nullptr;
+        if (!this->Cache()->seededSourceDynamicProfileManagerMap->TryGetValue(hostSourceContext, &profileManager))
+        {
+            profileManager = RecyclerNew(this->GetRecycler(), SourceDynamicProfileManager, this->GetRecycler());
+            this->Cache()->seededSourceDynamicProfileManagerMap->Add(hostSourceContext, profileManager);
+        }
+        return profileManager;
+    }
+#endif
+
     // static
     const char16* ScriptContext::CopyString(const char16* str, size_t charCount, ArenaAllocator* alloc)
     {
@@ -5390,6 +5443,90 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
         dest.hash = TAGHASH((hash_t)dest.str);
     }
 
+#if DBG_DUMP
+    void ScriptContext::RecordByteCodePair(OpCode op)
+    {
+        if (OpCodeUtil::IsPrefixOpcode(op))
+        {
+            // Pair the prefixed op with the one before the prefix
+            return;
+        }
+
+        const uint opCount = (uint)OpCode::ByteCodeLast;
+        if (byteCodePairHistogram == nullptr)
+        {
+            byteCodePairHistogram = HeapNewArrayZ(uint, opCount * opCount);
+        }
+
+        // Ops are traced across calls and returns too, which adds a bit of noise at frame boundaries.
+        if (lastTracedOpCode != OpCode::ByteCodeLast)
+        {
+            byteCodePairHistogram[(uint)lastTracedOpCode * opCount + (uint)op]++;
+        }
+        lastTracedOpCode = op;
+    }
+
+    void ScriptContext::PrintByteCodePairHistogram()
+    {
+        if (byteCodePairHistogram == nullptr)
+        {
+            return;
+        }
+
+        const uint opCount = (uint)OpCode::ByteCodeLast;
+        const uint pairCount = opCount * opCount;
+        const uint maxPairsPrinted = 50;
+
+        uint64 total = 0;
+        for (uint i = 0; i < pairCount; i++)
+        {
+            total += byteCodePairHistogram[i];
+        }
+
+        Output::Print(_u("ByteCode Pair Histogram\n"));
+        Output::Print(_u("\n"));
+        Output::Print(_u("%9llu                     Total executed pairs\n"), total);
+        Output::Print(_u("\n"));
+
+        // Selection of the top pairs; the table is only walked a fixed number of times.
+        uint max = UINT_MAX;
+        uint printed = 0;
+        double pctcume = 0.0;
+        while (printed < maxPairsPrinted && total != 0)
+        {
+            uint upper = 0;
+            for (uint i = 0; i < pairCount; i++)
+            {
+                if (byteCodePairHistogram[i] > upper && byteCodePairHistogram[i] < max)
+                {
+                    upper = byteCodePairHistogram[i];
+                }
+            }
+
+            if (upper == 0)
+            {
+                break;
+            }
+
+            max = upper;
+            for (uint i = 0; i < pairCount && printed < maxPairsPrinted; i++)
+            {
+                if (byteCodePairHistogram[i] == max)
+                {
+                    OpCode first = (OpCode)(i / opCount);
+                    OpCode second = (OpCode)(i % opCount);
+                    double pct = ((double)max) / total;
+                    pctcume += pct;
+                    printed++;
+
+                    Output::Print(_u("%9u  %5.1lf  %5.1lf  %s %s\n"), max, pct * 100, pctcume * 100, OpCodeUtil::GetOpCodeName(first), OpCodeUtil::GetOpCodeName(second));
+                }
+            }
+        }
+        Output::Print(_u("\n"));
+    }
+#endif
+
     void ScriptContext::PrintStats()
     {
 
@@ -5502,6 +5639,11 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
             Output::Print(_u("Unique opcodes: %d\n"), unique);
         }
 
+        if (Configuration::Global.flags.BytecodePairHist)
+        {
+            PrintByteCodePairHistogram();
+        }
+
 #endif
 
 #if ENABLE_NATIVE_CODEGEN
@@ -674,6 +674,11 @@ namespace Js
         uint byteCodeAuxiliaryDataSize;
         uint byteCodeAuxiliaryContextDataSize;
         uint byteCodeHistogram[static_cast<uint>(OpCode::ByteCodeLast)];
+        // ByteCodeLast x ByteCodeLast counts indexed by [previous op][op], only allocated with -BytecodePairHist
+        uint * byteCodePairHistogram;
+        OpCode lastTracedOpCode;
+        void RecordByteCodePair(OpCode op);
+        void PrintByteCodePairHistogram();
         uint32 forinCache;
         uint32 forinNoCache;
 #endif
@@ -1088,6 +1093,9 @@ namespace Js
         SourceContextInfo * CreateSourceContextInfo(uint hash, DWORD_PTR hostSourceContext);
         SourceContextInfo * CreateSourceContextInfo(DWORD_PTR hostSourceContext, char16 const * url, size_t len,
             IActiveScriptDataCache* profileDataCache, char16 const * sourceMapUrl = nullptr, size_t sourceMapUrlLen = 0);
+#if ENABLE_PROFILE_INFO
+        SourceDynamicProfileManager * EnsureSeededSourceDynamicProfileManager(DWORD_PTR hostSourceContext);
+#endif
 
 #if defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
         void ClearSourceContextInfoMaps()
@@ -18,6 +18,7 @@
 #include "StandardChars.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Base/ThreadBoundThreadContextManager.h"
+#include "Base/DynamicCodeCache.h"
 #include "Language/SourceDynamicProfileManager.h"
 #include "Language/CodeGenRecyclableData.h"
 #include "Language/InterpreterStackFrame.h"
@@ -102,6 +103,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     allocationPolicyManager(allocationPolicyManager),
     threadService(threadServiceCallback),
     isOptimizedForManyInstances(Js::Configuration::Global.flags.OptimizeForManyInstances),
+    recyclerMaxParallelism(0),
     bgJit(Js::Configuration::Global.flags.BgJit),
     pageAllocator(allocationPolicyManager, PageAllocatorType_Thread, Js::Configuration::Global.flags, 0, PageAllocator::DefaultMaxFreePageCount,
         false
@@ -129,6 +131,8 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     tryCatchFrameAddr(nullptr),
     temporaryArenaAllocatorCount(0),
     temporaryGuestArenaAllocatorCount(0),
+    parserArenaCount(0),
+    parserArenaHighWaterMark(0),
     crefSContextForDiag(0),
     m_prereservedRegionAddr(0),
     scriptContextList(nullptr),
@@ -192,6 +196,10 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     redeferralState(InitialRedeferralState),
     gcSinceLastRedeferral(0),
     gcSinceCallCountsCollected(0),
+    reclaimRedeferralThreshold(0),
+    redeferredFunctionCount(0),
+    redeferredFunctionBytes(0),
+    dynamicCodeCache(nullptr),
     tridentLoadAddress(nullptr),
     m_remoteThreadContextInfo(nullptr)
 #ifdef ENABLE_SCRIPT_DEBUGGING
@@ -216,6 +224,14 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 
     functionCount = 0;
     sourceInfoCount = 0;
+    if (CONFIG_FLAG(ReclaimColdFunctions))
+    {
+        this->EnableColdFunctionReclaim(CONFIG_FLAG(ReclaimColdFunctionsGCCount));
+    }
+    if (CONFIG_FLAG(DynamicCodeCache))
+    {
+        this->EnableDynamicCodeCache(CONFIG_FLAG(DynamicCodeCacheSize) * 1024);
+    }
 #if DBG || defined(RUNTIME_DATA_COLLECTION)
     scriptContextCount = 0;
 #endif
@@ -392,6 +408,11 @@ void ThreadContext::GlobalInitialize()
     {
         builtInPropertyRecords[i]->SetHash(JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(builtInPropertyRecords[i]->GetBuffer(), builtInPropertyRecords[i]->GetLength()));
     }
+
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+    // Out of bounds accesses to virtual array buffers fault instead of being bound checked
+    PAL_SetAccessViolationFilter(Js::JavascriptFunction::AccessViolationFilter);
+#endif
 }
 
 ThreadContext::~ThreadContext()
@@ -436,6 +457,12 @@ ThreadContext::~ThreadContext()
         interruptPoller = nullptr;
     }
 
+    if (dynamicCodeCache != nullptr)
+    {
+        HeapDelete(dynamicCodeCache);
+        dynamicCodeCache = nullptr;
+    }
+
 #if DBG
     // ThreadContext dtor may be running on a different thread.
     // Recycler may call finalizer that free temp Arenas, which will free pages back to
@@ -444,6 +471,15 @@ ThreadContext::~ThreadContext()
     pageAllocator.ShutdownIdleDecommit();
 #endif
 
+    // Deleting the pooled parser arenas frees their pages back to the page allocator, so this has to come after
+    // idle decommit is shut down.
+    while (parserArenaCount != 0)
+    {
+        parserArenaCount--;
+        HeapDelete(parserArenas[parserArenaCount]);
+        parserArenas[parserArenaCount] = nullptr;
+    }
+
     // Allocating memory during the shutdown codepath is not preferred
     // so we'll close the page allocator before we release the GC
     // If any dispose is allocating memory during shutdown, that is a bug
@@ -763,6 +799,9 @@ Recycler* ThreadContext::EnsureRecycler()
     if (recycler == NULL)
     {
         AutoRecyclerPtr newRecycler(HeapNew(Recycler, GetAllocationPolicyManager(), &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags));
+#if ENABLE_CONCURRENT_GC
+        newRecycler->SetMaxParallelism(recyclerMaxParallelism);
+#endif
         newRecycler->Initialize(isOptimizedForManyInstances, &threadService); // use in-thread GC when optimizing for many instances
         newRecycler->SetCollectionWrapper(this);
 
@@ -2396,6 +2435,70 @@ ThreadContext::ReleaseTemporaryGuestAllocator(Js::TempGuestArenaAllocatorObject
     tempGuestAllocator->Dispose(false);
 }
 
+ArenaAllocator *
+ThreadContext::GetParserArena(void (*outOfMemoryFunc)())
+{
+    size_t retainSize = CONFIG_FLAG(ParserArenaRetainSize) * 1024;
+    if (retainSize == 0)
+    {
+        return nullptr;
+    }
+
+    ArenaAllocator * arena;
+    if (parserArenaCount != 0)
+    {
+        parserArenaCount--;
+        arena = parserArenas[parserArenaCount];
+        parserArenas[parserArenaCount] = nullptr;
+
+        if (PHASE_TRACE1(Js::ParserArenaPhase))
+        {
+            Output::Print(_u("ParserArena: reused a pooled arena\n"));
+            Output::Flush();
+        }
+    }
+    else
+    {
+        arena = HeapNewNoThrow(ArenaAllocator, _u("Parser"), this->GetPageAllocator(), outOfMemoryFunc);
+        if (arena == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (PHASE_TRACE1(Js::ParserArenaPhase))
+        {
+            Output::Print(_u("ParserArena: created an arena\n"));
+            Output::Flush();
+        }
+    }
+
+    // Start with one block big enough for what recent parses needed, so that a typical parse (including the reparse
+    // of a deferred function) doesn't go back to the page allocator at all.
+    arena->ResetToSingleBlock(min(parserArenaHighWaterMark, retainSize));
+    return arena;
+}
+
+void
+ThreadContext::ReleaseParserArena(ArenaAllocator * arena)
+{
+    // The high-water mark decays with each parse, so that one unusually large parse doesn't keep its memory for good
+    parserArenaHighWaterMark = max(arena->AllocatedSize(), parserArenaHighWaterMark - parserArenaHighWaterMark / 8);
+
+    if (parserArenaCount < MaxParserArenas && !pageAllocator.IsClosed())
+    {
+        arena->Reset();
+        if (arena->AllocatedSize() > (size_t)CONFIG_FLAG(ParserArenaRetainSize) * 1024)
+        {
+            arena->Clear();
+        }
+        parserArenas[parserArenaCount] = arena;
+        parserArenaCount++;
+        return;
+    }
+
+    HeapDelete(arena);
+}
+
 void
 ThreadContext::AddToPendingScriptContextCloseList(Js::ScriptContext * scriptContext)
 {
@@ -2709,6 +2812,9 @@ ThreadContext::DoTryRedeferral() const
         case MainRedeferralState:
             return gcSinceCallCountsCollected >= MainRedeferralInactiveThreshold;
 
+        case ReclaimRedeferralState:
+            return gcSinceCallCountsCollected >= reclaimRedeferralThreshold;
+
         default:
             Assert(0);
             return false;
@@ -2746,6 +2852,9 @@ ThreadContext::DoRedeferFunctionBodies() const
         case MainRedeferralState:
             return gcSinceLastRedeferral >= MainRedeferralCheckInterval;
 
+        case ReclaimRedeferralState:
+            return gcSinceLastRedeferral >= reclaimRedeferralThreshold;
+
         default:
             Assert(0);
             return false;
@@ -2766,6 +2875,9 @@ ThreadContext::GetRedeferralCollectionInterval() const
         case MainRedeferralState:
             return MainRedeferralCheckInterval;
 
+        case ReclaimRedeferralState:
+            return reclaimRedeferralThreshold;
+
         default:
             Assert(0);
             return (uint)-1;
@@ -2786,6 +2898,9 @@ ThreadContext::GetRedeferralInactiveThreshold() const
         case MainRedeferralState:
             return MainRedeferralInactiveThreshold;
 
+        case ReclaimRedeferralState:
+            return reclaimRedeferralThreshold;
+
         default:
             Assert(0);
             return (uint)-1;
@@ -2803,11 +2918,12 @@ ThreadContext::TryRedeferral()
     {
         pActiveFuncs = Anew(this->GetThreadAlloc(), ActiveFunctionSet, this->GetThreadAlloc());
         this->GetActiveFunctions(pActiveFuncs);
+    }
+
 #if DBG
-        this->redeferredFunctions = 0;
-        this->recoveredBytes = 0;
+    size_t redeferredFunctionCountBefore = this->redeferredFunctionCount;
+    size_t redeferredFunctionBytesBefore = this->redeferredFunctionBytes;
 #endif
-    }
 
     uint inactiveThreshold = this->GetRedeferralInactiveThreshold();
     Js::ScriptContext *scriptContext;
@@ -2824,14 +2940,34 @@ ThreadContext::TryRedeferral()
     {
         Adelete(this->GetThreadAlloc(), pActiveFuncs);
 #if DBG
-        if (PHASE_STATS1(Js::RedeferralPhase) && this->redeferredFunctions)
+        if (PHASE_STATS1(Js::RedeferralPhase) && this->redeferredFunctionCount != redeferredFunctionCountBefore)
         {
-            Output::Print(_u("Redeferred: %d, Bytes: 0x%x\n"), this->redeferredFunctions, this->recoveredBytes);
+            Output::Print(_u("Redeferred: %Iu, Bytes: 0x%Ix\n"),
+                this->redeferredFunctionCount - redeferredFunctionCountBefore,
+                this->redeferredFunctionBytes - redeferredFunctionBytesBefore);
         }
 #endif
     }
 }
 
+void
+ThreadContext::EnableColdFunctionReclaim(uint gcCount)
+{
+    this->redeferralState = ReclaimRedeferralState;
+    this->reclaimRedeferralThreshold = max(gcCount, 1u);
+    this->gcSinceLastRedeferral = 0;
+    this->gcSinceCallCountsCollected = 0;
+}
+
+void
+ThreadContext::EnableDynamicCodeCache(size_t budget)
+{
+    if (this->dynamicCodeCache == nullptr)
+    {
+        this->dynamicCodeCache = HeapNew(Js::DynamicCodeCache, budget);
+    }
+}
+
 void
 ThreadContext::GetActiveFunctions(ActiveFunctionSet * pActiveFuncs)
 {
@@ -2875,6 +3011,7 @@ ThreadContext::UpdateRedeferralState()
                     break;
 
                 case MainRedeferralState:
+                case ReclaimRedeferralState:
                     break;
 
                 default:
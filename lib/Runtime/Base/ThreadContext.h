@@ -9,6 +9,7 @@ namespace Js
     class ScriptContext;
     struct InlineCache;
     class CodeGenRecyclableData;
+    class DynamicCodeCache;
 #ifdef ENABLE_SCRIPT_DEBUGGING
     class DebugManager;
     struct ReturnedValue;
@@ -452,6 +453,7 @@ class ThreadContext sealed :
 #endif
 
     static uint const MaxTemporaryArenaAllocators = 5;
+    static uint const MaxParserArenas = 2;
 
     static CriticalSection s_csThreadContext;
 
@@ -687,11 +689,18 @@ class ThreadContext sealed :
     {
         InitialRedeferralState,
         StartupRedeferralState,
-        MainRedeferralState
+        MainRedeferralState,
+        // Redefer any function that hasn't run for ReclaimColdFunctionsGCCount GCs, from the first GC on
+        ReclaimRedeferralState
     };
     RedeferralState redeferralState;
     uint gcSinceLastRedeferral;
     uint gcSinceCallCountsCollected;
+    uint reclaimRedeferralThreshold;
+    size_t redeferredFunctionCount;
+    size_t redeferredFunctionBytes;
+
+    Js::DynamicCodeCache * dynamicCodeCache;
 
     static const uint InitialRedeferralDelay = 5;
     static const uint StartupRedeferralCheckInterval = 10;
@@ -729,6 +738,12 @@ class ThreadContext sealed :
     uint temporaryArenaAllocatorCount;
     uint temporaryGuestArenaAllocatorCount;
 
+    // Node arenas of finished parsers, kept so that the next parse reuses their pages
+    ArenaAllocator * parserArenas[MaxParserArenas];
+    uint parserArenaCount;
+    // Memory used by recent parses, which decides how much a pooled parser arena keeps
+    size_t parserArenaHighWaterMark;
+
 #if DBG_DUMP || defined(PROFILE_EXEC)
     ScriptSite* topLevelScriptSite;
 #endif
@@ -777,6 +792,7 @@ class ThreadContext sealed :
     bool hasCollectionCallBack;
     bool isOptimizedForManyInstances;
     bool bgJit;
+    uint recyclerMaxParallelism;
 
     // We report library code to profiler only if called directly by user code. Not if called by library implementation.
     bool isProfilingUserCode;
@@ -1227,10 +1243,26 @@ class ThreadContext sealed :
     uint GetRedeferralCollectionInterval() const;
     uint GetRedeferralInactiveThreshold() const;
     void GetActiveFunctions(ActiveFunctionSet * pActive);
-#if DBG
-    uint redeferredFunctions;
-    uint recoveredBytes;
-#endif
+
+    // Redefer functions as soon as they have been cold for the given number of GCs, instead of backing off
+    // through the startup states. Functions that are redeferred drop their byte code, inline caches,
+    // dynamic profile info and entry points, and are reparsed if they are called again.
+    void EnableColdFunctionReclaim(uint gcCount);
+    bool IsColdFunctionReclaimEnabled() const { return redeferralState == ReclaimRedeferralState; }
+
+    void RecordRedeferredFunction(size_t reclaimedBytes)
+    {
+        redeferredFunctionCount++;
+        redeferredFunctionBytes += reclaimedBytes;
+    }
+    // Totals over the lifetime of the thread context
+    size_t GetRedeferredFunctionCount() const { return redeferredFunctionCount; }
+    size_t GetRedeferredFunctionBytes() const { return redeferredFunctionBytes; }
+
+    // Share the byte code of `new Function` bodies and indirect eval code between the script contexts of this
+    // thread context, keeping up to budget bytes of serialized byte code.
+    void EnableDynamicCodeCache(size_t budget);
+    Js::DynamicCodeCache * GetDynamicCodeCache() const { return dynamicCodeCache; }
 
     Js::ScriptEntryExitRecord * GetScriptEntryExit() const { return entryExitRecord; }
     void RegisterCodeGenRecyclableData(Js::CodeGenRecyclableData *const codeGenRecyclableData);
@@ -1274,6 +1306,9 @@ class ThreadContext sealed :
     Js::TempArenaAllocatorObject * GetTemporaryAllocator(LPCWSTR name);
     void ReleaseTemporaryAllocator(Js::TempArenaAllocatorObject * tempAllocator);
 
+    ArenaAllocator * GetParserArena(void (*outOfMemoryFunc)());
+    void ReleaseParserArena(ArenaAllocator * arena);
+
     Js::TempGuestArenaAllocatorObject * GetTemporaryGuestAllocator(LPCWSTR name);
     void ReleaseTemporaryGuestAllocator(Js::TempGuestArenaAllocatorObject * tempAllocator);
 
@@ -1723,6 +1758,12 @@ class ThreadContext sealed :
 
     }
 
+    void SetRecyclerMaxParallelism(const uint maxParallelism)
+    {
+        Assert(!recycler); // parallelism cannot be changed after recycler is created
+        recyclerMaxParallelism = maxParallelism;
+    }
+
 #if ENABLE_NATIVE_CODEGEN
     bool IsBgJitEnabled() const { return bgJit; }
 
@@ -297,14 +297,14 @@ namespace Js
         if (this->m_lineOffsetCache == nullptr)
         {
             LPCUTF8 sourceStart = this->GetSource(_u("Utf8SourceInfo::AllocateLineOffsetCache"));
-            LPCUTF8 sourceEnd = sourceStart + this->GetCbLength(_u("Utf8SourceInfo::AllocateLineOffsetCache"));
 
             LPCUTF8 sourceAfterBOM = sourceStart;
             charcount_t startChar = FunctionBody::SkipByteOrderMark(sourceAfterBOM /* byref */);
             int64 byteStartOffset = (sourceAfterBOM - sourceStart);
 
+            // Lines are only scanned for as they are asked for.
             Recycler* recycler = this->m_scriptContext->GetRecycler();
-            this->m_lineOffsetCache = RecyclerNew(recycler, LineOffsetCache, recycler, sourceAfterBOM, sourceEnd, startChar, (int)byteStartOffset);
+            this->m_lineOffsetCache = RecyclerNew(recycler, LineOffsetCache, recycler, this, startChar, (charcount_t)byteStartOffset);
         }
     }
 
@@ -333,7 +333,11 @@ namespace Js
 
         charcount_t lineCharOffset = 0;
         int line = 0;
-        if (this->m_lineOffsetCache == nullptr)
+
+        // The cache scans the source lazily, which allocates, so a slow lookup only uses a cache that's complete.
+        LineOffsetCache * lineOffsetCache = this->m_lineOffsetCache;
+        if (lineOffsetCache == nullptr ||
+            (allowSlowLookup && !lineOffsetCache->TryGetLineForCharacterOffset(charPosition, &line, &lineCharOffset, outLineByteOffset)))
         {
             LPCUTF8 sourceStart = this->GetSource(_u("Utf8SourceInfo::AllocateLineOffsetCache"));
             LPCUTF8 sourceEnd = sourceStart + this->GetCbLength(_u("Utf8SourceInfo::AllocateLineOffsetCache"));
@@ -347,9 +351,9 @@ namespace Js
 
             *outLineByteOffset = byteStartOffset;
         }
-        else
+        else if (!allowSlowLookup)
         {
-            line = this->m_lineOffsetCache->GetLineForCharacterOffset(charPosition, &lineCharOffset, outLineByteOffset);
+            line = lineOffsetCache->GetLineForCharacterOffset(charPosition, &lineCharOffset, outLineByteOffset);
         }
 
         Assert(charPosition >= lineCharOffset);
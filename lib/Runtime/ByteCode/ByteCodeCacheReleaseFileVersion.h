@@ -4,6 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 // NOTE: If there is a merge conflict the correct fix is to make a new GUID.
 
-// {7126F68E-E40A-4E97-80D6-777755A28BDF}
+// {BF73C6D3-ACA9-4726-8788-997F1B349414}
 const GUID byteCodeCacheReleaseFileVersion =
-{ 0x7126F68E, 0xE40A, 0x4E97, { 0x80, 0xD6, 0x77, 0x77, 0x55, 0xA2, 0x8B, 0xDF } };
+{ 0xBF73C6D3, 0xACA9, 0x4726, { 0x87, 0x88, 0x99, 0x7F, 0x1B, 0x34, 0x94, 0x14 } };
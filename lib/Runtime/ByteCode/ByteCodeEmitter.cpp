@@ -2579,6 +2579,8 @@ void ByteCodeGenerator::InsertPropertyToDebuggerScope(FuncInfo* funcInfo, Js::De
 
 void ByteCodeGenerator::EmitDefaultArgs(FuncInfo *funcInfo, ParseNode *pnode)
 {
+    // The formals scope is recorded as starting here
+    m_writer.ClearPendingLdA();
     uint beginOffset = m_writer.GetCurrentOffset();
 
     auto emitDefaultArg = [&](ParseNode *pnodeArg)
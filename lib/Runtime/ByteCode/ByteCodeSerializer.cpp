@@ -413,9 +413,9 @@ class ByteCodeBufferBuilder
           string16Table(_u("String16 Table")),
           alignedString16Table(_u("Alignment for String16 Table"), &string16Table, sizeof(char16)),
           lineInfoCacheCount(_u("Line Info Cache"), sourceInfo->GetLineOffsetCache()->GetLineCount()),
-          lineCharacterOffsetCacheBuffer(_u("Line Info Character Cache"), lineInfoCacheCount.value * sizeof(charcount_t), (byte *)sourceInfo->GetLineOffsetCache()->GetLineCharacterOffsetBuffer()),
-          lineInfoHasByteCache(_u("Line Info Has Byte Cache"), sourceInfo->GetLineOffsetCache()->GetLineByteOffsetBuffer() != nullptr),
-          lineByteOffsetCacheBuffer(_u("Line Info Byte Cache"), lineInfoCacheCount.value * sizeof(charcount_t), (byte *)sourceInfo->GetLineOffsetCache()->GetLineByteOffsetBuffer()),
+          lineCharacterOffsetCacheBuffer(_u("Line Info Character Cache"), lineInfoCacheCount.value * sizeof(charcount_t), nullptr),
+          lineInfoHasByteCache(_u("Line Info Has Byte Cache"), sourceInfo->GetLineOffsetCache()->HasByteOffsets()),
+          lineByteOffsetCacheBuffer(_u("Line Info Byte Cache"), lineInfoCacheCount.value * sizeof(charcount_t), nullptr),
           functionsTable(_u("Functions")),
           nextString16Id(builtInPropertyCount), // Reserve the built-in property ids
           topFunctionId(0),
@@ -493,13 +493,19 @@ class ByteCodeBufferBuilder
             V4.value = 0;
         }
 #endif
+        // The line cache is stored compactly in memory, expand it into the flat arrays the file format uses.
+        charcount_t * lineCharacterOffsets = AnewArray(alloc, charcount_t, lineInfoCacheCount.value);
+        charcount_t * lineByteOffsets = lineInfoHasByteCache.value ? AnewArray(alloc, charcount_t, lineInfoCacheCount.value) : nullptr;
+        sourceInfo->GetLineOffsetCache()->CopyLineOffsets(lineCharacterOffsets, lineByteOffsets, lineInfoCacheCount.value);
+        lineCharacterOffsetCacheBuffer.raw = (byte *)lineCharacterOffsets;
+        lineByteOffsetCacheBuffer.raw = (byte *)lineByteOffsets;
+
         string16ToId = Anew(alloc, TString16ToId, alloc);
     }
 
-    HRESULT Create(bool allocateBuffer, byte ** buffer, DWORD * bufferBytes)
+    // Lays out the whole file in the list and fixes the offsets of its parts. Returns the file size.
+    uint32 Layout(BufferBuilderList & all)
     {
-        BufferBuilderList all(_u("Final"));
-
         // Reverse the lists
         string16IndexTable.list = string16IndexTable.list->ReverseCurrentList();
         string16Table.list = string16Table.list->ReverseCurrentList();
@@ -538,8 +544,15 @@ class ByteCodeBufferBuilder
         string16Count.value = nextString16Id - this->builtInPropertyCount;
 
         // Figure out the size and set all individual offsets
-        DWORD size = all.FixOffset(0);
+        uint32 size = all.FixOffset(0);
         totalSize.value = size;
+        return size;
+    }
+
+    HRESULT Create(bool allocateBuffer, byte ** buffer, DWORD * bufferBytes)
+    {
+        BufferBuilderList all(_u("Final"));
+        DWORD size = Layout(all);
 
         // Allocate the bytes
         if (allocateBuffer)
@@ -567,6 +580,22 @@ class ByteCodeBufferBuilder
         }
     }
 
+    // Writes the file to the sink a chunk at a time instead of into one buffer.
+    HRESULT Create(BufferBuilderSink * sink, DWORD * bufferBytes)
+    {
+        BufferBuilderList all(_u("Final"));
+        *bufferBytes = Layout(all);
+
+        byte * chunk = AnewArray(alloc, byte, BufferBuilderStream::ChunkSize);
+        BufferBuilderStream stream(sink, chunk);
+        all.Write(&stream);
+        HRESULT hr = stream.Flush();
+        AdeleteArray(alloc, BufferBuilderStream::ChunkSize, chunk);
+
+        DebugOnly(Output::Flush());         // Flush trace
+        return hr;
+    }
+
     bool isBuiltinProperty(PropertyId pid) {
         if (pid < this->builtInPropertyCount || pid==/*nil*/0xffffffff)
         {
@@ -4266,7 +4295,7 @@ class ByteCodeBufferReader
 
 // Construct the byte code cache. Copy things needed by inline 'Lookup' functions from reader.
 ByteCodeCache::ByteCodeCache(ScriptContext * scriptContext, ByteCodeBufferReader * reader, int builtInPropertyCount)
-    : reader(reader), propertyCount(reader->string16Count), builtInPropertyCount(builtInPropertyCount)
+    : scriptContext(scriptContext), reader(reader), propertyCount(reader->string16Count), builtInPropertyCount(builtInPropertyCount)
 {
     auto alloc = scriptContext->SourceCodeAllocator();
     propertyIds = AnewArray(alloc, PropertyId, propertyCount);
@@ -4277,11 +4306,8 @@ ByteCodeCache::ByteCodeCache(ScriptContext * scriptContext, ByteCodeBufferReader
 
     raw = reader->raw;
 
-    // Read and populate PropertyIds
-    for(int i=0; i < propertyCount; ++i)
-    {
-        PopulateLookupPropertyId(scriptContext, i);
-    }
+    // PropertyIds are populated on first lookup. With deferred deserialization, a large serialized script then
+    // only pays for (and only pages in) the string table entries of the functions that actually run.
 }
 
 // Deserialize and save a PropertyId
@@ -4302,7 +4328,8 @@ void ByteCodeCache::PopulateLookupPropertyId(ScriptContext * scriptContext, int
 }
 
 // Serialize function body
-HRESULT ByteCodeSerializer::SerializeToBuffer(ScriptContext * scriptContext, ArenaAllocator * alloc, DWORD sourceByteLength, LPCUTF8 utf8Source, FunctionBody * function, SRCINFO const* srcInfo, bool allocateBuffer, byte ** buffer, DWORD * bufferBytes, DWORD dwFlags)
+template <typename TCreate>
+static HRESULT SerializeCore(ScriptContext * scriptContext, ArenaAllocator * alloc, DWORD sourceByteLength, LPCUTF8 utf8Source, FunctionBody * function, SRCINFO const* srcInfo, DWORD dwFlags, TCreate create)
 {
 
     int builtInPropertyCount = (dwFlags & GENERATE_BYTE_CODE_BUFFER_LIBRARY) != 0 ?  PropertyIds::_countJSOnlyProperty : TotalNumberOfBuiltInProperties;
@@ -4322,7 +4349,7 @@ HRESULT ByteCodeSerializer::SerializeToBuffer(ScriptContext * scriptContext, Are
 
     if (SUCCEEDED(hr))
     {
-        hr = builder.Create(allocateBuffer, buffer, bufferBytes);
+        hr = create(builder);
     }
 
 #if INSTRUMENT_BUFFER_INTS
@@ -4334,6 +4361,22 @@ HRESULT ByteCodeSerializer::SerializeToBuffer(ScriptContext * scriptContext, Are
     return hr;
 }
 
+HRESULT ByteCodeSerializer::SerializeToBuffer(ScriptContext * scriptContext, ArenaAllocator * alloc, DWORD sourceByteLength, LPCUTF8 utf8Source, FunctionBody * function, SRCINFO const* srcInfo, bool allocateBuffer, byte ** buffer, DWORD * bufferBytes, DWORD dwFlags)
+{
+    return SerializeCore(scriptContext, alloc, sourceByteLength, utf8Source, function, srcInfo, dwFlags, [&](ByteCodeBufferBuilder & builder)
+    {
+        return builder.Create(allocateBuffer, buffer, bufferBytes);
+    });
+}
+
+HRESULT ByteCodeSerializer::SerializeToSink(ScriptContext * scriptContext, ArenaAllocator * alloc, DWORD sourceByteLength, LPCUTF8 utf8Source, FunctionBody * function, SRCINFO const* srcInfo, BufferBuilderSink * sink, DWORD * bufferBytes, DWORD dwFlags)
+{
+    return SerializeCore(scriptContext, alloc, sourceByteLength, utf8Source, function, srcInfo, dwFlags, [&](ByteCodeBufferBuilder & builder)
+    {
+        return builder.Create(sink, bufferBytes);
+    });
+}
+
 HRESULT ByteCodeSerializer::DeserializeFromBuffer(ScriptContext * scriptContext, uint32 scriptFlags, LPCUTF8 utf8Source, SRCINFO const * srcInfo, byte * buffer, NativeModule *nativeModule, Field(FunctionBody*)* function, uint sourceIndex)
 {
     return ByteCodeSerializer::DeserializeFromBufferInternal(scriptContext, scriptFlags, utf8Source, /* sourceHolder */ nullptr, srcInfo, buffer, nativeModule, function, sourceIndex);
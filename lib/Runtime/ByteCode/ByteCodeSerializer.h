@@ -24,6 +24,7 @@ namespace Js
 #endif
 
     class ByteCodeBufferReader;
+    class BufferBuilderSink;
 
     enum SerializedAuxiliaryKind : byte
     {
@@ -106,11 +107,23 @@ namespace Js
     // for the lookup hit case. The slower deserialization of VarArray, etc are in the .cpp.
     class ByteCodeCache
     {
+        ScriptContext * scriptContext;
         ByteCodeBufferReader * reader;
         const byte * raw;
-        PropertyId * propertyIds;
+        PropertyId * propertyIds;   // Resolved on first lookup, so only the strings used by deserialized functions are touched
         int propertyCount;
         int builtInPropertyCount;
+
+        inline PropertyId EnsurePropertyId(int realOffset)
+        {
+            Assert(realOffset < propertyCount);
+            if (propertyIds[realOffset] == -1)
+            {
+                PopulateLookupPropertyId(scriptContext, realOffset);
+            }
+            Assert(propertyIds[realOffset] != -1);
+            return propertyIds[realOffset];
+        }
     public:
         ByteCodeCache(ScriptContext * scriptContext, ByteCodeBufferReader * reader, int builtInPropertyCount);
         void PopulateLookupPropertyId(ScriptContext * scriptContext, int realArrayOffset);
@@ -121,7 +134,7 @@ namespace Js
         }
 
         // Convert a serialized propertyID into a real one.
-        inline PropertyId LookupPropertyId(PropertyId obscuredIdInCache) const
+        inline PropertyId LookupPropertyId(PropertyId obscuredIdInCache)
         {
             auto unobscured = obscuredIdInCache ^ SERIALIZER_OBSCURE_PROPERTY_ID;
             if (unobscured < builtInPropertyCount || unobscured==/*nil*/0xffffffff)
@@ -129,18 +142,14 @@ namespace Js
                 return unobscured; // This is a built in property id
             }
             auto realOffset = unobscured - builtInPropertyCount;
-            Assert(realOffset<propertyCount);
-            Assert(propertyIds[realOffset]!=-1);
-            return propertyIds[realOffset];
+            return EnsurePropertyId(realOffset);
         }
 
         // Convert a serialized propertyID into a real one.
-        inline PropertyId LookupNonBuiltinPropertyId(PropertyId obscuredIdInCache) const
+        inline PropertyId LookupNonBuiltinPropertyId(PropertyId obscuredIdInCache)
         {
             auto realOffset = obscuredIdInCache ^ SERIALIZER_OBSCURE_NONBUILTIN_PROPERTY_ID;
-            Assert(realOffset<propertyCount);
-            Assert(propertyIds[realOffset]!=-1);
-            return propertyIds[realOffset];
+            return EnsurePropertyId(realOffset);
         }
 
         // Get the raw byte code buffer.
@@ -156,6 +165,10 @@ namespace Js
         // Serialize a function body.
         static HRESULT SerializeToBuffer(ScriptContext * scriptContext, ArenaAllocator * alloc, DWORD sourceCodeLength, LPCUTF8 utf8Source, FunctionBody * function, SRCINFO const* srcInfo, bool allocateBuffer, byte ** buffer, DWORD * bufferBytes, DWORD dwFlags = 0);
 
+        // Serialize a function body, handing the serialized bytes to the sink in order a chunk at a time. The
+        // bytes are the same SerializeToBuffer would produce.
+        static HRESULT SerializeToSink(ScriptContext * scriptContext, ArenaAllocator * alloc, DWORD sourceCodeLength, LPCUTF8 utf8Source, FunctionBody * function, SRCINFO const* srcInfo, BufferBuilderSink * sink, DWORD * bufferBytes, DWORD dwFlags = 0);
+
         // Deserialize a function body. The content of utf8Source must be the same as was originally passed to SerializeToBuffer
         static HRESULT DeserializeFromBuffer(ScriptContext * scriptContext, uint32 scriptFlags, LPCUTF8 utf8Source, SRCINFO const * srcInfo, byte * buffer, NativeModule *nativeModule, Field(FunctionBody*)* function, uint sourceIndex = Js::Constants::InvalidSourceIndex);
         static HRESULT DeserializeFromBuffer(ScriptContext * scriptContext, uint32 scriptFlags, ISourceHolder* sourceHolder, SRCINFO const * srcInfo, byte * buffer, NativeModule *nativeModule, Field(FunctionBody*)* function, uint sourceIndex = Js::Constants::InvalidSourceIndex);
@@ -80,6 +80,9 @@ namespace Js
         m_doInterruptProbe = functionWrite->GetScriptContext()->GetThreadContext()->DoInterruptProbe(functionWrite);
         m_hasLoop = hasLoop;
         m_isInDebugMode = inDebugMode;
+        // The debugger steps and maps statements by byte code offset, so keep one instruction per Ld_A there
+        m_doLdAFusion = !inDebugMode && !PHASE_OFF(Js::SuperInstructionsPhase, functionWrite);
+        ClearPendingLdA();
     }
 
     template <typename T>
@@ -396,6 +399,10 @@ namespace Js
         R0 = ConsumeReg(R0);
         R1 = ConsumeReg(R1);
 
+        if (op == OpCode::Ld_A && TryFuseLdA(R0, R1))
+        {
+            return;
+        }
 
         bool isProfiled = false;
         bool isProfiled2 = false;
@@ -426,6 +433,11 @@ namespace Js
 
         MULTISIZE_LAYOUT_WRITE(Reg2, op, R0, R1);
 
+        if (op == OpCode::Ld_A)
+        {
+            RecordPendingLdA(R0, R1);
+        }
+
         if (isProfiled)
         {
             m_byteCodeData.Encode(&profileId, sizeof(Js::ProfileId));
@@ -436,6 +448,45 @@ namespace Js
         }
     }
 
+    // Rewrites an Ld_A that directly follows another one as a single Ld_A_Pair, which saves the interpreter a
+    // dispatch. Only small layout copies are fused, which lets the pair take the place of the first Ld_A.
+    bool ByteCodeWriter::TryFuseLdA(RegSlot R0, RegSlot R1)
+    {
+        if (m_pendingLdA.endOffset != m_byteCodeData.GetCurrentOffset())
+        {
+            return false;
+        }
+
+        OpLayoutT_Reg4<SmallLayoutSizePolicy> layout;
+        if (!SmallLayoutSizePolicy::Assign(layout.R0, m_pendingLdA.R0) ||
+            !SmallLayoutSizePolicy::Assign(layout.R1, m_pendingLdA.R1) ||
+            !SmallLayoutSizePolicy::Assign(layout.R2, R0) ||
+            !SmallLayoutSizePolicy::Assign(layout.R3, R1) ||
+            !m_byteCodeData.TryRewind(m_pendingLdA.startOffset))
+        {
+            return false;
+        }
+
+        m_byteCodeData.EncodeT<SmallLayout>(OpCode::Ld_A_Pair, &layout, sizeof(layout), this);
+        ClearPendingLdA();
+        return true;
+    }
+
+    void ByteCodeWriter::RecordPendingLdA(RegSlot R0, RegSlot R1)
+    {
+        OpLayoutT_Reg2<SmallLayoutSizePolicy> layout;
+        if (!m_doLdAFusion || !SmallLayoutSizePolicy::Assign(layout.R0, R0) || !SmallLayoutSizePolicy::Assign(layout.R1, R1))
+        {
+            ClearPendingLdA();
+            return;
+        }
+
+        m_pendingLdA.endOffset = m_byteCodeData.GetCurrentOffset();
+        m_pendingLdA.startOffset = m_pendingLdA.endOffset - (OpCodeUtil::EncodedSize(OpCode::Ld_A, SmallLayout) + sizeof(layout));
+        m_pendingLdA.R0 = R0;
+        m_pendingLdA.R1 = R1;
+    }
+
     template <typename SizePolicy>
     bool ByteCodeWriter::TryWriteReg3(OpCode op, RegSlot R0, RegSlot R1, RegSlot R2)
     {
@@ -2553,6 +2604,7 @@ namespace Js
 
         AssertMsg(m_labelOffsets->Item(labelID) == UINT_MAX, "A label may only be defined at one location");
         m_labelOffsets->SetExistingItem(labelID, m_byteCodeData.GetCurrentOffset());
+        ClearPendingLdA();
     }
 
     void ByteCodeWriter::AddJumpOffset(Js::OpCode op, ByteCodeLabel labelId, uint fieldByteOffsetFromEnd) // Offset of "Offset" field in OpLayout, in bytes
@@ -2815,6 +2867,7 @@ namespace Js
 #endif
         m_pMatchingNode = node;
         m_beginCodeSpan = m_byteCodeData.GetCurrentOffset();
+        ClearPendingLdA();
 
         if (m_isInDebugMode && m_tmpRegCount != tmpRegCount)
         {
@@ -2936,6 +2989,7 @@ namespace Js
             scopeLocation = ConsumeReg(scopeLocation);
         }
         DebuggerScope* debuggerScope = m_functionWrite->RecordStartScopeObject(scopeType, m_byteCodeData.GetCurrentOffset(), scopeLocation, index);
+        ClearPendingLdA();
         PushDebuggerScope(debuggerScope);
         return debuggerScope;
     }
@@ -2986,6 +3040,7 @@ namespace Js
         Assert(this->m_currentDebuggerScope);
 
         m_functionWrite->RecordEndScopeObject(this->m_currentDebuggerScope, m_byteCodeData.GetCurrentOffset() - 1);
+        ClearPendingLdA();
         PopDebuggerScope();
     }
 
@@ -3084,6 +3139,7 @@ namespace Js
         Assert((uint)m_loopHeaders->Count() == loopId);
 
         m_loopHeaders->Add(LoopHeaderData(m_byteCodeData.GetCurrentOffset(), 0, m_loopNest > 0));
+        ClearPendingLdA();
         m_loopNest++;
         m_functionWrite->SetHasNestedLoop(m_loopNest > 1);
 
@@ -3116,6 +3172,7 @@ namespace Js
         Assert(m_loopNest > 0);
         m_loopNest--;
         m_loopHeaders->Item(loopId).endOffset = m_byteCodeData.GetCurrentOffset();
+        ClearPendingLdA();
     }
 
     void ByteCodeWriter::IncreaseByteCodeCount()
@@ -3160,6 +3217,22 @@ namespace Js
         this->currentOffset = offset;
     }
 
+    /// Moves the write position back to the given offset, so that the bytes after it get overwritten.
+    /// Fails if the offset isn't in the current chunk.
+    bool ByteCodeWriter::Data::TryRewind(uint offset)
+    {
+        Assert(offset <= currentOffset);
+        uint byteCount = currentOffset - offset;
+        if (byteCount > current->GetCurrentOffset())
+        {
+            return false;
+        }
+
+        current->SetCurrentOffset(current->GetCurrentOffset() - byteCount);
+        currentOffset = offset;
+        return true;
+    }
+
     /// Copies its contents to a final contiguous section of memory.
     void ByteCodeWriter::Data::Copy(Recycler* alloc, ByteBlock ** finalBlock)
     {
@@ -3257,7 +3330,8 @@ namespace Js
         uint offset = GetCurrentOffset();
         EncodeOpCode<layoutSize>((uint16)op, writer);
 
-        if (op != Js::OpCode::Ld_A)
+        // A fused Ld_A_Pair is counted when its first Ld_A is written, so it adds up to two Ld_A in total
+        if (op != Js::OpCode::Ld_A && op != Js::OpCode::Ld_A_Pair)
         {
             writer->m_byteCodeWithoutLDACount++;
         }
@@ -89,6 +89,7 @@ namespace Js
             inline uint GetCurrentOffset() const { return currentOffset; }
             inline DataChunk * GetCurrentChunk() const { return &(*current); }
             void SetCurrent(uint offset, DataChunk* currChunk);
+            bool TryRewind(uint offset);
             void Copy(Recycler* alloc, ByteBlock ** finalBlock);
             void Encode(OpCode op, ByteCodeWriter* writer) { EncodeT<Js::SmallLayout>(op, writer); }
             void Encode(OpCode op, const void * rawData, int byteSize, ByteCodeWriter* writer) { EncodeT<Js::SmallLayout>(op, rawData, byteSize, writer); }
@@ -169,6 +170,18 @@ namespace Js
         bool m_hasLoop;
         bool m_isInDebugMode;
         bool m_doInterruptProbe;
+
+        // The last small layout Ld_A written, for fusing with an Ld_A that directly follows it. The entry is only
+        // valid while endOffset is the current offset.
+        struct PendingLdA
+        {
+            uint startOffset;
+            uint endOffset;
+            RegSlot R0;
+            RegSlot R1;
+        };
+        PendingLdA m_pendingLdA;
+        bool m_doLdAFusion;
     public:
         struct CacheIdUnit {
             uint cacheId;
@@ -191,6 +204,8 @@ namespace Js
 #endif
 
         void IncreaseByteCodeCount();
+        bool TryFuseLdA(RegSlot R0, RegSlot R1);
+        void RecordPendingLdA(RegSlot R0, RegSlot R1);
         void AddJumpOffset(Js::OpCode op, ByteCodeLabel labelId, uint fieldByteOffset);
 
         RegSlot ConsumeReg(RegSlot reg);
@@ -356,6 +371,8 @@ namespace Js
         void RecordFrameDisplayRegister(RegSlot slot);
         void RecordObjectRegister(RegSlot slot);
         uint GetCurrentOffset() const { return (uint)m_byteCodeData.GetCurrentOffset(); }
+        // Called wherever the current offset gets recorded, so that the next instruction doesn't get fused into one that starts before it.
+        void ClearPendingLdA() { m_pendingLdA.endOffset = UINT_MAX; }
         DataChunk * GetCurrentChunk() const { return m_byteCodeData.GetCurrentChunk(); }
         void SetCurrent(uint offset, DataChunk * chunk) { m_byteCodeData.SetCurrent(offset, chunk); }
         bool ShouldIncrementCallSiteId(OpCode op);
@@ -7,12 +7,10 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
     }
-#endif
 
     struct Allocation
     {
@@ -53,10 +51,9 @@ namespace Js
         bits = NotNativeIntBit | NotNativeFloatBit;
     }
 
-    DynamicProfileInfo* DynamicProfileInfo::New(Recycler* recycler, FunctionBody* functionBody, bool persistsAcrossScriptContexts)
+    void DynamicProfileInfo::GetAllocationBatch(FunctionBody* functionBody, _Out_writes_(AllocationBatchCount) Allocation* batch)
     {
-        size_t totalAlloc = 0;
-        Allocation batch[] =
+        Allocation allocations[AllocationBatchCount] =
         {
             { (uint)offsetof(DynamicProfileInfo, callSiteInfo), functionBody->GetProfiledCallSiteCount() * sizeof(CallSiteInfo) },
             { (uint)offsetof(DynamicProfileInfo, ldElemInfo), functionBody->GetProfiledLdElemCount() * sizeof(LdElemInfo) },
@@ -71,6 +68,30 @@ namespace Js
             { (uint)offsetof(DynamicProfileInfo, loopImplicitCallFlags), (EnableImplicitCallFlags(functionBody) ? (functionBody->GetLoopCount() * sizeof(ImplicitCallFlags)) : 0) },
             { (uint)offsetof(DynamicProfileInfo, loopFlags), functionBody->GetLoopCount() ? BVFixed::GetAllocSize(functionBody->GetLoopCount() * LoopFlags::COUNT) : 0 }
         };
+        for (uint i = 0; i < AllocationBatchCount; i++)
+        {
+            batch[i] = allocations[i];
+        }
+    }
+
+    size_t DynamicProfileInfo::GetAllocSize(FunctionBody* functionBody)
+    {
+        Allocation batch[AllocationBatchCount];
+        GetAllocationBatch(functionBody, batch);
+
+        size_t totalAlloc = sizeof(DynamicProfileInfo);
+        for (uint i = 0; i < _countof(batch); i++)
+        {
+            totalAlloc += batch[i].size;
+        }
+        return totalAlloc;
+    }
+
+    DynamicProfileInfo* DynamicProfileInfo::New(Recycler* recycler, FunctionBody* functionBody, bool persistsAcrossScriptContexts)
+    {
+        size_t totalAlloc = 0;
+        Allocation batch[AllocationBatchCount];
+        GetAllocationBatch(functionBody, batch);
 
         for (uint i = 0; i < _countof(batch); i++)
         {
@@ -1863,25 +1884,23 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
 #if DBG_DUMP
-    void BufferWriter::Log(DynamicProfileInfo* info)
+    void BufferWriter::Log(DynamicProfileInfo* info, FunctionBody* functionBody)
     {
-        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, info->GetFunctionBody()->GetSourceContextId(), info->GetFunctionBody()->GetLocalFunctionId()))
+        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, functionBody->GetSourceContextId(), functionBody->GetLocalFunctionId()))
         {
             Output::Print(_u("Saving:"));
-            info->Dump(info->GetFunctionBody());
+            info->Dump(functionBody);
         }
     }
 #endif
 
     template <typename T>
-    bool DynamicProfileInfo::Serialize(T * writer)
+    bool DynamicProfileInfo::Serialize(T * writer, FunctionBody * functionBody)
     {
 #if DBG_DUMP
-        writer->Log(this);
+        writer->Log(this, functionBody);
 #endif
-        FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
         if (!writer->Write(functionBody->GetLocalFunctionId())
             || !writer->Write(paramInfoCount)
@@ -1917,6 +1936,18 @@ namespace Js
         return true;
     }
 
+    bool DynamicProfileInfo::AreValidValueTypes(ValueType const * valueTypes, uint count)
+    {
+        for (uint i = 0; i < count; i++)
+        {
+            if (!ValueType::IsValidRawData(valueTypes[i].GetRawData()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     template <typename T>
     DynamicProfileInfo * DynamicProfileInfo::Deserialize(T * reader, Recycler* recycler, Js::LocalFunctionId * functionId)
     {
@@ -2131,6 +2162,56 @@ namespace Js
                 }
             }
 
+            // The data may come from a host supplied blob, so reject value types this process could not have recorded.
+            // The JIT specializes on them without further checks.
+            if (!AreValidValueTypes(paramInfo, paramInfoCount)
+                || !AreValidValueTypes(slotInfo, slotInfoCount)
+                || !AreValidValueTypes(divTypeInfo, divCount)
+                || !AreValidValueTypes(switchTypeInfo, switchCount)
+                || !AreValidValueTypes(returnTypeInfo, returnTypeInfoCount)
+                || !ValueType::IsValidRawData(thisInfo.valueType.GetRawData())
+                || thisInfo.thisType > ThisType_Mapped)
+            {
+                goto Error;
+            }
+
+            for (ProfileId i = 0; i < ldElemInfoCount; i++)
+            {
+                if (!ValueType::IsValidRawData(ldElemInfo[i].arrayType.GetRawData())
+                    || !ValueType::IsValidRawData(ldElemInfo[i].elemType.GetRawData()))
+                {
+                    goto Error;
+                }
+            }
+
+            for (ProfileId i = 0; i < stElemInfoCount; i++)
+            {
+                if (!ValueType::IsValidRawData(stElemInfo[i].arrayType.GetRawData()))
+                {
+                    goto Error;
+                }
+            }
+
+            for (uint i = 0; i < fldInfoCount; i++)
+            {
+                if (!ValueType::IsValidRawData(fldInfo[i].valueType.GetRawData()))
+                {
+                    goto Error;
+                }
+            }
+
+            for (ProfileId i = 0; i < callSiteInfoCount; i++)
+            {
+                // Other callee ids are looked up by key (Utf8SourceInfo::FindFunction), which tolerates ids that do not exist.
+                if (!ValueType::IsValidRawData(callSiteInfo[i].returnType.GetRawData())
+                    || (!callSiteInfo[i].isPolymorphic
+                        && callSiteInfo[i].u.functionData.sourceId == BuiltInSourceId
+                        && !JavascriptBuiltInFunction::IsValidId(callSiteInfo[i].u.functionData.functionId)))
+                {
+                    goto Error;
+                }
+            }
+
             DynamicProfileFunctionInfo * dynamicProfileFunctionInfo = RecyclerNewStructLeaf(recycler, DynamicProfileFunctionInfo);
             dynamicProfileFunctionInfo->paramInfoCount = paramInfoCount;
             dynamicProfileFunctionInfo->ldElemInfoCount = ldElemInfoCount;
@@ -2178,8 +2259,10 @@ namespace Js
 
     // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
     template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, Js::LocalFunctionId *);
-    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
-    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*);
+    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*, FunctionBody*);
+    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*, FunctionBody*);
+
+#ifdef DYNAMIC_PROFILE_STORAGE
 
     void DynamicProfileInfo::UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext)
     {
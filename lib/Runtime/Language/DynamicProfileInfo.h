@@ -320,6 +320,7 @@ namespace Js
     };
 
     class DynamicProfileInfo;
+    struct Allocation;
     typedef SListBase<DynamicProfileInfo*, Recycler> DynamicProfileInfoList;
 
     class DynamicProfileInfo
@@ -327,6 +328,12 @@ namespace Js
     public:
         static DynamicProfileInfo* New(Recycler* recycler, FunctionBody* functionBody, bool persistsAcrossScriptContexts = false);
         void Initialize(FunctionBody *const functionBody);
+        // Size of the DynamicProfileInfo New would allocate for the function, including its inline arrays.
+        static size_t GetAllocSize(FunctionBody* functionBody);
+    private:
+        // The arrays allocated inline after a function's DynamicProfileInfo, in layout order.
+        static const uint AllocationBatchCount = 12;
+        static void GetAllocationBatch(FunctionBody* functionBody, _Out_writes_(AllocationBatchCount) Allocation* batch);
 
     public:
         static bool IsEnabledForAtLeastOneFunction(const ScriptContext *const scriptContext);
@@ -574,14 +581,17 @@ namespace Js
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         Field(FunctionBody *) functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
         // Used by de-serialize
         DynamicProfileInfo();
 
         template <typename T>
         static DynamicProfileInfo * Deserialize(T * reader, Recycler* allocator, Js::LocalFunctionId * functionId);
+        static bool AreValidValueTypes(ValueType const * valueTypes, uint count);
+        template <typename T>
+        bool Serialize(T * writer, FunctionBody * functionBody);
+#ifdef DYNAMIC_PROFILE_STORAGE
         template <typename T>
-        bool Serialize(T * writer);
+        bool Serialize(T * writer) { return Serialize(writer, this->GetFunctionBody()); }
 
         static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
 #endif
@@ -855,7 +865,6 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
     class BufferReader
     {
     public:
@@ -915,7 +924,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info) {}
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody) {}
 #endif
 
         template <typename T>
@@ -947,7 +956,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info);
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody);
 #endif
         template <typename T>
         bool WriteArray(__in_ecount(len) T * data, size_t len)
@@ -973,6 +982,5 @@ namespace Js
         char * current;
         size_t lengthLeft;
     };
-#endif
 };
 #endif
@@ -133,6 +133,7 @@ EXDEF2_WMS(A1toA1Mem,               NewWithObject,              JavascriptOperat
   DEF2_WMS(FALLTHROUGH,             BeginSwitch,                /* Common case with Ld_A */)
   DEF2_WMS(FALLTHROUGH,             InitConst,                  /* Common case with Ld_A */)
   DEF2_WMS(A1toA1_ALLOW_STACK,      Ld_A,                       OP_Ld_A)
+  DEF3_WMS(CUSTOM,                  Ld_A_Pair,                  OP_Ld_A_Pair, Reg4)
   DEF2_WMS(INNERtoA1,               LdInnerScope,               OP_Ld_A)
   DEF2_WMS(XXtoA1,                  LdLocalObj,                 OP_LdLocalObj)
 EXDEF2_WMS(XXtoA1,                  LdParamObj,                 OP_LdParamObj)
@@ -179,7 +180,7 @@ EXDEF3_WMS(CUSTOM_L_Value,          ProfiledLdLocalMethodFld,   PROFILEDOP(OP_Pr
 EXDEF3_WMS(CUSTOM_L_Value,          DeleteLocalFld,             OP_DeleteLocalFld, ElementU)
   DEF3_WMS(CUSTOM_L_Value,          DeleteRootFld,              OP_DeleteRootFld, ElementC)
   DEF3_WMS(CUSTOM_L_Value,          DeleteFldStrict,            OP_DeleteFldStrict, ElementC)
-  DEF3_WMS(CUSTOM_L_Value,          DeleteRootFldStrict,        OP_DeleteRootFldStrict, ElementC)
+EXDEF3_WMS(CUSTOM_L_Value,          DeleteRootFldStrict,        OP_DeleteRootFldStrict, ElementC)
   DEF3_WMS(CUSTOM,                  StFld,                      OP_SetProperty, ElementCP)
   DEF3_WMS(CUSTOM,                  StLocalFld,                 OP_SetLocalProperty, ElementP)
 EXDEF3_WMS(CUSTOM_L_Value,          StSuperFld,                 OP_SetSuperProperty, ElementC2)
@@ -37,6 +37,20 @@
 #define PROFILEDOP(prof, unprof) unprof
 #endif
 
+// Labels-as-values dispatch: the main loop jumps from the opcode straight to its handler through a table of label
+// addresses instead of going through the switch, which drops the switch's range check. There is still a single
+// indirect jump at the top of the loop, since handlers end in the switch's break and the per-opcode checks above the
+// jump (TTD, telemetry) have to run for every opcode. It is opt-in (build.sh --threaded-interpreter) since it needs
+// the GCC/Clang extension. The asm.js and debugging loops keep the switch.
+#if defined(INTERPRETER_THREADED_DISPATCH) && !defined(INTERPRETER_ASMJS) && !DEBUGGING_LOOP
+#define THREADED_LOOP 1
+#else
+#define THREADED_LOOP 0
+#endif
+
+// Handlers only get labels in the threaded main loop, see PROCESS_CASE.
+#define THREADED_LABEL(name)
+
 //two layers of macros are necessary to get arguments to the invocation of the top level macro expanded.
 #define CONCAT_TOKENS_AGAIN(loopName, fnSuffix) loopName ## fnSuffix
 #define CONCAT_TOKENS(loopName, fnSuffix) CONCAT_TOKENS_AGAIN(loopName, fnSuffix)
@@ -183,6 +197,61 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
     // For checked builds this does mean we are incrementing 2 different counters to
     // track the ip.
     const byte* ip = m_reader.GetIP();
+
+#if THREADED_LOOP
+#undef THREADED_LABEL
+#define THREADED_LABEL(name) THREADED_LABEL_##name:
+#define THREADED_TARGET(name) threadedDispatchTable[(int)INTERPRETER_OPCODE::name] = &&THREADED_LABEL_##name;
+
+    // Label addresses can only be taken inside this function, so the table is filled in on first use. The first
+    // thread to get here fills it in and publishes it; any other thread that gets here meanwhile waits for that.
+    enum { DispatchTableEmpty, DispatchTableFilling, DispatchTableReady };
+    static void * threadedDispatchTable[(int)INTERPRETER_OPCODE::MaxByteSizedOpcodes + 1];
+    static int threadedDispatchTableState = DispatchTableEmpty;
+    if (__atomic_load_n(&threadedDispatchTableState, __ATOMIC_ACQUIRE) != DispatchTableReady)
+    {
+        int expectedState = DispatchTableEmpty;
+        if (__atomic_compare_exchange_n(&threadedDispatchTableState, &expectedState, DispatchTableFilling,
+                false /*weak*/, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        {
+            for (int i = 0; i <= (int)INTERPRETER_OPCODE::MaxByteSizedOpcodes; i++)
+            {
+                threadedDispatchTable[i] = &&THREADED_LABEL_default;
+            }
+
+#define DEF2(x, op, ...) THREADED_TARGET(op)
+#define DEF3(x, op, ...) THREADED_TARGET(op)
+#define DEF2_WMS(x, op, ...) THREADED_TARGET(op)
+#define DEF3_WMS(x, op, ...) THREADED_TARGET(op)
+#define DEF4_WMS(x, op, ...) THREADED_TARGET(op)
+#include "InterpreterHandler.inl"
+
+            // Opcodes handled directly by the loop below
+            THREADED_TARGET(Ret)
+            THREADED_TARGET(Yield)
+            THREADED_TARGET(Leave)
+            THREADED_TARGET(LeaveNull)
+            THREADED_TARGET(ExtendedOpcodePrefix)
+            THREADED_TARGET(ExtendedMediumLayoutPrefix)
+            THREADED_TARGET(ExtendedLargeLayoutPrefix)
+            THREADED_TARGET(MediumLayoutPrefix)
+            THREADED_TARGET(LargeLayoutPrefix)
+            THREADED_TARGET(EndOfBlock)
+            THREADED_TARGET(Break)
+#undef THREADED_TARGET
+
+            __atomic_store_n(&threadedDispatchTableState, DispatchTableReady, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            while (__atomic_load_n(&threadedDispatchTableState, __ATOMIC_ACQUIRE) != DispatchTableReady)
+            {
+                YieldProcessor();
+            }
+        }
+    }
+#endif
+
     while (true)
     {
         INTERPRETER_OPCODE op = READ_OP(ip);
@@ -294,10 +363,14 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
         }
 SWAP_BP_FOR_OPCODE:
+#endif
+#if THREADED_LOOP
+        // The switch below is only entered through the table.
+        goto *threadedDispatchTable[(int)op];
 #endif
         switch (op)
         {
-        case INTERPRETER_OPCODE::Ret:
+        case INTERPRETER_OPCODE::Ret: THREADED_LABEL(Ret)
             {
                 //
                 // Return "Reg: 0" as the return-value.
@@ -314,7 +387,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
 
 #ifndef INTERPRETER_ASMJS
-        case INTERPRETER_OPCODE::Yield:
+        case INTERPRETER_OPCODE::Yield: THREADED_LABEL(Yield)
             {
                 m_reader.Reg2_Small(ip);
                 return GetReg(GetFunctionBody()->GetYieldRegister());
@@ -330,13 +403,13 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #include "InterpreterHandler.inl"
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Leave:
+            case INTERPRETER_OPCODE::Leave: THREADED_LABEL(Leave)
                 // Return the continuation address to the helper.
                 // This tells the helper that control left the scope without completing the try/handler,
                 // which is particularly significant when executing a finally.
                 m_reader.Empty(ip);
                 return (Var)this->m_reader.GetCurrentOffset();
-            case INTERPRETER_OPCODE::LeaveNull:
+            case INTERPRETER_OPCODE::LeaveNull: THREADED_LABEL(LeaveNull)
                 // Return to the helper without specifying a continuation address,
                 // indicating that the handler completed without jumping, so exception processing
                 // should continue.
@@ -358,7 +431,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #endif
 
 #define ExtendedCase(opcode) \
-            case INTERPRETER_OPCODE::opcode: \
+            case INTERPRETER_OPCODE::opcode: THREADED_LABEL(opcode) \
                 ip = PROCESS_OPCODE_FN_NAME(opcode)(ip); \
                 CHECK_SWITCH_PROFILE_MODE(); \
                 break;
@@ -366,7 +439,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             ExtendedCase(ExtendedMediumLayoutPrefix)
             ExtendedCase(ExtendedLargeLayoutPrefix)
 
-            case INTERPRETER_OPCODE::MediumLayoutPrefix:
+            case INTERPRETER_OPCODE::MediumLayoutPrefix: THREADED_LABEL(MediumLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(MediumLayoutPrefix)(ip, yieldValue);
@@ -375,7 +448,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
                 break;
             }
 
-            case INTERPRETER_OPCODE::LargeLayoutPrefix:
+            case INTERPRETER_OPCODE::LargeLayoutPrefix: THREADED_LABEL(LargeLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(LargeLayoutPrefix)(ip, yieldValue);
@@ -384,7 +457,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
                 break;
             }
 
-            case INTERPRETER_OPCODE::EndOfBlock:
+            case INTERPRETER_OPCODE::EndOfBlock: THREADED_LABEL(EndOfBlock)
             {
                 // Note that at this time though ip was advanced by 'OpCode op = ReadByteOp<INTERPRETER_OPCODE>(ip)',
                 // we haven't advanced m_reader.m_currentLocation yet, thus m_reader.m_currentLocation still points to EndOfBLock,
@@ -410,7 +483,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Break:
+            case INTERPRETER_OPCODE::Break: THREADED_LABEL(Break)
             {
 #if DEBUGGING_LOOP
                 // The reader has already advanced the IP:
@@ -500,7 +573,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
                 break;
             }
 #endif
-            default:
+            default: THREADED_LABEL(default)
                 // Help the C++ optimizer by declaring that the cases we
                 // have above are sufficient
                 AssertMsg(false, "dispatch to bad opcode");
@@ -508,6 +581,10 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
         }
     }
 }
+#if THREADED_LOOP
+#undef THREADED_LABEL
+#define THREADED_LABEL(name)
+#endif
 #if defined (DBG)
 // Restore optimizations to what's specified by the /O switch.
 #pragma optimize("", on)
@@ -521,3 +598,5 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #undef INTERPRETER_OPCODE
 #undef CHECK_SWITCH_PROFILE_MODE
 #undef CHECK_YIELD_VALUE
+#undef THREADED_LOOP
+#undef THREADED_LABEL
@@ -38,10 +38,15 @@
 /// direct local-function jump.
 ///----------------------------------------------------------------------------
 
+// Every handler starts with PROCESS_CASE. Besides the case label it emits THREADED_LABEL(name), which the
+// threaded dispatch loop in InterpreterLoop.inl turns into the label its dispatch table jumps to.
+#define PROCESS_CASE(name) \
+    case OpCode::name: THREADED_LABEL(name)
+
 #define PROCESS_FALLTHROUGH(name, func) \
-    case OpCode::name:
+    PROCESS_CASE(name)
 #define PROCESS_FALLTHROUGH_COMMON(name, func, suffix) \
-    case OpCode::name:
+    PROCESS_CASE(name)
 
 #define PROCESS_READ_LAYOUT(name, layout, suffix) \
     CompileAssert(OpCodeInfo<OpCode::name>::Layout == OpLayoutType::layout); \
@@ -50,7 +55,7 @@
 
 
 #define PROCESS_NOP_COMMON(name, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         break; \
@@ -59,7 +64,7 @@
 #define PROCESS_NOP(name, layout) PROCESS_NOP_COMMON(name, layout,)
 
 #define PROCESS_CUSTOM_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
@@ -69,7 +74,7 @@
 #define PROCESS_CUSTOM(name, func, layout) PROCESS_CUSTOM_COMMON(name, func, layout,)
 
 #define PROCESS_CUSTOM_L_COMMON(name, func, layout, regslot, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
@@ -92,7 +97,7 @@
 #define PROCESS_CUSTOM_L_Value(name, func, layout) PROCESS_CUSTOM_L_COMMON(name, func, layout, Value,)
 
 #define PROCESS_TRY(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Br,); \
         func(playout); \
@@ -101,7 +106,7 @@
     }
 
 #define PROCESS_EMPTY(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Empty, ); \
         func(); \
@@ -110,7 +115,7 @@
     }
 
 #define PROCESS_TRYBR2_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg2, suffix); \
         func((const byte*)(playout + 1), playout->RelativeJumpOffset, playout->R1, playout->R2); \
@@ -119,7 +124,7 @@
     }
 
 #define PROCESS_CALL_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
@@ -134,7 +139,7 @@
 
 
 #define PROCESS_A1toXX_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetRegAllowStackVar(playout->R0)); \
@@ -142,7 +147,7 @@
     }
 
 #define PROCESS_A1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetReg(playout->R0)); \
@@ -152,7 +157,7 @@
 #define PROCESS_A1toXX(name, func) PROCESS_A1toXX_COMMON(name, func,)
 
 #define PROCESS_A1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetReg(playout->R0), GetScriptContext()); \
@@ -162,7 +167,7 @@
 #define PROCESS_A1toXXMem(name, func) PROCESS_A1toXXMem_COMMON(name, func,)
 
 #define PROCESS_A1toXXMemNonVar_COMMON(name, func, type, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func((type)GetNonVarReg(playout->R0), GetScriptContext()); \
@@ -172,7 +177,7 @@
 #define PROCESS_A1toXXMemNonVar(name, func, type) PROCESS_A1toXXMemNonVar_COMMON(name, func, type,)
 
 #define PROCESS_XXtoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetReg(playout->R0, \
@@ -183,7 +188,7 @@
 #define PROCESS_XXtoA1(name, func) PROCESS_XXtoA1_COMMON(name, func,)
 
 #define PROCESS_XXtoA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetNonVarReg(playout->R0, \
@@ -194,7 +199,7 @@
 #define PROCESS_XXtoA1NonVar(name, func) PROCESS_XXtoA1NonVar_COMMON(name, func,)
 
 #define PROCESS_XXtoA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetReg(playout->R0, \
@@ -205,7 +210,7 @@
 #define PROCESS_XXtoA1Mem(name, func) PROCESS_XXtoA1Mem_COMMON(name, func,)
 
 #define PROCESS_A1toA1_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetRegAllowStackVar(playout->R0, \
@@ -216,7 +221,7 @@
 #define PROCESS_A1toA1_ALLOW_STACK(name, func) PROCESS_A1toA1_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_A1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
@@ -228,7 +233,7 @@
 
 
 #define PROCESS_A1toA1Profiled_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg2, suffix); \
         SetReg(playout->R0, \
@@ -239,7 +244,7 @@
 #define PROCESS_A1toA1Profiled(name, func) PROCESS_A1toA1Profiled_COMMON(name, func,)
 
 #define PROCESS_A1toA1CallNoArg_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetReg(playout->R0, \
@@ -250,7 +255,7 @@
 #define PROCESS_A1toA1CallNoArg(name, func, layout) PROCESS_A1toA1CallNoArg_COMMON(name, func, layout,)
 
 #define PROCESS_A1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
@@ -261,7 +266,7 @@
 #define PROCESS_A1toA1Mem(name, func) PROCESS_A1toA1Mem_COMMON(name, func,)
 
 #define PROCESS_A1toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetNonVarReg(playout->R0, \
@@ -272,7 +277,7 @@
 #define PROCESS_A1toA1NonVar(name, func) PROCESS_A1toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_A1toA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetNonVarReg(playout->R0, \
@@ -283,7 +288,7 @@
 #define PROCESS_A1toA1MemNonVar(name, func) PROCESS_A1toA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_INNERtoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, InnerScopeFromIndex(playout->C1)); \
@@ -293,7 +298,7 @@
 #define PROCESS_INNERtoA1(name, fun) PROCESS_INNERtoA1_COMMON(name, func,)
 
 #define PROCESS_U1toINNERMemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Unsigned1, suffix); \
         SetInnerScopeFromIndex(playout->C1, func(GetScriptContext())); \
@@ -303,7 +308,7 @@
 #define PROCESS_U1toINNERMemNonVar(name, func) PROCESS_U1toINNERMemNonVar_COMMON(name, func,)
 
 #define PROCESS_XXINNERtoA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
@@ -314,7 +319,7 @@
 #define PROCESS_XXINNERtoA1MemNonVar(name, func) PROCESS_XXINNERtoA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_A1INNERtoA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetNonVarReg(playout->R0, \
@@ -325,7 +330,7 @@
 #define PROCESS_A1LOCALtoA1MemNonVar(name, func) PROCESS_A1LOCALtoA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_LOCALI1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
@@ -336,7 +341,7 @@
 #define PROCESS_LOCALI1toA1(name, func) PROCESS_LOCALI1toA1_COMMON(name, func,)
 
 #define PROCESS_A1I1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetReg(playout->R0, \
@@ -347,7 +352,7 @@
 #define PROCESS_A1I1toA1(name, func) PROCESS_A1I1toA1_COMMON(name, func,)
 
 #define PROCESS_A1I1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetReg(playout->R0, \
@@ -358,7 +363,7 @@
 #define PROCESS_A1I1toA1Mem(name, func) PROCESS_A1I1toA1Mem_COMMON(name, func,)
 
 #define PROCESS_RegextoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
@@ -369,7 +374,7 @@
 #define PROCESS_RegextoA1(name, func) PROCESS_RegextoA1_COMMON(name, func,)
 
 #define PROCESS_A2toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1)); \
@@ -379,7 +384,7 @@
 #define PROCESS_A2toXX(name, func) PROCESS_A2toXX_COMMON(name, func,)
 
 #define PROCESS_A2toXXMemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         func(GetNonVarReg(playout->R0), GetNonVarReg(playout->R1), GetScriptContext()); \
@@ -389,7 +394,7 @@
 #define PROCESS_A2toXXMemNonVar(name, func) PROCESS_A2toXXMemNonVar_COMMON(name, func,)
 
 #define PROCESS_A1NonVarToA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
@@ -399,7 +404,7 @@
 
 
 #define PROCESS_A2NonVarToA1Reg_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
@@ -408,7 +413,7 @@
     }
 
 #define PROCESS_A2toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
@@ -419,7 +424,7 @@
 #define PROCESS_A2toA1Mem(name, func) PROCESS_A2toA1Mem_COMMON(name, func,)
 
 #define PROCESS_A2toA1MemProfiled_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg3, suffix); \
         SetReg(playout->R0, \
@@ -430,7 +435,7 @@
 #define PROCESS_A2toA1MemProfiled(name, func) PROCESS_A2toA1MemProfiled_COMMON(name, func,)
 
 #define PROCESS_A2toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetNonVarReg(playout->R0, \
@@ -441,7 +446,7 @@
 #define PROCESS_A2toA1NonVar(name, func) PROCESS_A2toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_A2toA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetNonVarReg(playout->R0, \
@@ -452,7 +457,7 @@
 #define PROCESS_A2toA1MemNonVar(name, func) PROCESS_A2toA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_CMMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
@@ -464,7 +469,7 @@
 #define PROCESS_CMMem(name, func) PROCESS_CMMem_COMMON(name, func,)
 
 #define PROCESS_ELEM_RtU_to_XX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementRootU, suffix); \
         func(playout->PropertyIdIndex); \
@@ -474,7 +479,7 @@
 #define PROCESS_ELEM_RtU_to_XX(name, func) PROCESS_ELEM_RtU_to_XX_COMMON(name, func,)
 
 #define PROCESS_ELEM_C2_to_XX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementScopedC, suffix); \
         func(GetEnvForEvalCode(), playout->PropertyIdIndex, GetReg(playout->Value)); \
@@ -484,7 +489,7 @@
 #define PROCESS_ELEM_C2_to_XX(name, func) PROCESS_ELEM_C2_to_XX_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_SLOT_FB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlot, suffix); \
         SetReg(playout->Value, \
@@ -495,7 +500,7 @@
 #define PROCESS_GET_ELEM_SLOT_FB(name, func) PROCESS_GET_ELEM_SLOT_FB_COMMON(name, func,)
 
 #define PROCESS_GET_SLOT_FB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI1, suffix); \
         SetReg(playout->Value, \
@@ -506,7 +511,7 @@
 #define PROCESS_GET_SLOT_FB(name, func) PROCESS_GET_SLOT_FB_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_IMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementI, suffix); \
         SetReg(playout->Value, \
@@ -517,7 +522,7 @@
 #define PROCESS_GET_ELEM_IMem(name, func) PROCESS_GET_ELEM_IMem_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_IMem_Strict_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementI, suffix); \
         SetReg(playout->Value, \
@@ -528,7 +533,7 @@
 #define PROCESS_GET_ELEM_IMem_Strict(name, func) PROCESS_GET_ELEM_IMem_Strict_COMMON(name, func,)
 
 #define PROCESS_BR(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Br,); \
         ip = func(playout); \
@@ -537,7 +542,7 @@
 
 #ifdef BYTECODE_BRANCH_ISLAND
 #define PROCESS_BRLONG(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrLong,); \
         ip = func(playout); \
@@ -546,7 +551,7 @@
 #endif
 
 #define PROCESS_BRS(name,func)  \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrS,); \
         if (func(playout->val,GetScriptContext())) \
@@ -557,7 +562,7 @@
     }
 
 #define PROCESS_BRB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetReg(playout->R1))) \
@@ -570,7 +575,7 @@
 #define PROCESS_BRB(name, func) PROCESS_BRB_COMMON(name, func,)
 
 #define PROCESS_BRB_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetRegAllowStackVar(playout->R1))) \
@@ -583,7 +588,7 @@
 #define PROCESS_BRB_ALLOW_STACK(name, func) PROCESS_BRB_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_BRBS_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetReg(playout->R1), GetScriptContext())) \
@@ -596,7 +601,7 @@
 #define PROCESS_BRBS(name, func) PROCESS_BRBS_COMMON(name, func,)
 
 #define PROCESS_BRBReturnP1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1Unsigned1, suffix); \
         SetReg(playout->R1, func(GetForInEnumerator(playout->C2))); \
@@ -610,7 +615,7 @@
 #define PROCESS_BRBReturnP1toA1(name, func) PROCESS_BRBReturnP1toA1_COMMON(name, func,)
 
 #define PROCESS_BRBMem_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetRegAllowStackVar(playout->R1),GetScriptContext())) \
@@ -622,7 +627,7 @@
 #define PROCESS_BRBMem_ALLOW_STACK(name, func) PROCESS_BRBMem_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_BRCMem_COMMON(name, func,suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg2, suffix); \
         if (func(GetReg(playout->R1), GetReg(playout->R2),GetScriptContext())) \
@@ -635,7 +640,7 @@
 #define PROCESS_BRCMem(name, func) PROCESS_BRCMem_COMMON(name, func,)
 
 #define PROCESS_BRPROP(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrProperty,); \
         if (func(GetReg(playout->Instance), playout->PropertyIdIndex, GetScriptContext())) \
@@ -646,7 +651,7 @@
     }
 
 #define PROCESS_BRLOCALPROP(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrLocalProperty,); \
         if (func(this->localClosure, playout->PropertyIdIndex, GetScriptContext())) \
@@ -657,7 +662,7 @@
     }
 
 #define PROCESS_BRENVPROP(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrEnvProperty,); \
         if (func(LdEnv(), playout->SlotIndex, playout->PropertyIdIndex, GetScriptContext())) \
@@ -668,7 +673,7 @@
     }
 
 #define PROCESS_W1(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, W1,); \
         func(playout->C1, GetScriptContext()); \
@@ -676,7 +681,7 @@
     }
 
 #define PROCESS_U1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
@@ -686,7 +691,7 @@
 #define PROCESS_U1toA1(name, func) PROCESS_U1toA1_COMMON(name, func,)
 
 #define PROCESS_U1toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
@@ -696,7 +701,7 @@
 #define PROCESS_U1toA1NonVar(name, func) PROCESS_U1toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_U1toA1NonVar_FuncBody_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
@@ -708,7 +713,7 @@
 #define PROCESS_A1I2toXXNonVar_FuncBody(name, func) PROCESS_A1I2toXXNonVar_FuncBody_COMMON(name, func,)
 
 #define PROCESS_A1I2toXXNonVar_FuncBody_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         func(playout->R0, playout->R1, playout->R2, GetScriptContext(), this->m_functionBody); \
@@ -716,7 +721,7 @@
     }
 
 #define PROCESS_A1U1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         func(GetReg(playout->R0), playout->C1); \
@@ -726,7 +731,7 @@
 #define PROCESS_A1U1toXX(name, func) PROCESS_A1U1toXX_COMMON(name, func,)
 
 #define PROCESS_A1U1toXXWithCache_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg1Unsigned1, suffix); \
         func(GetReg(playout->R0), playout->C1, playout->profileId); \
@@ -736,7 +741,7 @@
 #define PROCESS_A1U1toXXWithCache(name, func) PROCESS_A1U1toXXWithCache_COMMON(name, func,)
 
 #define PROCESS_EnvU1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Unsigned1, suffix); \
         func(LdEnv(), playout->C1); \
@@ -746,7 +751,7 @@
 #define PROCESS_EnvU1toXX(name, func) PROCESS_EnvU1toXX_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_SLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(GetNonVarReg(playout->Instance), playout)); \
@@ -756,7 +761,7 @@
 #define PROCESS_GET_ELEM_SLOTNonVar(name, func, layout) PROCESS_GET_ELEM_SLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_LOCALSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func((Var*)GetLocalClosure(), playout)); \
@@ -766,7 +771,7 @@
 #define PROCESS_GET_ELEM_LOCALSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_LOCALSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_PARAMSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func((Var*)GetParamClosure(), playout)); \
@@ -776,7 +781,7 @@
 #define PROCESS_GET_ELEM_PARAMSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_PARAMSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_INNERSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(InnerScopeFromIndex(playout->SlotIndex1), playout)); \
@@ -786,7 +791,7 @@
 #define PROCESS_GET_ELEM_INNERSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_INNERSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_ENVSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(LdEnv(), playout)); \
@@ -796,7 +801,7 @@
 #define PROCESS_GET_ELEM_ENVSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_ENVSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_SET_ELEM_SLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlot, suffix); \
         func(GetNonVarReg(playout->Instance), playout->SlotIndex, GetRegAllowStackVarEnableOnly(playout->Value)); \
@@ -806,7 +811,7 @@
 #define PROCESS_SET_ELEM_SLOTNonVar(name, func) PROCESS_SET_ELEM_SLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_LOCALSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI1, suffix); \
         func((Var*)GetLocalClosure(), playout->SlotIndex, GetRegAllowStackVarEnableOnly(playout->Value)); \
@@ -816,7 +821,7 @@
 #define PROCESS_SET_ELEM_LOCALSLOTNonVar(name, func) PROCESS_SET_ELEM_LOCALSLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_PARAMSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI1, suffix); \
         func((Var*)GetParamClosure(), playout->SlotIndex, GetRegAllowStackVarEnableOnly(playout->Value)); \
@@ -826,7 +831,7 @@
 #define PROCESS_SET_ELEM_PARAMSLOTNonVar(name, func) PROCESS_SET_ELEM_PARAMSLOTNonVar_COMMON(name, func,); \
 
 #define PROCESS_SET_ELEM_INNERSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI2, suffix); \
         func(InnerScopeFromIndex(playout->SlotIndex1), playout->SlotIndex2, GetRegAllowStackVarEnableOnly(playout->Value)); \
@@ -836,7 +841,7 @@
 #define PROCESS_SET_ELEM_INNERSLOTNonVar(name, func) PROCESS_SET_ELEM_INNERSLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_ENVSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI2, suffix); \
         func(LdEnv(), playout->SlotIndex1, playout->SlotIndex2, GetRegAllowStackVarEnableOnly(playout->Value)); \
@@ -847,7 +852,7 @@
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A3toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg4, suffix); \
         SetReg(playout->R0, \
@@ -859,7 +864,7 @@
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A2I1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3B1, suffix); \
         SetReg(playout->R0, \
@@ -871,7 +876,7 @@
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A2I1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2B1, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1), playout->B2, scriptContext); \
@@ -882,7 +887,7 @@
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A3I1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3B1, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1), GetReg(playout->R2), playout->B3, scriptContext); \
@@ -893,7 +898,7 @@
 
 #if ENABLE_PROFILE_INFO
 #define PROCESS_IP_TARG_IMPL(name, func, layoutSize) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         Assert(!switchProfileMode); \
         ip = func<layoutSize, INTERPRETERPROFILE>(ip); \
@@ -906,7 +911,7 @@
     }
 #else
 #define PROCESS_IP_TARG_IMPL(name, func, layoutSize) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         ip = func<layoutSize, INTERPRETERPROFILE>(ip); \
        break; \
@@ -2459,6 +2464,10 @@ namespace Js
     {
 #if DBG_DUMP
         that->scriptContext->byteCodeHistogram[(int)op]++;
+        if (Js::Configuration::Global.flags.BytecodePairHist)
+        {
+            that->scriptContext->RecordByteCodePair(op);
+        }
         if (PHASE_TRACE(Js::InterpreterPhase, that->m_functionBody))
         {
             Output::Print(_u("%d.%d:Executing %s at offset 0x%X\n"), that->m_functionBody->GetSourceContextId(), that->m_functionBody->GetLocalFunctionId(), Js::OpCodeUtil::GetOpCodeName(op), that->DEBUG_currentByteOffset);
@@ -8582,6 +8591,14 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(uint loopId)
         return aValue;
     }
 
+    template <class T>
+    void InterpreterStackFrame::OP_Ld_A_Pair(const unaligned T * playout)
+    {
+        // The copies are done in order: R2 or R3 may name the register written by the first one.
+        SetRegAllowStackVar(playout->R0, GetRegAllowStackVar(playout->R1));
+        SetRegAllowStackVar(playout->R2, GetRegAllowStackVar(playout->R3));
+    }
+
     Var InterpreterStackFrame::LdEnv() const
     {
         return this->function->GetEnvironment();
@@ -649,6 +649,7 @@ namespace Js
         template <class T> inline void OP_LdNewTarget(const unaligned T* playout);
 
         inline Var OP_Ld_A(Var aValue);
+        template <class T> void OP_Ld_A_Pair(const unaligned T * playout);
         inline Var OP_LdLocalObj();
         inline Var OP_LdParamObj();
         void OP_ChkUndecl(Var aValue);
@@ -4872,6 +4872,135 @@ namespace Js
         return returnValue;
     }
 
+    // Elements are computed in the type the jitted loop computes them in: double for float arrays, and wrapping
+    // 32-bit arithmetic for int arrays, which is what ToInt32 of the exact sum or difference gives. The loops are
+    // kept simple so that they get vectorized. They don't assume the arrays don't overlap, so when they do, the
+    // elements are computed in the same order as the loop the JIT replaced.
+    template <typename TElement, typename TValue, typename Fn>
+    static void MemmapElements(TElement * dst, const TElement * src1, const TElement * src2, TValue src2Value, uint32 length, Fn fn)
+    {
+        if (src2 != nullptr)
+        {
+            for (uint32 i = 0; i < length; i++)
+            {
+                dst[i] = (TElement)fn((TValue)src1[i], (TValue)src2[i]);
+            }
+        }
+        else
+        {
+            for (uint32 i = 0; i < length; i++)
+            {
+                dst[i] = (TElement)fn((TValue)src1[i], src2Value);
+            }
+        }
+    }
+
+    template <typename TArray, typename TElement, typename TValue>
+    static BOOL MemmapTypedArray(Var dstInstance, uint32 start, Var src1Instance, Var src2, uint32 length, int32 op)
+    {
+        TArray * dstArray = TArray::FromVar(dstInstance);
+        TArray * src1Array = TArray::FromVar(src1Instance);
+        TArray * src2Array = nullptr;
+        TValue src2Value = 0;
+
+        if (JavascriptOperators::GetTypeId(src2) == JavascriptOperators::GetTypeId(dstInstance))
+        {
+            src2Array = TArray::FromVar(src2);
+        }
+        else if (TaggedInt::Is(src2))
+        {
+            src2Value = (TValue)TaggedInt::ToInt32(src2);
+        }
+        else if (JavascriptNumber::Is(src2))
+        {
+            double doubleValue = JavascriptNumber::GetValue(src2);
+            if (sizeof(TValue) == sizeof(uint32) && (double)(int32)doubleValue != doubleValue)
+            {
+                // The jitted loop only uses int operands with int arrays
+                return false;
+            }
+            src2Value = sizeof(TValue) == sizeof(uint32) ? (TValue)(int32)doubleValue : (TValue)doubleValue;
+        }
+        else
+        {
+            return false;
+        }
+
+        // Nothing is written unless the whole range is within the arrays. The loop runs in the interpreter otherwise.
+        if (CrossSite::IsCrossSiteObjectTyped(dstArray) ||
+            CrossSite::IsCrossSiteObjectTyped(src1Array) ||
+            (src2Array && CrossSite::IsCrossSiteObjectTyped(src2Array)))
+        {
+            return false;
+        }
+        if (dstArray->IsDetachedBuffer() || src1Array->IsDetachedBuffer() || (src2Array && src2Array->IsDetachedBuffer()))
+        {
+            return false;
+        }
+        uint32 end = start + length;
+        if (end > dstArray->GetLength() || end > src1Array->GetLength() || (src2Array && end > src2Array->GetLength()))
+        {
+            return false;
+        }
+
+        TElement * dst = (TElement *)dstArray->GetByteBuffer() + start;
+        const TElement * src1 = (const TElement *)src1Array->GetByteBuffer() + start;
+        const TElement * src2Elements = src2Array ? (const TElement *)src2Array->GetByteBuffer() + start : nullptr;
+
+        switch (op)
+        {
+        case JavascriptOperators::MemmapOp_Add:
+            MemmapElements(dst, src1, src2Elements, src2Value, length, [](TValue a, TValue b) { return a + b; });
+            break;
+        case JavascriptOperators::MemmapOp_Sub:
+            MemmapElements(dst, src1, src2Elements, src2Value, length, [](TValue a, TValue b) { return a - b; });
+            break;
+        case JavascriptOperators::MemmapOp_Mul:
+            MemmapElements(dst, src1, src2Elements, src2Value, length, [](TValue a, TValue b) { return a * b; });
+            break;
+        case JavascriptOperators::MemmapOp_Div:
+            MemmapElements(dst, src1, src2Elements, src2Value, length, [](TValue a, TValue b) { return a / b; });
+            break;
+        default:
+            AssertMsg(false, "Unknown memmap operation");
+            return false;
+        }
+        return true;
+    }
+
+    BOOL JavascriptOperators::OP_Memmap(Var dstInstance, int32 start, Var src1Instance, Var src2, int32 length, int32 op)
+    {
+        if (length <= 0 || start < 0)
+        {
+            return false;
+        }
+
+        TypeId instanceType = JavascriptOperators::GetTypeId(dstInstance);
+        if (instanceType != JavascriptOperators::GetTypeId(src1Instance))
+        {
+            return false;
+        }
+
+        switch (instanceType)
+        {
+        case TypeIds_Int32Array:
+            // The JIT only maps additions and subtractions over int arrays. Anything else doesn't wrap the same way.
+            if (op != MemmapOp_Add && op != MemmapOp_Sub)
+            {
+                AssertMsg(false, "Unexpected memmap operation on Int32Array");
+                return false;
+            }
+            return MemmapTypedArray<Int32Array, int32, uint32>(dstInstance, start, src1Instance, src2, length, op);
+        case TypeIds_Float32Array:
+            return MemmapTypedArray<Float32Array, float, double>(dstInstance, start, src1Instance, src2, length, op);
+        case TypeIds_Float64Array:
+            return MemmapTypedArray<Float64Array, double, double>(dstInstance, start, src1Instance, src2, length, op);
+        default:
+            AssertMsg(false, "We don't support this type for memmap yet.");
+            return false;
+        }
+    }
+
     Var JavascriptOperators::OP_DeleteElementI_UInt32(Var instance, uint32 index, ScriptContext* scriptContext, PropertyOperationFlags propertyOperationFlags)
     {
 #if FLOATVAR
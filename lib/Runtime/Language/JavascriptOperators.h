@@ -365,6 +365,16 @@ namespace Js
         static Var OP_DeleteElementI_Int32(Var instance, int32 aElementIndex, ScriptContext* scriptContext, PropertyOperationFlags propertyOperationFlags = PropertyOperation_None);
         static BOOL OP_Memset(Var instance, int32 start, Var value, int32 length, ScriptContext* scriptContext);
         static BOOL OP_Memcopy(Var dstInstance, int32 dstStart, Var srcInstance, int32 srcStart, int32 length, ScriptContext* scriptContext);
+
+        // Operation applied by OP_Memmap to each element
+        enum MemmapOp : int32
+        {
+            MemmapOp_Add,
+            MemmapOp_Sub,
+            MemmapOp_Mul,
+            MemmapOp_Div
+        };
+        static BOOL OP_Memmap(Var dstInstance, int32 start, Var src1Instance, Var src2, int32 length, int32 op);
         static Var OP_GetLength(Var instance, ScriptContext* scriptContext);
         static Var OP_GetThis(Var thisVar, int moduleID, ScriptContextInfo* scriptContext);
         static Var OP_GetThisNoFastPath(Var thisVar, int moduleID, ScriptContext* scriptContext);
@@ -8,6 +8,7 @@
 #ifdef ENABLE_WININET_PROFILE_DATA_CACHE
 #include "activscp_private.h"
 #endif
+#include "ByteCode/ByteCodeCacheReleaseFileVersion.h"
 namespace Js
 {
     ExecutionFlags
@@ -331,6 +332,191 @@ namespace Js
         return manager;
     }
 
+    //
+    // Profile data blob handed to the host:
+    //     magic, format version, byte code cache version, layout signature, profile count
+    //     followed by (host source context, is hot, serialized DynamicProfileInfo) for each profile.
+    // The profiles are only meaningful for the byte code they were collected on, so the blob is rejected by
+    // any other engine build.
+    //
+    bool SourceDynamicProfileManager::IsSerializableProfile(FunctionBody * functionBody)
+    {
+        if (!functionBody->HasExecutionDynamicProfileInfo() || functionBody->GetUtf8SourceInfo()->GetIsLibraryCode())
+        {
+            return false;
+        }
+
+        // Dynamic code (eval, new Function, scripts without a host source context) can't be matched up on reload
+        SourceContextInfo * sourceContextInfo = functionBody->GetSourceContextInfo();
+        return sourceContextInfo != nullptr && !sourceContextInfo->IsDynamic();
+    }
+
+    bool SourceDynamicProfileManager::IsHotFunction(FunctionBody * functionBody)
+    {
+        // The engine doesn't keep a total call count. A function was hot if its call count, or the iteration count
+        // of one of its loops, reached the threshold for JIT'ing it during the run.
+        if (functionBody->GetExecutionMode() == ExecutionMode::FullJit)
+        {
+            return true;
+        }
+
+#if ENABLE_NATIVE_CODEGEN
+        return functionBody->MapLoopHeadersUntil([](uint, LoopHeader * loopHeader)
+        {
+            return loopHeader->MapEntryPointsUntil([](int, LoopEntryPointInfo * entryPoint)
+            {
+                return entryPoint->IsCodeGenDone();
+            });
+        });
+#else
+        return false;
+#endif
+    }
+
+    uint32 SourceDynamicProfileManager::GetProfileDataLayoutSignature()
+    {
+        // Profiles are written as raw copies of these structures
+        uint32 signature = sizeof(void *);
+        signature = signature * 31 + sizeof(ValueType);
+        signature = signature * 31 + sizeof(LdElemInfo);
+        signature = signature * 31 + sizeof(StElemInfo);
+        signature = signature * 31 + sizeof(ArrayCallSiteInfo);
+        signature = signature * 31 + sizeof(FldInfo);
+        signature = signature * 31 + sizeof(CallSiteInfo);
+        signature = signature * 31 + sizeof(ImplicitCallFlags);
+        signature = signature * 31 + sizeof(ThisInfo);
+        signature = signature * 31 + sizeof(DynamicProfileInfo::Bits);
+        signature = signature * 31 + sizeof(BVUnit);
+        return signature;
+    }
+
+    template <typename T>
+    bool SourceDynamicProfileManager::SerializeProfileData(ScriptContext * scriptContext, T * writer)
+    {
+        uint profileCount = 0;
+        scriptContext->MapFunction([&](FunctionBody * functionBody)
+        {
+            if (IsSerializableProfile(functionBody))
+            {
+                profileCount++;
+            }
+        });
+
+        if (!writer->Write(ProfileDataMagic)
+            || !writer->Write(ProfileDataFormatVersion)
+            || !writer->Write(byteCodeCacheReleaseFileVersion)
+            || !writer->Write(GetProfileDataLayoutSignature())
+            || !writer->Write(profileCount))
+        {
+            return false;
+        }
+
+        bool succeeded = true;
+        scriptContext->MapFunction([&](FunctionBody * functionBody)
+        {
+            if (succeeded && IsSerializableProfile(functionBody))
+            {
+                uint64 hostSourceContext = (uint64)functionBody->GetSourceContextInfo()->dwHostSourceContext;
+                uint8 isHot = IsHotFunction(functionBody) ? 1 : 0;
+                succeeded = writer->Write(hostSourceContext)
+                    && writer->Write(isHot)
+                    && functionBody->GetAnyDynamicProfileInfo()->Serialize(writer, functionBody);
+            }
+        });
+        return succeeded;
+    }
+
+    size_t SourceDynamicProfileManager::GetSerializedProfileDataSize(ScriptContext * scriptContext)
+    {
+        BufferSizeCounter counter;
+        SerializeProfileData(scriptContext, &counter);
+        return counter.GetByteCount();
+    }
+
+    bool SourceDynamicProfileManager::SerializeProfileData(ScriptContext * scriptContext, __out_ecount(length) char * buffer, size_t length)
+    {
+        BufferWriter writer(buffer, length);
+        return SerializeProfileData(scriptContext, &writer);
+    }
+
+    bool SourceDynamicProfileManager::DeserializeProfileData(ScriptContext * scriptContext, __in_ecount(length) char const * buffer, size_t length)
+    {
+        BufferReader reader(buffer, length);
+
+        uint32 magic;
+        uint32 formatVersion;
+        GUID byteCodeVersion;
+        uint32 layoutSignature;
+        uint profileCount;
+        if (!reader.Read(&magic) || magic != ProfileDataMagic
+            || !reader.Read(&formatVersion) || formatVersion != ProfileDataFormatVersion
+            || !reader.Read(&byteCodeVersion) || memcmp(&byteCodeVersion, &byteCodeCacheReleaseFileVersion, sizeof(GUID)) != 0
+            || !reader.Read(&layoutSignature) || layoutSignature != GetProfileDataLayoutSignature()
+            || !reader.Read(&profileCount))
+        {
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile data rejected: version mismatch\n"));
+            return false;
+        }
+
+        // Read every profile before applying any, so that a corrupt blob leaves the script context as it was.
+        // The list is only referenced from the stack, which keeps it and the profiles alive until they are applied.
+        struct SeededProfile
+        {
+            Field(DWORD_PTR) hostSourceContext;
+            Field(LocalFunctionId) functionId;
+            Field(bool) isHot;
+            Field(DynamicProfileInfo *) dynamicProfileInfo;
+        };
+        typedef JsUtil::List<SeededProfile, Recycler> SeededProfileList;
+
+        Recycler * recycler = scriptContext->GetRecycler();
+        SeededProfileList * seededProfiles = RecyclerNew(recycler, SeededProfileList, recycler);
+        for (uint i = 0; i < profileCount; i++)
+        {
+            uint64 hostSourceContext;
+            uint8 isHot;
+            if (!reader.Read(&hostSourceContext) || (DWORD_PTR)hostSourceContext == Js::Constants::NoHostSourceContext
+                || !reader.Read(&isHot) || isHot > 1)
+            {
+                OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile data rejected: corrupt profile %u\n"), i);
+                return false;
+            }
+
+            Js::LocalFunctionId functionId;
+            DynamicProfileInfo * dynamicProfileInfo = DynamicProfileInfo::Deserialize(&reader, recycler, &functionId);
+            if (dynamicProfileInfo == nullptr)
+            {
+                OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile data rejected: corrupt profile %u\n"), i);
+                return false;
+            }
+
+            SeededProfile seededProfile;
+            seededProfile.hostSourceContext = (DWORD_PTR)hostSourceContext;
+            seededProfile.functionId = functionId;
+            seededProfile.isHot = isHot != 0;
+            seededProfile.dynamicProfileInfo = dynamicProfileInfo;
+            seededProfiles->Add(seededProfile);
+        }
+
+        seededProfiles->Map([&](int, SeededProfile const& seededProfile)
+        {
+            SourceDynamicProfileManager * profileManager = scriptContext->EnsureSeededSourceDynamicProfileManager(seededProfile.hostSourceContext);
+
+            // Whether it applies to the function that ends up with this id is decided by GetDynamicProfileInfo,
+            // same as for profiles from any other cache.
+            profileManager->UpdateDynamicProfileInfo(seededProfile.functionId, seededProfile.dynamicProfileInfo);
+            if (seededProfile.isHot)
+            {
+                if (profileManager->seededHotFunctions == nullptr)
+                {
+                    profileManager->seededHotFunctions = RecyclerNew(recycler, BVSparse<Recycler>, recycler);
+                }
+                profileManager->seededHotFunctions->Set(seededProfile.functionId);
+            }
+        });
+        return true;
+    }
+
 #ifdef DYNAMIC_PROFILE_STORAGE
     void SourceDynamicProfileManager::ClearSavingData()
     {
@@ -21,7 +21,7 @@ namespace Js
     class SourceDynamicProfileManager
     {
     public:
-        SourceDynamicProfileManager(Recycler* allocator) : isNonCachableScript(false), cachedStartupFunctions(nullptr), recycler(allocator),
+        SourceDynamicProfileManager(Recycler* allocator) : isNonCachableScript(false), seededHotFunctions(nullptr), cachedStartupFunctions(nullptr), recycler(allocator),
 #ifdef DYNAMIC_PROFILE_STORAGE
             dynamicProfileInfoMapSaving(&HeapAllocator::Instance),
 #endif
@@ -44,6 +44,13 @@ namespace Js
         bool LoadFromProfileCache(IActiveScriptDataCache* profileDataCache, LPCWSTR url);
         IActiveScriptDataCache* GetProfileCache() { return profileDataCache; }
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
+        // Whether the host provided this function's profile from a previous run in which the function was hot
+        bool IsSeededHotFunction(LocalFunctionId functionId) const { return seededHotFunctions != nullptr && seededHotFunctions->Test(functionId); }
+
+        // Host facing save/load of the profiles of all the scripts in a script context (JsSerializeProfileData/JsSetProfileData)
+        static size_t GetSerializedProfileDataSize(ScriptContext * scriptContext);
+        static bool SerializeProfileData(ScriptContext * scriptContext, __out_ecount(length) char * buffer, size_t length);
+        static bool DeserializeProfileData(ScriptContext * scriptContext, __in_ecount(length) char const * buffer, size_t length);
 #ifdef DYNAMIC_PROFILE_STORAGE
         void ClearSavingData();
         void CopySavingData();
@@ -68,9 +75,16 @@ namespace Js
         uint SaveToProfileCache();
         bool ShouldSaveToProfileCache(SourceContextInfo* info) const;
 
+        template <typename T>
+        static bool SerializeProfileData(ScriptContext * scriptContext, T * writer);
+        static bool IsSerializableProfile(FunctionBody * functionBody);
+        static bool IsHotFunction(FunctionBody * functionBody);
+        static uint32 GetProfileDataLayoutSignature();
+
     //------ Private data members -------- /
     private:
         Field(bool) isNonCachableScript;                    // Indicates if this script can be cached in WININET
+        Field(BVSparse<Recycler>*) seededHotFunctions;      // Functions whose profile the host provided from a previous run in which they were hot
         Field(IActiveScriptDataCache*) profileDataCache;    // WININET based cache to store profile info
         Field(BVFixed*) startupFunctions;                   // Bit vector representing functions that are executed at startup
         Field(BVFixed const *) cachedStartupFunctions;      // Bit vector representing functions executed at startup that are loaded from a persistent or in-memory cache
@@ -80,6 +94,9 @@ namespace Js
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
 
+        static const uint32 ProfileDataMagic = 0x50444A43;  // 'CJDP'
+        static const uint32 ProfileDataFormatVersion = 2;
+
 #ifdef ENABLE_WININET_PROFILE_DATA_CACHE
         //
         // Simple read-only wrapper around IStream - templatized and returns boolean result to indicate errors
@@ -1819,6 +1819,19 @@ ValueType ValueType::FromRawData(const TSize rawData)
     return Verify(static_cast<Bits>(rawData));
 }
 
+// Same checks as Verify, without asserting, for raw data that did not come from this process
+bool ValueType::IsValidRawData(const TSize rawData)
+{
+    const ValueType valueType(static_cast<Bits>(rawData));
+    if(!valueType.bits)
+        return false;
+    if(valueType.OneOn(Bits::Object))
+        return valueType.GetObjectType() < ObjectType::Count;
+    return
+        (valueType.OneOn(Bits::Int) || valueType.AnyOnExcept(Bits::IntCanBeUntagged | Bits::IntIsLikelyUntagged)) &&
+        !valueType.AllEqual(Bits::IntCanBeUntagged | Bits::IntIsLikelyUntagged, Bits::IntIsLikelyUntagged);
+}
+
 // Virtual and Mixed Typed Array Methods
 
 bool ValueType::IsVirtualTypedArrayPair(const ObjectType other) const
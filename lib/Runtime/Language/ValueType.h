@@ -335,6 +335,7 @@ class ValueType
 public:
     TSize GetRawData() const;
     static ValueType FromRawData(const TSize rawData);
+    static bool IsValidRawData(const TSize rawData);
 
 public:
     bool IsVirtualTypedArrayPair(const ObjectType other) const;
@@ -23,6 +23,63 @@ namespace Js
         return static_cast<ArrayBuffer *> (value);
     }
 
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+    // Reservations are 64KB aligned, the low bit of an entry tells a wasm reservation from an asm.js one
+    uintptr_t volatile ArrayBufferBase::virtualBufferRanges[ArrayBufferBase::MaxVirtualBufferCount];
+
+    bool ArrayBufferBase::RegisterVirtualBuffer(void* address, size_t reservationSize)
+    {
+        Assert(((uintptr_t)address & 1) == 0);
+        Assert(reservationSize == MAX_ASMJS_ARRAYBUFFER_LENGTH || reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH);
+
+        PVOID entry = (PVOID)((uintptr_t)address | (reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH ? 1 : 0));
+        for (uint i = 0; i < MaxVirtualBufferCount; i++)
+        {
+            if (virtualBufferRanges[i] == 0 &&
+                InterlockedCompareExchangePointer((PVOID volatile*)&virtualBufferRanges[i], entry, nullptr) == nullptr)
+            {
+                return true;
+            }
+        }
+
+        // Out of slots, treat it like running out of address space
+        return false;
+    }
+
+    void ArrayBufferBase::UnregisterVirtualBuffer(void* address)
+    {
+        for (uint i = 0; i < MaxVirtualBufferCount; i++)
+        {
+            if ((virtualBufferRanges[i] & ~(uintptr_t)1) == (uintptr_t)address)
+            {
+                InterlockedExchangePointer((PVOID volatile*)&virtualBufferRanges[i], nullptr);
+                return;
+            }
+        }
+        AssertMsg(false, "Virtual buffer wasn't registered");
+    }
+
+    bool ArrayBufferBase::IsVirtualBufferAddress(uintptr_t address)
+    {
+        for (uint i = 0; i < MaxVirtualBufferCount; i++)
+        {
+            const uintptr_t entry = virtualBufferRanges[i];
+            if (entry == 0)
+            {
+                continue;
+            }
+
+            const uintptr_t start = entry & ~(uintptr_t)1;
+            const size_t reservationSize = (entry & 1) ? MAX_WASM__ARRAYBUFFER_LENGTH : MAX_ASMJS_ARRAYBUFFER_LENGTH;
+            if (address >= start && address - start < reservationSize)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+
     ArrayBuffer* ArrayBuffer::NewFromDetachedState(DetachedStateBase* state, JavascriptLibrary *library)
     {
         ArrayBufferDetachedStateBase* arrayBufferState = (ArrayBufferDetachedStateBase *)state;
@@ -30,6 +30,14 @@ namespace Js
                 return nullptr;
             }
 
+#ifndef _WIN32
+            if (!RegisterVirtualBuffer(address, MaxVirtualSize))
+            {
+                VirtualFree(address, 0, MEM_RELEASE);
+                return nullptr;
+            }
+#endif
+
             if (length == 0)
             {
                 return address;
@@ -38,7 +46,7 @@ namespace Js
             LPVOID arrayAddress = VirtualAlloc(address, length, MEM_COMMIT, PAGE_READWRITE);
             if (!arrayAddress)
             {
-                VirtualFree(address, 0, MEM_RELEASE);
+                FreeMemAlloc(address);
                 return nullptr;
             }
             return arrayAddress;
@@ -46,9 +54,26 @@ namespace Js
 
         static void FreeMemAlloc(Var ptr)
         {
+#ifndef _WIN32
+            UnregisterVirtualBuffer(ptr);
+#endif
             BOOL fSuccess = VirtualFree((LPVOID)ptr, 0, MEM_RELEASE);
             Assert(fSuccess);
         }
+
+#ifndef _WIN32
+        // xplat: out of bounds accesses to virtual buffers are recovered from the SIGSEGV handler, which can't
+        // take locks. Reservations are kept in a fixed size table that is read without synchronization.
+        static const uint MaxVirtualBufferCount = 4096;
+        static uintptr_t volatile virtualBufferRanges[MaxVirtualBufferCount];
+
+        static bool RegisterVirtualBuffer(void* address, size_t reservationSize);
+        static void UnregisterVirtualBuffer(void* address);
+    public:
+        // Async signal safe
+        static bool IsVirtualBufferAddress(uintptr_t address);
+    protected:
+#endif
 #else
         static void* __cdecl AllocWrapper(DECLSPEC_GUARD_OVERFLOW size_t length)
         {
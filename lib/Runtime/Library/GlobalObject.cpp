@@ -7,6 +7,8 @@
 #include <strsafe.h>
 #endif
 #include "ByteCode/ByteCodeApi.h"
+#include "ByteCode/ByteCodeSerializer.h"
+#include "Base/DynamicCodeCache.h"
 #include "Exceptions/EvalDisabledException.h"
 
 #include "Types/PropertyIndexRanges.h"
@@ -852,6 +854,132 @@ namespace Js
         }
     }
 
+    // Returns the runtime's dynamic code cache if the code compiled from the text can be shared with other contexts
+    static DynamicCodeCache * GetDynamicCodeCache(ScriptContext * scriptContext, int sourceLength, ModuleID moduleID, uint32 grfscr, BOOL isIndirect)
+    {
+        DynamicCodeCache * codeCache = scriptContext->GetThreadContext()->GetDynamicCodeCache();
+
+        // Direct eval code is compiled against the caller's scope, and the debugger, the profiler and TTD need
+        // to see every script compiled
+        if (codeCache == nullptr ||
+            !isIndirect ||
+            moduleID != kmodGlobal ||
+            (grfscr & fscrIsLibraryCode) != 0 ||
+            !codeCache->CanCache(sourceLength) ||
+            scriptContext->IsScriptContextInDebugMode() ||
+            scriptContext->IsProfiling())
+        {
+            return nullptr;
+        }
+#if ENABLE_TTD
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return nullptr;
+        }
+#endif
+        return codeCache;
+    }
+
+    static bool IsFullyCompiled(FunctionProxy * proxy)
+    {
+        if (!proxy->IsFunctionBody())
+        {
+            return false;
+        }
+
+        bool isFullyCompiled = true;
+        proxy->GetFunctionBody()->ForEachNestedFunc([&](FunctionProxy * nestedProxy, uint32 index)
+        {
+            isFullyCompiled = IsFullyCompiled(nestedProxy);
+            return isFullyCompiled;
+        });
+        return isFullyCompiled;
+    }
+
+    static void AddToDynamicCodeCache(ScriptContext * scriptContext, DynamicCodeCache * codeCache, DynamicCodeCache::Key const& key, const char16 * source, ParseableFunctionInfo * funcInfo)
+    {
+        // The serializer writes nested functions that are still deferred as missing
+        if (!IsFullyCompiled(funcInfo))
+        {
+            return;
+        }
+
+        FunctionBody * functionBody = funcInfo->GetFunctionBody();
+        Utf8SourceInfo * sourceInfo = functionBody->GetUtf8SourceInfo();
+        size_t cbSource = sourceInfo->GetCbLength(_u("GlobalObject::AddToDynamicCodeCache"));
+        if (cbSource > DWORD_MAX)
+        {
+            return;
+        }
+
+        byte * buffer = nullptr;
+        DWORD bufferSize = 0;
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+
+            ArenaAllocator tempArena(_u("DynamicCodeCacheArena"), scriptContext->GetThreadContext()->GetPageAllocator(), Js::Throw::OutOfMemory);
+            HRESULT hr = ByteCodeSerializer::SerializeToBuffer(scriptContext, &tempArena, static_cast<DWORD>(cbSource),
+                sourceInfo->GetSource(_u("GlobalObject::AddToDynamicCodeCache")), functionBody, functionBody->GetHostSrcInfo(),
+                true, &buffer, &bufferSize);
+            if (SUCCEEDED(hr))
+            {
+                DynamicCodeCache::CodeInfo codeInfo;
+                codeInfo.byteCode = buffer;
+                codeInfo.byteCodeSize = bufferSize;
+                codeInfo.utf8Source = sourceInfo->GetSource(_u("GlobalObject::AddToDynamicCodeCache"));
+                codeInfo.utf8SourceSize = static_cast<DWORD>(cbSource);
+                codeInfo.functionGrfscr = functionBody->GetGrfscr();
+                codeInfo.parseFlags = sourceInfo->GetParseFlags();
+                codeInfo.byteCodeGenerationFlags = sourceInfo->GetByteCodeGenerationFlags();
+                codeCache->Add(key, source, codeInfo);
+            }
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            // The cache is only an optimization
+        }
+
+        if (buffer != nullptr)
+        {
+            CoTaskMemFree(buffer);
+        }
+    }
+
+    static ParseableFunctionInfo * DeserializeDynamicCode(ScriptContext * scriptContext, ModuleID moduleID, DynamicCodeCache::CodeInfo const& codeInfo)
+    {
+        // Deserialized functions point into the byte code and the source, and the cache entry may be evicted while
+        // they are alive. Copy both into one recycler allocation, with the source first so that the source holder
+        // keeps the whole of it alive.
+        size_t byteCodeOffset = Math::Align<size_t>(codeInfo.utf8SourceSize + 1, HeapConstants::ObjectGranularity);
+        byte * buffer = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), byte, byteCodeOffset + codeInfo.byteCodeSize);
+        js_memcpy_s(buffer, byteCodeOffset, codeInfo.utf8Source, codeInfo.utf8SourceSize + 1);
+        js_memcpy_s(buffer + byteCodeOffset, codeInfo.byteCodeSize, codeInfo.byteCode, codeInfo.byteCodeSize);
+
+        uint32 flags = 0;
+        if (CONFIG_FLAG(CreateFunctionProxy) && !scriptContext->IsProfiling())
+        {
+            flags = fscrAllowFunctionProxy;
+        }
+
+        Field(FunctionBody*) functionBody = nullptr;
+        HRESULT hr = ByteCodeSerializer::DeserializeFromBuffer(scriptContext, flags, (LPCUTF8)buffer,
+            scriptContext->GetModuleSrcInfo(moduleID), buffer + byteCodeOffset, nullptr, &functionBody);
+        if (FAILED(hr))
+        {
+            return nullptr;
+        }
+
+        // Restore what the compile recorded, for when functions are reparsed after being redeferred
+        Utf8SourceInfo * sourceInfo = functionBody->GetUtf8SourceInfo();
+        sourceInfo->SetIsCesu8(true);
+        sourceInfo->SetParseFlags(codeInfo.parseFlags);
+        sourceInfo->SetByteCodeGenerationFlags(codeInfo.byteCodeGenerationFlags);
+        functionBody->SetGrfscr(codeInfo.functionGrfscr);
+
+        return functionBody;
+    }
+
     ScriptFunction* GlobalObject::DefaultEvalHelper(ScriptContext* scriptContext, const char16 *source, int sourceLength, ModuleID moduleID, uint32 grfscr, LPCOLESTR pszTitle, BOOL registerDocument, BOOL isIndirect, BOOL strictMode)
     {
         Assert(sourceLength >= 0);
@@ -861,6 +989,28 @@ namespace Js
             throw Js::EvalDisabledException();
         }
 
+        DynamicCodeCache * codeCache = GetDynamicCodeCache(scriptContext, sourceLength, moduleID, grfscr, isIndirect);
+        DynamicCodeCache::Key codeCacheKey;
+        bool addToCodeCache = false;
+        if (codeCache != nullptr)
+        {
+            codeCacheKey = DynamicCodeCache::Key(source, sourceLength, grfscr, strictMode != FALSE);
+
+            DynamicCodeCache::CodeInfo codeInfo;
+            if (codeCache->TryGet(codeCacheKey, source, &codeInfo))
+            {
+                Js::ParseableFunctionInfo * cachedFuncBody = DeserializeDynamicCode(scriptContext, moduleID, codeInfo);
+                if (cachedFuncBody != nullptr)
+                {
+                    return CreateEvalFunction(scriptContext, cachedFuncBody, grfscr, pszTitle, registerDocument);
+                }
+            }
+            else
+            {
+                addToCodeCache = codeCache->NotifyCompile(codeCacheKey);
+            }
+        }
+
 #ifdef PROFILE_EXEC
         scriptContext->ProfileBegin(Js::EvalCompilePhase);
 #endif
@@ -901,9 +1051,10 @@ namespace Js
 
             SourceContextInfo * sourceContextInfo = pSrcInfo->sourceContextInfo;
             ULONG deferParseThreshold = Parser::GetDeferralThreshold(sourceContextInfo->IsSourceProfileLoaded());
-            if ((ULONG)sourceLength > deferParseThreshold && !PHASE_OFF1(Phase::DeferParsePhase))
+            if ((ULONG)sourceLength > deferParseThreshold && !PHASE_OFF1(Phase::DeferParsePhase) && !addToCodeCache)
             {
-                // Defer function bodies declared inside large dynamic blocks.
+                // Defer function bodies declared inside large dynamic blocks. Text that's going into the dynamic
+                // code cache is compiled in full instead, since only fully compiled functions can be serialized.
                 grfscr |= fscrDeferFncParse;
             }
 
@@ -972,39 +1123,48 @@ namespace Js
         }
         else
         {
-
             Assert(funcBody != nullptr);
-            funcBody->SetDisplayName(pszTitle);
-
-            // Set the functionbody information to dynamic content PROFILER_SCRIPT_TYPE_DYNAMIC
-            funcBody->SetIsTopLevel(true);
-
-            // If not library code then let's find the parent, we may need to register this source if any exception happens later
-            if ((grfscr & fscrIsLibraryCode) == 0)
+            if (addToCodeCache)
             {
-                // For parented eval get the caller's utf8SourceInfo
-                JavascriptFunction* pfuncCaller = nullptr;
-                if (JavascriptStackWalker::GetCaller(&pfuncCaller, scriptContext) && pfuncCaller && pfuncCaller->IsScriptFunction())
-                {
-                    FunctionBody* parentFuncBody = pfuncCaller->GetFunctionBody();
-                    Utf8SourceInfo* parentUtf8SourceInfo = parentFuncBody->GetUtf8SourceInfo();
-                    Utf8SourceInfo* utf8SourceInfo = funcBody->GetUtf8SourceInfo();
-                    utf8SourceInfo->SetCallerUtf8SourceInfo(parentUtf8SourceInfo);
-                }
+                AddToDynamicCodeCache(scriptContext, codeCache, codeCacheKey, source, funcBody);
             }
 
-            if (registerDocument)
+            return CreateEvalFunction(scriptContext, funcBody, grfscr, pszTitle, registerDocument);
+        }
+    }
+
+    ScriptFunction* GlobalObject::CreateEvalFunction(ScriptContext* scriptContext, ParseableFunctionInfo* funcBody, uint32 grfscr, LPCOLESTR pszTitle, BOOL registerDocument)
+    {
+        funcBody->SetDisplayName(pszTitle);
+
+        // Set the functionbody information to dynamic content PROFILER_SCRIPT_TYPE_DYNAMIC
+        funcBody->SetIsTopLevel(true);
+
+        // If not library code then let's find the parent, we may need to register this source if any exception happens later
+        if ((grfscr & fscrIsLibraryCode) == 0)
+        {
+            // For parented eval get the caller's utf8SourceInfo
+            JavascriptFunction* pfuncCaller = nullptr;
+            if (JavascriptStackWalker::GetCaller(&pfuncCaller, scriptContext) && pfuncCaller && pfuncCaller->IsScriptFunction())
             {
-                funcBody->RegisterFuncToDiag(scriptContext, pszTitle);
-                funcBody = funcBody->GetParseableFunctionInfo(); // RegisterFunction may parse and update function body
+                FunctionBody* parentFuncBody = pfuncCaller->GetFunctionBody();
+                Utf8SourceInfo* parentUtf8SourceInfo = parentFuncBody->GetUtf8SourceInfo();
+                Utf8SourceInfo* utf8SourceInfo = funcBody->GetUtf8SourceInfo();
+                utf8SourceInfo->SetCallerUtf8SourceInfo(parentUtf8SourceInfo);
             }
+        }
 
-            ScriptFunction* pfuncScript = funcBody->IsCoroutine() ?
-                scriptContext->GetLibrary()->CreateGeneratorVirtualScriptFunction(funcBody) :
-                scriptContext->GetLibrary()->CreateScriptFunction(funcBody);
-
-            return pfuncScript;
+        if (registerDocument)
+        {
+            funcBody->RegisterFuncToDiag(scriptContext, pszTitle);
+            funcBody = funcBody->GetParseableFunctionInfo(); // RegisterFunction may parse and update function body
         }
+
+        ScriptFunction* pfuncScript = funcBody->IsCoroutine() ?
+            scriptContext->GetLibrary()->CreateGeneratorVirtualScriptFunction(funcBody) :
+            scriptContext->GetLibrary()->CreateScriptFunction(funcBody);
+
+        return pfuncScript;
     }
 
 #ifdef IR_VIEWER
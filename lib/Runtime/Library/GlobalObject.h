@@ -174,6 +174,7 @@ namespace Js
         BOOL SetExistingProperty(PropertyId propertyId, Var value, PropertyValueInfo* info, BOOL *setAttempted);
         BOOL SetExistingRootProperty(PropertyId propertyId, Var value, PropertyValueInfo* info, BOOL *setAttempted);
     private:
+        static ScriptFunction* CreateEvalFunction(ScriptContext* scriptContext, ParseableFunctionInfo* funcBody, uint32 grfscr, LPCOLESTR pszTitle, BOOL registerDocument);
         static BOOL MatchPatternHelper(JavascriptString *propertyName, JavascriptString *pattern, ScriptContext *scriptContext);
 
     private:
@@ -69,7 +69,7 @@ namespace Js {
         sourceInfo->EnsureLineOffsetCache();
         LineOffsetCache *cache = sourceInfo->GetLineOffsetCache();
 
-        if (line >= cache->GetLineCount())
+        if (!cache->HasLine(line))
         {
             return false;
         }
@@ -103,7 +103,7 @@ namespace Js {
         
         startCharOffset = cache->GetCharacterOffsetForLine(line, &startByteOffset);
 
-        if (nextLine >= cache->GetLineCount())
+        if (!cache->HasLine(nextLine))
         {
             endByteOffset = functionBody->LengthInBytes();
             endCharOffset = functionBody->LengthInChars();
@@ -692,9 +692,8 @@ namespace Js
 #endif
 
 #ifdef DISABLE_SEH
-        // xplat: JavascriptArrayBuffer::AllocWrapper is disabled on cross-platform
-        // (IsValidVirtualBufferLength always returns false).
-        // SEH and ResumeForOutOfBoundsArrayRefs are not needed.
+        // xplat: there is no SEH. Out of bounds accesses to virtual array buffers are
+        // resumed from the SIGSEGV handler instead (see AccessViolationFilter).
         ret = JavascriptFunction::CallRootFunctionInternal(obj, args, scriptContext, inScript);
 #else
         if (scriptContext->GetThreadContext()->GetAbnormalExceptionCode() != 0)
@@ -2430,6 +2429,111 @@ void __cdecl _alloca_probe_16()
         return EXCEPTION_CONTINUE_SEARCH;
     }
 
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+    // xplat: the SIGSEGV handler can't take locks, so it only checks that the fault is in the guard pages of a
+    // virtual buffer and hit an instruction we know how to resume. The faulting thread is then redirected to
+    // HandleVirtualBufferFault, which runs the same checks as the SEH filter on Windows outside of the handler.
+    enum VirtualBufferFaultState
+    {
+        VirtualBufferFaultNone,
+        VirtualBufferFaultPending,      // Redirected, HandleVirtualBufferFault hasn't finished with the fault yet
+        VirtualBufferFaultUnhandled     // Not ours, the fault is raised again and must reach the default handler
+    };
+
+    struct JavascriptFunction::VirtualBufferFault
+    {
+        EXCEPTION_RECORD record;
+        CONTEXT context;
+    };
+
+    // Read and written from the SIGSEGV handler. A plain __thread integer with the initial-exec model is a fixed
+    // offset from the thread pointer: no lazy allocation or __tls_get_addr call, so it's async signal safe.
+    static __thread VirtualBufferFaultState s_virtualBufferFaultState __attribute__((tls_model("initial-exec")));
+
+    // The pending fault is copied below the faulting frame, out of reach of HandleVirtualBufferFault's own frame,
+    // which copies it into a local before calling anything else.
+    static const size_t VirtualBufferFaultStackReserve = 0x1000;
+
+    void JavascriptFunction::HandleVirtualBufferFault(VirtualBufferFault* pendingFault)
+    {
+        VirtualBufferFault fault = *pendingFault;
+        Assert((BYTE*)&fault >= (BYTE*)(pendingFault + 1));
+        Assert(s_virtualBufferFaultState == VirtualBufferFaultPending);
+
+        EXCEPTION_POINTERS exceptionInfo = { &fault.record, &fault.context };
+        bool resume;
+        {
+            // Wasm traps throw from the filter, unwinding through the JIT'd frame that faulted
+            struct AutoClearFault
+            {
+                ~AutoClearFault() { s_virtualBufferFaultState = VirtualBufferFaultNone; }
+            } autoClearFault;
+
+            resume = ThreadContext::GetContextForCurrentThread() != nullptr &&
+                CallRootEventFilter(STATUS_ACCESS_VIOLATION, &exceptionInfo) == EXCEPTION_CONTINUE_EXECUTION;
+        }
+
+        if (!resume)
+        {
+            // Run the faulting instruction again with its original context. AccessViolationFilter sees the state,
+            // resets it and lets this one fault go to the default handler.
+            s_virtualBufferFaultState = VirtualBufferFaultUnhandled;
+        }
+        RtlRestoreContext(&fault.context, nullptr);
+    }
+
+    // Registered with the PAL, called from the SIGSEGV handler of the faulting thread. Must be async signal safe.
+    BOOL JavascriptFunction::AccessViolationFilter(PEXCEPTION_POINTERS exceptionInfo)
+    {
+        switch (s_virtualBufferFaultState)
+        {
+        case VirtualBufferFaultNone:
+            break;
+        case VirtualBufferFaultPending:
+            // Faulted again while handling a fault
+            return FALSE;
+        case VirtualBufferFaultUnhandled:
+            // The re-raised fault that wasn't ours. Later faults on this thread are looked at again.
+            s_virtualBufferFaultState = VirtualBufferFaultNone;
+            return FALSE;
+        }
+
+        PEXCEPTION_RECORD record = exceptionInfo->ExceptionRecord;
+        PCONTEXT context = exceptionInfo->ContextRecord;
+        if (record->ExceptionCode != STATUS_ACCESS_VIOLATION || record->NumberParameters < 2 ||
+            !ArrayBufferBase::IsVirtualBufferAddress(record->ExceptionInformation[1]))
+        {
+            return FALSE;
+        }
+
+        BYTE* pc = (BYTE*)record->ExceptionAddress;
+        ArrayAccessDecoder::InstructionData instrData = ArrayAccessDecoder::CheckValidInstr(pc, exceptionInfo);
+        if (instrData.isInvalidInstr || !instrData.bufferValue)
+        {
+            return FALSE;
+        }
+
+        // JIT'd code accesses buffers with the stack aligned. Make it look like the faulting instruction called
+        // HandleVirtualBufferFault, so wasm traps unwind through the JIT'd frame as usual.
+        if ((context->Rsp & 0xF) != 0)
+        {
+            return FALSE;
+        }
+
+        VirtualBufferFault* pendingFault = (VirtualBufferFault*)
+            ((context->Rsp - VirtualBufferFaultStackReserve - sizeof(VirtualBufferFault)) & ~(DWORD64)0xF);
+        pendingFault->record = *record;
+        pendingFault->context = *context;
+        s_virtualBufferFaultState = VirtualBufferFaultPending;
+
+        context->Rsp -= sizeof(DWORD64);
+        *(DWORD64*)context->Rsp = context->Rip;
+        context->Rdi = (DWORD64)pendingFault;
+        context->Rip = (DWORD64)HandleVirtualBufferFault;
+        return TRUE;
+    }
+#endif
+
 #if DBG
     void JavascriptFunction::VerifyEntryPoint()
     {
@@ -236,9 +236,16 @@ namespace Js
         void VerifyEntryPoint();
 
         static bool IsBuiltinProperty(Var objectWithProperty, PropertyIds propertyId);
+#endif
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+        static BOOL AccessViolationFilter(PEXCEPTION_POINTERS exceptionInfo);
 #endif
         private:
             static int CallRootEventFilter(int exceptionCode, PEXCEPTION_POINTERS exceptionInfo);
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+            struct VirtualBufferFault;
+            static void HandleVirtualBufferFault(VirtualBufferFault* pendingFault);
+#endif
     };
 #if ENABLE_NATIVE_CODEGEN && defined(_M_X64)
     class ArrayAccessDecoder
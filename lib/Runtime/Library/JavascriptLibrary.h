@@ -34,6 +34,9 @@ namespace Js
     static const unsigned int EvalMRUSize = 15;
     typedef JsUtil::BaseDictionary<DWORD_PTR, SourceContextInfo *, Recycler, PowerOf2SizePolicy> SourceContextInfoMap;
     typedef JsUtil::BaseDictionary<uint, SourceContextInfo *, Recycler, PowerOf2SizePolicy> DynamicSourceContextInfoMap;
+#if ENABLE_PROFILE_INFO
+    typedef JsUtil::BaseDictionary<DWORD_PTR, SourceDynamicProfileManager *, Recycler, PowerOf2SizePolicy> SeededSourceDynamicProfileManagerMap;
+#endif
 
     typedef JsUtil::BaseDictionary<EvalMapString, ScriptFunction*, RecyclerNonLeafAllocator, PrimeSizePolicy> SecondLevelEvalCache;
     typedef TwoLevelHashRecord<FastEvalMapString, ScriptFunction*, SecondLevelEvalCache, EvalMapString> EvalMapRecord;
@@ -87,6 +90,7 @@ namespace Js
         Field(ScriptContextPolymorphicInlineCache*) toStringTagCache;
         Field(ScriptContextPolymorphicInlineCache*) toJSONCache;
 #if ENABLE_PROFILE_INFO
+        Field(SeededSourceDynamicProfileManagerMap*) seededSourceDynamicProfileManagerMap; // profiles set by the host for scripts that aren't loaded yet, keyed by host source context
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         Field(DynamicProfileInfoList*) profileInfoList;
 #endif
@@ -167,6 +167,8 @@ def CreateXPlatBuildTasks = { machine, platform, configTag, xplatBranch, nonDefa
     [true, false].each { isPR ->
         CreateXPlatBuildTask(isPR, "test", "", machine, platform,
             configTag, xplatBranch, nonDefaultTaskSetup, "--no-jit", "--variants disable_jit", extraBuildParams)
+        CreateXPlatBuildTask(isPR, "test", "", machine, platform,
+            configTag, xplatBranch, nonDefaultTaskSetup, "--threaded-interpreter", "", extraBuildParams)
 
         ['debug', 'test', 'release'].each { buildType ->
             def staticBuildConfigs = [true, false]
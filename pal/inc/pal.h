@@ -3607,7 +3607,7 @@ GlobalMemoryStatusEx(
 
 typedef struct _MEMORY_BASIC_INFORMATION {
     PVOID BaseAddress;
-    PVOID AllocationBase_PAL_Undefined;
+    PVOID AllocationBase;
     DWORD AllocationProtect;
     SIZE_T RegionSize;
     DWORD State;
@@ -5792,6 +5792,14 @@ PAL_InjectActivation(
     IN HANDLE hThread
 );
 
+typedef BOOL (*PAL_AccessViolationFilter)(EXCEPTION_POINTERS *pointers);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_SetAccessViolationFilter(
+    IN PAL_AccessViolationFilter pAccessViolationFilter);
+
 #define VER_PLATFORM_WIN32_WINDOWS        1
 #define VER_PLATFORM_WIN32_NT        2
 #define VER_PLATFORM_UNIX            10
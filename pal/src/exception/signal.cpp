@@ -290,6 +290,24 @@ static void sigsegv_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
+        if (g_accessViolationFilter != NULL &&
+            record.ExceptionCode == EXCEPTION_ACCESS_VIOLATION)
+        {
+            CONTEXT winContext;
+            CONTEXTFromNativeContext(
+                ucontext,
+                &winContext,
+                CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_FLOATING_POINT);
+
+            pointers.ContextRecord = &winContext;
+            if (g_accessViolationFilter(&pointers))
+            {
+                // Filter may have modified the context, so update it and resume.
+                CONTEXTToNativeContext(&winContext, ucontext);
+                return;
+            }
+        }
+
         common_signal_handler(&pointers, code, ucontext);
     }
 
@@ -785,6 +785,7 @@ WaitForEndingThreads(
 
 extern PAL_ActivationFunction g_activationFunction;
 extern PAL_SafeActivationCheckFunction g_safeActivationCheckFunction;
+extern PAL_AccessViolationFilter g_accessViolationFilter;
 
 /*++
 Macro:
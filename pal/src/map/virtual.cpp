@@ -2374,6 +2374,7 @@ VirtualQuery(
         TRACE( "RegionSize = %d.\n", RegionSize );
 
         /* Fill the structure.*/
+        lpBuffer->AllocationBase = (LPVOID)pEntry->startBoundary;
         lpBuffer->AllocationProtect = pEntry->accessProtection;
         lpBuffer->BaseAddress = (LPVOID)StartBoundary;
 
@@ -2383,7 +2384,8 @@ VirtualQuery(
         lpBuffer->RegionSize = RegionSize;
         lpBuffer->State =
             ( AllocationType == MEM_COMMIT ? MEM_COMMIT : MEM_RESERVE );
-        WARN( "Ignoring lpBuffer->Type. \n" );
+        /* Regions tracked here always come from VirtualAlloc */
+        lpBuffer->Type = MEM_PRIVATE;
     }
 
 ExitVirtualQuery:
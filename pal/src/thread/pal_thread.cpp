@@ -101,6 +101,8 @@ static int iEndingThreads = 0;
 PAL_ActivationFunction g_activationFunction = NULL;
 // Function to check if an activation can be safely injected at a specified context
 PAL_SafeActivationCheckFunction g_safeActivationCheckFunction = NULL;
+// Filter that gets a chance to resume execution after an access violation
+PAL_AccessViolationFilter g_accessViolationFilter = NULL;
 
 void
 ThreadCleanupRoutine(
@@ -2619,6 +2621,29 @@ PAL_SetActivationFunction(
     g_safeActivationCheckFunction = pSafeActivationCheckFunction;
 }
 
+/*++
+Function:
+    PAL_SetAccessViolationFilter
+
+    Register a filter that gets called when an access violation is raised on a
+    thread, before the signal is chained to the previous handler. The filter runs
+    in the signal handler and must be async signal safe.
+
+Parameters:
+    pAccessViolationFilter - filter function. If it returns TRUE, the (possibly
+                             modified) context is restored and execution resumes
+Return value:
+    None
+--*/
+PALIMPORT
+VOID
+PALAPI
+PAL_SetAccessViolationFilter(
+    IN PAL_AccessViolationFilter pAccessViolationFilter)
+{
+    g_accessViolationFilter = pAccessViolationFilter;
+}
+
 /*++
 Function:
 PAL_InjectActivation
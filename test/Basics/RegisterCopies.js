@@ -0,0 +1,91 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Back-to-back register copies within a statement may be emitted as a single fused instruction. The copies
+// must still take effect in order, including when the second one reads or writes the register of the first.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var tests = [
+    {
+        name: "Swap through a temp in a single expression",
+        body: function () {
+            function swap(a, b) {
+                var t;
+                t = a, a = b, b = t;
+                return [a, b];
+            }
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual([2, 1], swap(1, 2), "Swap through a temp");
+                assert.areEqual(["y", "x"], swap("x", "y"), "Swap strings through a temp");
+            }
+        }
+    },
+    {
+        name: "Rotate and overlapping copies",
+        body: function () {
+            function rotate(a, b, c) {
+                var t;
+                t = a, a = b, b = c, c = t;
+                return [a, b, c];
+            }
+            function overlap(a, b, c) {
+                // The second copy reads the register written by the first one
+                b = a, c = b;
+                return [a, b, c];
+            }
+            function overwrite(a, b) {
+                // Both copies write the same register
+                var r;
+                r = a, r = b;
+                return r;
+            }
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual([2, 3, 1], rotate(1, 2, 3), "Rotate left");
+                assert.areEqual([1, 1, 1], overlap(1, 2, 3), "Second copy sees the first");
+                assert.areEqual(2, overwrite(1, 2), "Last copy wins");
+            }
+        }
+    },
+    {
+        name: "Copies around branches and loop headers",
+        body: function () {
+            function fib(n) {
+                var a = 0, b = 1, t;
+                while (n-- > 0) {
+                    t = a + b, a = b, b = t;
+                }
+                return a;
+            }
+            function pick(c, x, y) {
+                var r, s;
+                r = c ? x : y, s = r;
+                return [r, s];
+            }
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual(55, fib(10), "Fibonacci through copies");
+                assert.areEqual(6765, fib(20), "Fibonacci through copies");
+                assert.areEqual([1, 1], pick(true, 1, 2), "Copy after the true branch");
+                assert.areEqual([2, 2], pick(false, 1, 2), "Copy after the false branch");
+            }
+        }
+    },
+    {
+        name: "Copies of objects and functions",
+        body: function () {
+            function chain() {
+                var o = {}, f = function () { return 7; };
+                var p, g;
+                p = o, g = f;
+                return p === o && g === f && g() === 7;
+            }
+            for (var i = 0; i < 100; i++) {
+                assert.isTrue(chain(), "Copied references are the same objects");
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
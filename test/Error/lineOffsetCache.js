@@ -0,0 +1,68 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Line numbers in stacks are looked up lazily and the line starts are stored in chunks of 16-bit deltas.
+// Throw from lines on both sides of chunk boundaries, out of order, after very long lines and after non-ASCII text.
+
+const lineTerminators = ["\n", "\r\n", "\r", "\u2028", "\u2029"];
+
+function prefixFor(i) {
+    switch (i % 7) {
+        case 0: return "";
+        case 1: return " ".repeat(i % 17);
+        case 2: return "/*" + "é".repeat(i) + "*/";
+        case 3: return "/*" + "x".repeat(70000) + "*/";
+        case 4: return "/*" + "\u{1F600}".repeat(i % 5) + "*/";
+        case 5: return "/*" + "€".repeat(30000) + "*/";
+        default: return "\t";
+    }
+}
+
+function check(lineCount, order) {
+    let source = "";
+    for (let i = 0; i < lineCount; i++) {
+        source += prefixFor(i) + "functions[" + i + "] = function () { throw new Error(); };" + lineTerminators[i % lineTerminators.length];
+    }
+
+    const functions = [];
+    eval(source);
+
+    let baseColumn;
+    for (const i of order(lineCount)) {
+        let stack;
+        try {
+            functions[i]();
+        } catch (e) {
+            stack = e.stack;
+        }
+
+        const match = /eval code:(\d+):(\d+)/.exec(stack);
+        if (match === null) {
+            throw new Error("no eval frame in " + stack);
+        }
+
+        const line = Number(match[1]);
+        const column = Number(match[2]) - prefixFor(i).length - String(i).length;
+        if (baseColumn === undefined) {
+            baseColumn = column;
+        }
+
+        if (line !== i + 1 || column !== baseColumn) {
+            throw new Error("line count " + lineCount + ", line " + (i + 1) + ": got " + match[1] + ":" + match[2]);
+        }
+    }
+}
+
+function ascending(n) { return Array.from({ length: n }, (_, i) => i); }
+function descending(n) { return ascending(n).reverse(); }
+function interleaved(n) { return ascending(n).map((_, i) => (i % 2) ? n - 1 - (i >> 1) : (i >> 1)); }
+
+for (const lineCount of [1, 2, 63, 64, 65, 128, 129, 300]) {
+    check(lineCount, ascending);
+    check(lineCount, descending);
+    check(lineCount, interleaved);
+}
+
+WScript.Echo("pass");
@@ -0,0 +1,98 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Under -DynamicCodeCache, Function constructor bodies and indirect eval code compiled by more than one
+// context of a runtime are shared as serialized byte code. Each context's copy must still behave as if it
+// had been compiled there.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var contexts = [this];
+for (var i = 0; i < 4; i++) {
+    contexts.push(WScript.LoadScript("", "samethread"));
+}
+
+var body =
+    "var total = 0;\n" +
+    "for (var i = 0; i < n; i++) { total += scale(i); }\n" +
+    "return total + base;\n" +
+    "function scale(x) { return x * factor(); }\n" +
+    "function factor() { return 2; }";
+
+var strictBody = "'use strict'; return typeof this + ':' + (function () { return this; })();";
+
+var unicodeBody = "return '\\u00e9\u00e9\ud83d\ude00'.length + ':' + arguments.length;";
+
+// Large enough to be deferred when it isn't going into the cache
+var largeBody = "var sum = 0;\n";
+for (var i = 0; i < 200; i++) {
+    largeBody += "function f" + i + "(x) { return x + " + i + "; }\nsum += f" + i + "(1);\n";
+}
+largeBody += "return sum;";
+
+// Each text is compiled twice in every context. Globals are looked up in the context the function was created in.
+var tests = [
+    {
+        name: "Function constructor bodies",
+        body: function () {
+            for (var round = 0; round < 2; round++) {
+                for (var c = 0; c < contexts.length; c++) {
+                    var g = contexts[c];
+                    g.base = c * 1000;
+
+                    var f = new g.Function("n", body);
+                    assert.areEqual(90 + c * 1000, f(10), "Function body in context " + c);
+                    assert.areEqual("function anonymous(n\n) {" + body + "\n}", f.toString(), "Function toString in context " + c);
+                    assert.isTrue(Object.getPrototypeOf(f) === g.Function.prototype, "Function prototype in context " + c);
+
+                    var strict = new g.Function(strictBody);
+                    assert.areEqual("number:undefined", strict.call(5), "strict Function body in context " + c);
+
+                    assert.areEqual("4:2", new g.Function(unicodeBody)(1, 2), "Function body with non-ASCII source in context " + c);
+
+                    assert.areEqual(20100, new g.Function(largeBody)(), "large Function body in context " + c);
+                }
+            }
+        }
+    },
+    {
+        name: "Indirect eval code",
+        body: function () {
+            for (var round = 0; round < 2; round++) {
+                for (var c = 0; c < contexts.length; c++) {
+                    var g = contexts[c];
+                    g.base = c * 1000;
+
+                    assert.areEqual(3 * c * 1000, g.eval("var evalVar" + round + " = 3; evalVar" + round + " * base"), "indirect eval in context " + c);
+                    assert.areEqual(3, g["evalVar" + round], "indirect eval declares globals in context " + c);
+
+                    assert.areEqual(4, g.eval("'use strict'; var strictVar = 4; strictVar"), "strict indirect eval in context " + c);
+                    assert.areEqual("undefined", typeof g.strictVar, "strict indirect eval doesn't declare globals in context " + c);
+
+                    var closures = g.eval("(function () { var count = 0; return function () { return ++count; }; })()");
+                    closures();
+                    assert.areEqual(2, closures(), "closure from indirect eval in context " + c);
+                }
+            }
+        }
+    },
+    {
+        name: "Syntax errors aren't cached",
+        body: function () {
+            for (var c = 0; c < contexts.length; c++) {
+                // The error comes from the other context, which assert.throws can't match by constructor
+                var errorName;
+                try {
+                    new contexts[c].Function("return (");
+                } catch (e) {
+                    errorName = e.name;
+                }
+                assert.areEqual("SyntaxError", errorName, "syntax error in context " + c);
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// IIFE bodies are parsed on background threads while the main thread scans ahead. Closure bindings,
+// regex literals and nested functions have to come out the same as with a main thread parse. The IIFEs
+// are named so that -trace:ParallelParse can show which ones were parsed in the background.
+
+var result = [];
+var shared = "outer";
+
+(function first() {
+    var local = 1;
+    function inner() { return local + 1; }
+    result.push(inner() === 2);
+    result.push(shared === "outer");
+})();
+
+var value = (function sumRange(a, b) {
+    let sum = 0;
+    for (let i = a; i < b; i++) {
+        sum += i;
+    }
+    return sum;
+}(0, 10));
+result.push(value === 45);
+
+!function withRegExp() {
+    var re = /a+b/g;
+    result.push("aab ab b".match(re).length === 2);
+    shared = "changed";
+}();
+result.push(shared === "changed");
+
+var module = (function makeModule() {
+    var count = 0;
+    return {
+        increment: function () { return ++count; },
+        nested: (function () { return typeof count; })()
+    };
+})();
+result.push(module.increment() === 1 && module.increment() === 2);
+result.push(module.nested === "number");
+
+try {
+    eval("(function broken() { var x = ; })();");
+    result.push(false);
+} catch (e) {
+    result.push(e instanceof SyntaxError);
+}
+
+if (result.every(function (x) { return x === true; })) {
+    WScript.Echo("pass");
+} else {
+    WScript.Echo("fail: " + JSON.stringify(result));
+}
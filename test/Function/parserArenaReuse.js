@@ -0,0 +1,10 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Parsing this file creates the thread's first parser arena. Each eval below parses again on the same thread
+// and should get that arena back from the pool instead of creating a new one.
+eval("var a = 1;");
+eval("var b = a + 1;");
+eval("var c = b + 1;");
@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Functions that go unused for a GC are redeferred under -ReclaimColdFunctions and must behave the same
+// when they are called again.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeCounter(start) {
+    var count = start;
+    return {
+        next: function () { return ++count; },
+        reset: function (value = start) { count = value; return count; }
+    };
+}
+
+function sumArgs() {
+    var s = 0;
+    for (var i = 0; i < arguments.length; i++) {
+        s += arguments[i];
+    }
+    return s;
+}
+
+function outer(x) {
+    function inner(y) {
+        return x * y;
+    }
+    return inner(x + 1);
+}
+
+function churn() {
+    var a = [];
+    for (var i = 0; i < 1000; i++) {
+        a.push({ i: i });
+    }
+    return a.length;
+}
+
+var counter = makeCounter(10);
+
+var tests = [
+    {
+        name: "Functions run before they go cold",
+        body: function () {
+            assert.areEqual(11, counter.next(), "counter");
+            assert.areEqual(6, sumArgs(1, 2, 3), "sumArgs");
+            assert.areEqual(12, outer(3), "outer");
+        }
+    },
+    {
+        name: "Redeferred functions behave the same when they are called again",
+        body: function () {
+            for (var gc = 0; gc < 10; gc++) {
+                churn();
+                CollectGarbage();
+            }
+
+            assert.areEqual(12, counter.next(), "counter keeps its state");
+            assert.areEqual(10, counter.reset(), "counter reset");
+            assert.areEqual(11, counter.next(), "counter after reset");
+            assert.areEqual(9, sumArgs(4, 5), "sumArgs");
+            assert.areEqual(20, outer(4), "outer");
+            assert.areEqual(1, makeCounter(0).next(), "new counter");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
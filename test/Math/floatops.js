@@ -0,0 +1,45 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Float arithmetic where the destination isn't the first source, with enough live values to use the
+// extended xmm registers. The jitted results must match the interpreted ones, which the baseline holds.
+
+function ops64(a, b, c, d) {
+    var e = a + b, f = a - b, g = b - a, h = a * c, i = c / a;
+    var j = d - c, k = d / b, l = b * d, m = c + d, n = a / d;
+    var o = e - f, p = g * h, q = i + j, r = k - l, s = m / n;
+    var t = e * s, u = f - r, v = g / q, w = h + p, x = i - o;
+    return [e, f, g, h, i, j, k, l, m, n, o, p, q, r, s, t, u, v, w, x, t - u + v * w / x];
+}
+
+function ops32(a, b, c, d) {
+    var fr = Math.fround;
+    a = fr(a); b = fr(b); c = fr(c); d = fr(d);
+    var e = fr(a + b), f = fr(a - b), g = fr(b - a), h = fr(a * c), i = fr(c / a);
+    var j = fr(d - c), k = fr(d / b), l = fr(b * d), m = fr(c + d), n = fr(a / d);
+    var o = fr(e - f), p = fr(g * h), q = fr(i + j), r = fr(k - l), s = fr(m / n);
+    return [e, f, g, h, i, j, k, l, m, n, o, p, q, r, s, fr(fr(o - p) + fr(q * fr(r / s)))];
+}
+
+var inputs = [
+    [1.5, 2.25, -3.125, 7],
+    [0.1, 0.2, 0.3, 0.4],
+    [-1e300, 1e-300, 3, -0],
+    [NaN, 1, Infinity, -Infinity],
+    [123456.789, -0.001, 42, 1 / 3]
+];
+
+function format(value) {
+    return Object.is(value, -0) ? "-0" : String(value);
+}
+
+for (var round = 0; round < 4; round++) {
+    WScript.Echo("round " + round);
+    for (var i = 0; i < inputs.length; i++) {
+        var args = inputs[i];
+        var results = ops64.apply(null, args).concat(ops32.apply(null, args));
+        WScript.Echo("input " + i + ": " + results.map(format).join(", "));
+    }
+}
@@ -0,0 +1,67 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -on:ParallelSweep and concurrent GC stress: objects of many small and medium sizes die
+// and survive across background sweeps that are spread over the parallel threads.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeObject(id, size) {
+    var o = { id: id, items: new Array(size) };
+    for (var i = 0; i < size; i++) {
+        o.items[i] = id + i;
+    }
+    return o;
+}
+
+function checkObject(o, id, size) {
+    assert.areEqual(id, o.id, "id");
+    assert.areEqual(size, o.items.length, "length");
+    for (var i = 0; i < size; i++) {
+        assert.areEqual(id + i, o.items[i], "item " + i);
+    }
+}
+
+var tests = [
+    {
+        name: "Surviving objects are intact after parallel background sweeps",
+        body: function () {
+            var sizes = [1, 3, 8, 17, 40, 100, 300, 700];
+            var live = [];
+            for (var round = 0; round < 20; round++) {
+                for (var i = 0; i < sizes.length; i++) {
+                    var o = makeObject(round * 1000 + i, sizes[i]);
+                    if ((round + i) % 3 == 0) {
+                        live.push({ object: o, id: round * 1000 + i, size: sizes[i] });
+                    }
+                }
+            }
+
+            for (var i = 0; i < live.length; i++) {
+                checkObject(live[i].object, live[i].id, live[i].size);
+            }
+        }
+    },
+    {
+        name: "Strings and closures allocated across sweeps keep their values",
+        body: function () {
+            var fns = [];
+            for (var i = 0; i < 200; i++) {
+                var s = "value" + i;
+                fns.push(function (v) { return function () { return v; }; }(s + s.length));
+                if (i % 2 == 0) {
+                    fns[i] = null;
+                }
+            }
+
+            for (var i = 1; i < 200; i += 2) {
+                var s = "value" + i;
+                assert.areEqual(s + s.length, fns[i](), "closure " + i);
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,80 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Object literals that only live within a block are scalar-replaced. Those that escape, or that a bail out needs,
+// must still be real objects.
+
+// The arithmetic is done before the literal is created, so no overflow bail out happens while it is live
+function sumPoints(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        var x = i + 1;
+        var y = i * 2;
+        var p = { x: i, y: y };
+        p.x = x;
+        sum += p.x + p.y;
+    }
+    return sum;
+}
+
+var escaped = [];
+function escape(n) {
+    for (var i = 0; i < n; i++) {
+        var p = { x: i, y: -i };
+        escaped.push(p);
+    }
+    return escaped.length;
+}
+
+// The stored value's sym is redefined before the load
+function redefine(a) {
+    var o = { v: a };
+    a = a + 1;
+    return o.v + a;
+}
+
+// A property the literal doesn't have is looked up on the prototype
+Object.prototype.inherited = 5;
+function inherited(a) {
+    var o = { v: a };
+    return o.inherited + o.v;
+}
+
+// Overflow bails out while the object is still live
+function overflow(a) {
+    var o = { v: a, w: a };
+    var r = o.v + 0x7fffffff;
+    return r + o.w;
+}
+
+// The type of the stored value changes
+function typeChange(a) {
+    var o = { v: a };
+    return o.v + o.v;
+}
+
+function compare(a, b) {
+    var o = { a: a, b: b };
+    return o.a < o.b ? o.b : o.a;
+}
+
+// Jit sumPoints before anything is printed, so that the -trace:ScalarReplacement run's output doesn't depend on
+// when that happens
+for (var warmUp = 0; warmUp < 3; warmUp++) {
+    sumPoints(1);
+}
+
+for (var round = 0; round < 3; round++) {
+    WScript.Echo("round " + round);
+    WScript.Echo("sumPoints: " + sumPoints(100));
+    escaped.length = 0;
+    WScript.Echo("escape: " + escape(10) + ", escaped object: " + escaped[9].y);
+    WScript.Echo("redefine: " + redefine(1));
+    WScript.Echo("inherited: " + inherited(1));
+    WScript.Echo("overflow: " + overflow(round));
+    WScript.Echo("overflow bail out: " + overflow(0x7fffffff));
+    WScript.Echo("typeChange: " + typeChange(round) + ", " + typeChange("s"));
+    WScript.Echo("compare: " + compare(round, 1));
+}
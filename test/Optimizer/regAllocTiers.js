@@ -0,0 +1,38 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Nested loops with more live values than there are registers, so that values live on the back edges
+// of the outer loops get spilled from inside the inner loops. Run with simple JIT only and with full JIT
+// loop bodies, the results must match the interpreted ones, which the baseline holds.
+
+function nested(n, seed) {
+    var a = seed, b = seed + 1, c = seed + 2, d = seed + 3, e = seed + 4, f = seed + 5, g = seed + 6, h = seed + 7;
+    var x = 0.5 * seed, y = 1.5 * seed, z = 2.5 * seed;
+    for (var i = 0; i < n; i++) {
+        a = (a + i) | 0;
+        for (var j = 0; j < 4; j++) {
+            b = (b ^ (a + j)) | 0;
+            for (var k = 0; k < 3; k++) {
+                c = (c + b * k) | 0;
+                d = (d - c + e) | 0;
+                x = x + c / (k + 1);
+                f = (f + (d & 0xff)) | 0;
+            }
+            e = (e + d - j) | 0;
+            y = y * 0.5 + x;
+        }
+        g = (g + f + e) | 0;
+        h = (h ^ g) | 0;
+        z = z - y / (i + 1);
+    }
+    return [a, b, c, d, e, f, g, h, x, y, z];
+}
+
+for (var round = 0; round < 4; round++) {
+    WScript.Echo("round " + round);
+    for (var seed = 0; seed < 3; seed++) {
+        WScript.Echo("seed " + seed + ": " + nested(20 + seed, seed).join(", "));
+    }
+}
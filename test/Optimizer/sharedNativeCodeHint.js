@@ -0,0 +1,35 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The same source is loaded into several script contexts. Once the hot function is full JITed in the
+// first one, the later contexts skip simple JIT for it and must still compute the same results. With
+// -trace:SharedNativeCodeHint, each of the later contexts prints that it used the hint for sum.
+var source =
+    "function sum(a, n) {\n" +
+    "    var s = 0;\n" +
+    "    for (var i = 0; i < n; i++) { s += a[i] * 2; }\n" +
+    "    return s;\n" +
+    "}\n" +
+    "function run() {\n" +
+    "    var a = [];\n" +
+    "    for (var i = 0; i < 100; i++) { a[i] = i; }\n" +
+    "    var total = 0;\n" +
+    "    for (var j = 0; j < 1000; j++) { total += sum(a, j % 100); }\n" +
+    "    a[3] = 1.5;\n" +
+    "    total += sum(a, 100);\n" +
+    "    return total;\n" +
+    "}\n";
+
+var expected;
+for (var c = 0; c < 3; c++) {
+    var global = WScript.LoadScript(source, "samethread");
+    var result = global.run();
+    if (expected === undefined) {
+        expected = result;
+    } else if (result !== expected) {
+        WScript.Echo("FAILED: context " + c + " returned " + result + ", expected " + expected);
+    }
+}
+WScript.Echo("pass");
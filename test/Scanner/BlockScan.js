@@ -0,0 +1,76 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// The scanner skips over runs of plain ASCII in strings, comments and identifiers a block at a time.
+// Put the characters that end a run at every offset around the block boundaries.
+const maxOffset = 40;
+
+function pad(n) {
+    return "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789".repeat(2).substring(0, n);
+}
+
+var tests = [
+    {
+        name: "String literals",
+        body: function () {
+            const specials = [
+                ["\\n", "\n"], ["\\\\", "\\"], ["\\x41", "A"], ["\\u00e9", "é"],
+                ["'", "'"], ["`", "`"], ["$", "$"], ["é", "é"], ["☃", "☃"], ["\u{1F600}", "\u{1F600}"]
+            ];
+            for (let i = 0; i <= maxOffset; i++) {
+                for (const [source, value] of specials) {
+                    const expected = pad(i) + value + pad(i);
+                    assert.areEqual(expected, eval('"' + pad(i) + source + pad(i) + '"'), "offset " + i + ", " + source);
+                }
+                assert.areEqual(pad(i) + '"' + pad(i), eval("'" + pad(i) + '"' + pad(i) + "'"), "offset " + i + ", double quote");
+                assert.throws(function () { eval('"' + pad(i) + "\n" + '"'); }, SyntaxError, "offset " + i + ", line break");
+                assert.throws(function () { eval('"' + pad(i)); }, SyntaxError, "offset " + i + ", unterminated");
+            }
+        }
+    },
+    {
+        name: "Template literals",
+        body: function () {
+            for (let i = 0; i <= maxOffset; i++) {
+                const x = "X";
+                assert.areEqual(pad(i) + "X" + pad(i), eval("`" + pad(i) + "${x}" + pad(i) + "`"), "offset " + i + ", substitution");
+                assert.areEqual(pad(i) + "$" + pad(i), eval("`" + pad(i) + "$" + pad(i) + "`"), "offset " + i + ", dollar");
+                assert.areEqual(pad(i) + "\n" + pad(i), eval("`" + pad(i) + "\r\n" + pad(i) + "`"), "offset " + i + ", CRLF");
+                assert.areEqual(pad(i) + "\\n", eval("String.raw`" + pad(i) + "\\n`"), "offset " + i + ", raw");
+            }
+        }
+    },
+    {
+        name: "Multi-line comments",
+        body: function () {
+            for (let i = 0; i <= maxOffset; i++) {
+                assert.areEqual(1, eval("/*" + pad(i) + "*/ 1"), "offset " + i);
+                assert.areEqual(2, eval("/*" + pad(i) + "* / ** " + pad(i) + "**/ 2"), "offset " + i + ", stars");
+                assert.areEqual(3, eval("/*" + pad(i) + " " + pad(i) + "*/ 3"), "offset " + i + ", LS");
+                assert.areEqual(4, eval("var a = 1 /*" + pad(i) + "\n*/ a = 4; a"), "offset " + i + ", line break");
+                assert.areEqual(5, eval("/*" + pad(i) + "é\u{1F600}" + pad(i) + "*/ 5"), "offset " + i + ", non-ASCII");
+                assert.throws(function () { eval("/*" + pad(i)); }, SyntaxError, "offset " + i + ", unterminated");
+            }
+        }
+    },
+    {
+        name: "Identifiers",
+        body: function () {
+            for (let i = 1; i <= maxOffset; i++) {
+                const id = pad(i);
+                assert.areEqual(i, eval("var " + id + " = " + i + "; " + id), "length " + i);
+                assert.areEqual(i, eval("var " + id + "_$9 = " + i + "; " + id + "_$9"), "length " + i + ", _$9");
+                assert.areEqual(i, eval("var " + id + "é = " + i + "; " + id + "é"), "length " + i + ", non-ASCII");
+                assert.areEqual(i, eval("var " + id + "\\u0041 = " + i + "; " + id + "A"), "length " + i + ", escape");
+                assert.areEqual(i + 1, eval("var " + id + " = " + i + "; " + id + "+1"), "length " + i + ", operator");
+                assert.areEqual(i, eval("({" + id + ":" + i + "})." + id), "length " + i + ", property");
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,32 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Integer and floating point arithmetic on locals: short, cheap opcodes where dispatch dominates.
+
+var _startDate = new Date();
+
+function run(n) {
+    var a = 0, b = 1, c = 0.5;
+    for (var i = 0; i < n; i++) {
+        a = (a + i * 3) | 0;
+        b = (b ^ (a >>> 3)) & 0xffff;
+        c = c * 0.999 + b * 0.001;
+        if (a > 100000) {
+            a -= 100000;
+        }
+    }
+    return a + b + Math.floor(c);
+}
+
+var result = 0;
+for (var j = 0; j < 10; j++) {
+    result = run(1000000);
+}
+
+if (result !== -1377485643) {
+    throw "Error: bad result " + result;
+}
+
+WScript.Echo("### TIME:", new Date() - _startDate, "ms");
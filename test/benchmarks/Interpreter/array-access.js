@@ -0,0 +1,36 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Element loads and stores on arrays and typed arrays.
+
+var _startDate = new Date();
+
+function run(n) {
+    var a = new Array(1024);
+    var t = new Int32Array(1024);
+    for (var i = 0; i < 1024; i++) {
+        a[i] = i;
+    }
+
+    var sum = 0;
+    for (var k = 0; k < n; k++) {
+        for (var i = 1; i < 1024; i++) {
+            t[i] = (t[i - 1] + a[i]) & 0xffff;
+            sum = (sum + t[i]) | 0;
+        }
+    }
+    return sum;
+}
+
+var result = 0;
+for (var j = 0; j < 5; j++) {
+    result = run(1000);
+}
+
+if (result !== -1054339072) {
+    throw "Error: bad result " + result;
+}
+
+WScript.Echo("### TIME:", new Date() - _startDate, "ms");
@@ -0,0 +1,35 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Conditional branches and switch statements that are hard to predict.
+
+var _startDate = new Date();
+
+function run(n) {
+    var seed = 12345;
+    var counts = [0, 0, 0, 0, 0];
+    for (var i = 0; i < n; i++) {
+        seed = (Math.imul(seed, 1103515245) + 12345) & 0x7fffffff;
+        switch (seed % 5) {
+            case 0: counts[0]++; break;
+            case 1: counts[1] += 2; break;
+            case 2: if (seed & 1) { counts[2]++; } else { counts[2]--; } break;
+            case 3: counts[3] = counts[3] < 1000 ? counts[3] + 1 : 0; break;
+            default: counts[4] ^= seed; break;
+        }
+    }
+    return counts.join(",");
+}
+
+var result;
+for (var j = 0; j < 5; j++) {
+    result = run(1000000);
+}
+
+if (result !== "199994,400248,378,680,845002736") {
+    throw "Error: bad result " + result;
+}
+
+WScript.Echo("### TIME:", new Date() - _startDate, "ms");
@@ -0,0 +1,43 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Calls to small functions, methods and closures.
+
+var _startDate = new Date();
+
+function add(a, b) {
+    return a + b;
+}
+
+var obj = {
+    value: 1,
+    inc: function (n) { return this.value + n; }
+};
+
+function makeCounter() {
+    var count = 0;
+    return function () { return ++count; };
+}
+
+function run(n) {
+    var counter = makeCounter();
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum = add(sum, obj.inc(i & 7)) & 0xfffff;
+        counter();
+    }
+    return sum + counter();
+}
+
+var result = 0;
+for (var j = 0; j < 5; j++) {
+    result = run(1000000);
+}
+
+if (result !== 1305697) {
+    throw "Error: bad result " + result;
+}
+
+WScript.Echo("### TIME:", new Date() - _startDate, "ms");
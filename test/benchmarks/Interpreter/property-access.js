@@ -0,0 +1,36 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Named property loads and stores through inline caches.
+
+var _startDate = new Date();
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+
+function run(n) {
+    var p = new Point(1, 2);
+    var q = { x: 0, y: 0, z: 0 };
+    for (var i = 0; i < n; i++) {
+        q.x = p.x + q.y;
+        q.y = p.y + q.z;
+        q.z = (q.x + q.y) & 0xff;
+        p.x = q.z;
+    }
+    return q.x + q.y + q.z;
+}
+
+var result = 0;
+for (var j = 0; j < 10; j++) {
+    result = run(1000000);
+}
+
+if (result !== 640) {
+    throw "Error: bad result " + result;
+}
+
+WScript.Echo("### TIME:", new Date() - _startDate, "ms");
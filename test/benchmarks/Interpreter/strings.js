@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String concatenation, charCodeAt and comparisons.
+
+var _startDate = new Date();
+
+function run(n) {
+    var words = ["alpha", "beta", "gamma", "delta", "epsilon"];
+    var hash = 0;
+    for (var i = 0; i < n; i++) {
+        var s = words[i % 5] + "-" + (i & 15);
+        for (var k = 0; k < s.length; k++) {
+            hash = (hash * 31 + s.charCodeAt(k)) | 0;
+        }
+        if (s === "gamma-7") {
+            hash ^= 0x5555;
+        }
+    }
+    return hash;
+}
+
+var result = 0;
+for (var j = 0; j < 5; j++) {
+    result = run(200000);
+}
+
+if (result !== 1845458304) {
+    throw "Error: bad result " + result;
+}
+
+WScript.Echo("### TIME:", new Date() - _startDate, "ms");
@@ -0,0 +1,159 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Out of bounds accesses from JIT'd code to virtual array buffers are recovered from the SIGSEGV handler.
+// Any other access violation, including one in the guard pages of a virtual buffer that doesn't come from
+// JIT'd code, must still crash the process.
+
+#include "ChakraCore.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#define FAIL_CHECK(cmd)                     \
+    do                                      \
+    {                                       \
+        JsErrorCode errCode = cmd;          \
+        if (errCode != JsNoError)           \
+        {                                   \
+            printf("Error %d at '%s'\n",    \
+                errCode, #cmd);             \
+            return 1;                       \
+        }                                   \
+    } while(0)
+
+static unsigned currentSourceContext = 0;
+
+static int RunScript(const char* script, char* resultSTR, size_t resultSize)
+{
+    JsValueRef fname;
+    FAIL_CHECK(JsCreateString("sample", strlen("sample"), &fname));
+
+    JsValueRef scriptSource;
+    FAIL_CHECK(JsCreateExternalArrayBuffer((void*)script, (unsigned int)strlen(script),
+        nullptr, nullptr, &scriptSource));
+
+    JsValueRef result;
+    FAIL_CHECK(JsRun(scriptSource, currentSourceContext++, fname, JsParseScriptAttributeNone, &result));
+
+    JsValueRef resultJSString;
+    FAIL_CHECK(JsConvertValueToString(result, &resultJSString));
+
+    size_t stringLength;
+    FAIL_CHECK(JsCopyString(resultJSString, resultSTR, resultSize - 1, &stringLength));
+    resultSTR[stringLength] = 0;
+    return 0;
+}
+
+// Runs the access in a child process and checks that it was killed by SIGSEGV
+static bool Crashes(void (*access)(volatile char*), volatile char* address)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        access(address);
+        _exit(0);
+    }
+
+    int status;
+    if (pid == -1 || waitpid(pid, &status, 0) != pid)
+    {
+        return false;
+    }
+    return WIFSIGNALED(status) && WTERMSIG(status) == SIGSEGV;
+}
+
+static void Load(volatile char* address)
+{
+    (void)*(volatile int*)address;
+}
+
+static void Store(volatile char* address)
+{
+    *(volatile int*)address = 1;
+}
+
+// Loads and stores past the end of the heap in asm.js, and of a virtual buffer in plain JS, once jitted.
+// Loads read 0 or NaN and stores are dropped.
+static const char* recoveredScript =
+    "function AsmModule(stdlib, foreign, heap) {\n"
+    "    'use asm';\n"
+    "    var i8 = new stdlib.Int8Array(heap);\n"
+    "    var i32 = new stdlib.Int32Array(heap);\n"
+    "    var f32 = new stdlib.Float32Array(heap);\n"
+    "    var f64 = new stdlib.Float64Array(heap);\n"
+    "    function access(i) {\n"
+    "        i = i | 0;\n"
+    "        i8[i >> 0] = 1;\n"
+    "        i32[i >> 2] = 1;\n"
+    "        f64[i >> 3] = 1.0;\n"
+    "        return +(((i8[i >> 0] | 0) + (i32[i >> 2] | 0)) | 0) + +f64[i >> 3] + +f32[i >> 2];\n"
+    "    }\n"
+    "    return access;\n"
+    "}\n"
+    "var heap = new ArrayBuffer(0x10000);\n"
+    "var access = AsmModule(this, {}, heap);\n"
+    "var typed = new Int32Array(new ArrayBuffer(0x10000));\n"
+    "function store(a, i) { a[i] = 1; }\n"
+    "var ok = true;\n"
+    "for (var n = 0; n < 1000; n++) {\n"
+    "    var r = access(0x10000 + 8 * (n & 0xff));\n"
+    "    if (r === r) { ok = false; }\n"
+    "    if (access(16) !== 1) { ok = false; }\n"
+    "    store(typed, 0x4000 + (n & 0xff));\n"
+    "    store(typed, n & 0xff);\n"
+    "}\n"
+    "ok && typed[0] === 1 && typed[0x4000] === undefined ? 'recovered' : 'not recovered';\n";
+
+int main()
+{
+    JsRuntimeHandle runtime;
+    JsContextRef context;
+    char resultSTR[64];
+
+    // No background threads, so that the forked children don't inherit locks held by one of them
+    FAIL_CHECK(JsCreateRuntime(JsRuntimeAttributeDisableBackgroundWork, nullptr, &runtime));
+    FAIL_CHECK(JsCreateContext(runtime, &context));
+    FAIL_CHECK(JsSetCurrentContext(context));
+
+    if (RunScript(recoveredScript, resultSTR, sizeof(resultSTR)) != 0 || strcmp(resultSTR, "recovered") != 0)
+    {
+        printf("Out of bounds accesses from JIT'd code weren't recovered: %s\n", resultSTR);
+        return 1;
+    }
+
+    // Unrelated inaccessible memory
+    volatile char* noAccess = (volatile char*)mmap(nullptr, 0x10000, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (noAccess == (volatile char*)MAP_FAILED || !Crashes(Load, noAccess) || !Crashes(Store, noAccess + 0x100))
+    {
+        printf("Access violation outside of virtual buffers was recovered\n");
+        return 1;
+    }
+
+    // Guard pages of a virtual buffer, accessed from outside of JIT'd code
+    JsValueRef buffer;
+    FAIL_CHECK(JsCreateArrayBuffer(0x10000, &buffer));
+    ChakraBytePtr bufferStorage;
+    unsigned int bufferLength;
+    FAIL_CHECK(JsGetArrayBufferStorage(buffer, &bufferStorage, &bufferLength));
+    if (!Crashes(Load, (volatile char*)bufferStorage + bufferLength) ||
+        !Crashes(Store, (volatile char*)bufferStorage + bufferLength + 0x1000))
+    {
+        printf("Access violation in a virtual buffer from outside of JIT'd code was recovered\n");
+        return 1;
+    }
+
+    printf("SUCCESS\n");
+
+    JsSetCurrentContext(JS_INVALID_REFERENCE);
+    JsDisposeRuntime(runtime);
+
+    return 0;
+}
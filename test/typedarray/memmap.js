@@ -0,0 +1,125 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Compares element-wise loops over typed arrays, which the JIT can replace with a single memmap helper call,
+// with the same computation done on plain arrays
+// need to run with -mic:1 -off:simplejit -off:JITLoopBody
+// Run locally with -trace:memmap -trace:bailout to help find bugs
+
+const global = this;
+const n = 500;
+let passed = 1;
+
+const kernels = [
+  { types: "Float32Array Float64Array Int32Array", op: "+" },
+  { types: "Float32Array Float64Array Int32Array", op: "-" },
+  { types: "Float32Array Float64Array", op: "*" },
+  { types: "Float32Array Float64Array", op: "/" },
+];
+
+function getArrayTest(name, op) {
+  var fn;
+  eval(`fn = function memmap_${name}_array(a, b, c, start, end) {for (var i = start; i < end; i++) { c[i] = a[i] ${op} b[i]; }}`);
+  return fn;
+}
+
+function getScalarTest(name, op) {
+  var fn;
+  eval(`fn = function memmap_${name}_scalar(a, x, c, start, end) {for (var i = start; i < end; i++) { c[i] = a[i] ${op} x; }}`);
+  return fn;
+}
+
+function getConstantTest(name, op) {
+  var fn;
+  eval(`fn = function memmap_${name}_constant(a, c, start, end) {for (var i = start; i < end; i++) { c[i] = 3 ${op} a[i]; }}`);
+  return fn;
+}
+
+function compute(arrType, x, op, y) {
+  const result = op === "+" ? x + y : op === "-" ? x - y : op === "*" ? x * y : x / y;
+  return arrType === "Int32Array" ? result | 0 : arrType === "Float32Array" ? Math.fround(result) : result;
+}
+
+function check(arrType, test, actual, expected) {
+  for (let j = 0; j < expected.length; j++) {
+    if (!Object.is(actual[j], expected[j])) {
+      passed = 0;
+      WScript.Echo(arrType + " " + test + " " + j + " " + actual[j] + " " + expected[j]);
+      return;
+    }
+  }
+}
+
+function fill(arr, seed) {
+  for (let i = 0; i < arr.length; ++i) {
+    arr[i] = arr instanceof Int32Array ? (i * seed) | 0 : (i - 250) * seed + 0.25;
+  }
+  // Values that overflow int32 arithmetic
+  if (arr instanceof Int32Array) {
+    arr[1] = 0x7fffffff;
+    arr[2] = -0x80000000;
+  }
+}
+
+let testIndex = 0;
+for (let kernel of kernels) {
+  const op = kernel.op;
+  for (let arrType of kernel.types.split(" ")) {
+    const name = arrType + testIndex++;
+    const a = new global[arrType](n);
+    const b = new global[arrType](n);
+    fill(a, 3);
+    fill(b, 7);
+
+    // Array operands, in two calls so the second one runs the jitted loop
+    const arrayTest = getArrayTest(name, op);
+    const c = new global[arrType](n);
+    const mid = (n / 2) | 0;
+    arrayTest(a, b, c, 0, mid);
+    arrayTest(a, b, c, mid, n);
+    check(arrType, "array", c, Array.from(a, (v, i) => compute(arrType, v, op, b[i])));
+
+    // Loop invariant operand
+    const scalarTest = getScalarTest(name, op);
+    const x = arrType === "Int32Array" ? 0x40000000 : 1.5;
+    const d = new global[arrType](n);
+    scalarTest(a, x, d, 0, mid);
+    scalarTest(a, x, d, mid, n);
+    check(arrType, "scalar", d, Array.from(a, v => compute(arrType, v, op, x)));
+
+    // Constant operand, on the left of a non commutative operation
+    const constantTest = getConstantTest(name, op);
+    const e = new global[arrType](n);
+    constantTest(a, e, 0, mid);
+    constantTest(a, e, mid, n);
+    check(arrType, "constant", e, Array.from(a, v => compute(arrType, 3, op, v)));
+
+    // Past the end of the arrays. Nothing must be written by the helper, the loop runs in the interpreter.
+    const f = new global[arrType](n);
+    const short = new global[arrType](n - 10);
+    fill(short, 5);
+    arrayTest(a, short, f, 0, n);
+    check(arrType, "out of bounds", f, Array.from(a, (v, i) => compute(arrType, v, op, i < n - 10 ? short[i] : undefined)));
+
+    // Views of the same buffer, where each element written is read by the next iteration
+    const buffer = new ArrayBuffer((n + 1) * global[arrType].BYTES_PER_ELEMENT);
+    const src = new global[arrType](buffer, 0, n);
+    const dst = new global[arrType](buffer, global[arrType].BYTES_PER_ELEMENT, n);
+    fill(src, 3);
+    const expected = Array.from(new global[arrType](buffer));
+    for (let i = 0; i < n; i++) {
+      expected[i + 1] = compute(arrType, expected[i], op, b[i]);
+    }
+    arrayTest(src, b, dst, 0, mid);
+    arrayTest(src, b, dst, mid, n);
+    check(arrType, "overlap", Array.from(new global[arrType](buffer)), expected);
+  }
+}
+
+if (passed === 1) {
+  WScript.Echo("PASSED");
+} else {
+  WScript.Echo("FAILED");
+}